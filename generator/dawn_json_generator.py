@@ -852,7 +852,8 @@ class MultiGeneratorFromDawnJSON(Generator):
     def add_commandline_arguments(self, parser):
         allowed_targets = [
             'dawn_headers', 'cpp_headers', 'cpp', 'proc', 'mock_api', 'wire',
-            'native_utils', 'dawn_lpmfuzz_cpp', 'dawn_lpmfuzz_proto'
+            'wire_replay', 'native_utils', 'dawn_lpmfuzz_cpp',
+            'dawn_lpmfuzz_proto'
         ]
 
         parser.add_argument('--dawn-json',
@@ -928,6 +929,12 @@ class MultiGeneratorFromDawnJSON(Generator):
                            'src/dawn/' + prefix + '_thread_dispatch_proc.cpp',
                            [RENDER_PARAMS_BASE, params_dawn]))
 
+        if 'wire_replay' in targets:
+            renders.append(
+                FileRender('dawn/wire/replay/TimedProcs.cpp',
+                           'src/dawn/wire/replay/TimedProcs_autogen.cpp',
+                           [RENDER_PARAMS_BASE, params_dawn]))
+
         if 'webgpu_dawn_native_proc' in targets:
             renders.append(
                 FileRender('dawn/native/api_dawn_native_proc.cpp',
@@ -28,6 +28,17 @@ namespace dawn::wire {
     template <typename T>
     using PerObjectType = ityp::array<ObjectType, T, {{len(by_category["object"])}}>;
 
+    // Returns the name of the type, like "BindGroup".
+    inline const char* ObjectTypeAsString(ObjectType type) {
+        switch (type) {
+            {% for type in by_category["object"] %}
+                case ObjectType::{{type.name.CamelCase()}}:
+                    return "{{type.name.CamelCase()}}";
+            {% endfor %}
+        }
+        return "";
+    }
+
 } // namespace dawn::wire
 
 
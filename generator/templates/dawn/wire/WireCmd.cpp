@@ -107,32 +107,35 @@
     //* Structure for the wire format of each of the records. Members that are values
     //* are embedded directly in the structure. Other members are assumed to be in the
     //* memory directly following the structure in the buffer.
-    struct {{Return}}{{name}}Transfer{{Inherits}} {
-        static_assert({{[is_cmd, record.extensible, record.chained].count(True)}} <= 1,
-                      "Record must be at most one of is_cmd, extensible, and chained.");
-        {% if is_cmd %}
-            //* Start the transfer structure with the command ID, so that casting to WireCmd gives the ID.
-            {{Return}}WireCmd commandId;
-        {% elif record.extensible %}
-            bool hasNextInChain;
-        {% elif record.chained %}
-            WGPUChainedStructTransfer chain;
-        {% endif %}
+    //* The structures of the fast path commands are declared in WireCmd_autogen.h instead.
+    {% if not (is_cmd and not is_return_command and name in server_fast_path_commands) %}
+        struct {{Return}}{{name}}Transfer{{Inherits}} {
+            static_assert({{[is_cmd, record.extensible, record.chained].count(True)}} <= 1,
+                          "Record must be at most one of is_cmd, extensible, and chained.");
+            {% if is_cmd %}
+                //* Start the transfer structure with the command ID, so that casting to WireCmd gives the ID.
+                {{Return}}WireCmd commandId;
+            {% elif record.extensible %}
+                bool hasNextInChain;
+            {% elif record.chained %}
+                WGPUChainedStructTransfer chain;
+            {% endif %}
 
-        //* Value types are directly in the command, objects being replaced with their IDs.
-        {% for member in members if member.annotation == "value" %}
-            {{member_transfer_type(member)}} {{as_varName(member.name)}};
-        {% endfor %}
+            //* Value types are directly in the command, objects being replaced with their IDs.
+            {% for member in members if member.annotation == "value" %}
+                {{member_transfer_type(member)}} {{as_varName(member.name)}};
+            {% endfor %}
 
-        //* const char* have their length embedded directly in the command.
-        {% for member in members if member.length == "strlen" %}
-            uint64_t {{as_varName(member.name)}}Strlen;
-        {% endfor %}
+            //* const char* have their length embedded directly in the command.
+            {% for member in members if member.length == "strlen" %}
+                uint64_t {{as_varName(member.name)}}Strlen;
+            {% endfor %}
 
-        {% for member in members if member.optional and member.annotation != "value" and member.type.category != "object" %}
-            bool has_{{as_varName(member.name)}};
-        {% endfor %}
-    };
+            {% for member in members if member.optional and member.annotation != "value" and member.type.category != "object" %}
+                bool has_{{as_varName(member.name)}};
+            {% endfor %}
+        };
+    {% endif %}
 
     {% if is_cmd %}
         static_assert(offsetof({{Return}}{{name}}Transfer, commandSize) == 0);
@@ -57,6 +57,18 @@ namespace dawn::wire {
         {% endfor %}
     };
 
+    //* Returns the name of a command for the tools inspecting the wire format, or nullptr if the
+    //* command doesn't exist.
+    inline const char* GetWireCmdName(WireCmd command) {
+        switch (command) {
+            {% for command in cmd_records["command"] %}
+                case WireCmd::{{command.name.CamelCase()}}:
+                    return "{{command.name.CamelCase()}}";
+            {% endfor %}
+        }
+        return nullptr;
+    }
+
     //* Enum used as a prefix to each command on the return wire format.
     enum class ReturnWireCmd : uint32_t {
         {% for command in cmd_records["return command"] %}
@@ -68,6 +80,34 @@ namespace dawn::wire {
         uint64_t commandSize;
     };
 
+    //* The wire format of the fast path commands is public so that the server can decode them in
+    //* place. The wire format of the other records is private to WireCmd_autogen.cpp.
+    {% for command in cmd_records["command"] if command.name.CamelCase() in server_fast_path_commands %}
+        struct {{command.name.CamelCase()}}Transfer : CmdHeader {
+            WireCmd commandId;
+
+            //* Value types are directly in the command, objects being replaced with their IDs.
+            {% for member in command.members if member.annotation == "value" %}
+                {{ assert(member.type.category != "structure") }}
+                {% if member.type.category == "object" %}
+                    ObjectId {{as_varName(member.name)}};
+                {% elif member.type.category == "bitmask" %}
+                    {{as_cType(member.type.name)}}Flags {{as_varName(member.name)}};
+                {% else %}
+                    {{as_cType(member.type.name)}} {{as_varName(member.name)}};
+                {% endif %}
+            {% endfor %}
+
+            //* Arrays of values follow the structure in the buffer.
+            {% for member in command.members if member.annotation != "value" %}
+                {{ assert(member.annotation == "const*") }}
+                {{ assert(member.length != "strlen" and member.length != "constant") }}
+                {{ assert(member.type.category not in ["object", "structure"]) }}
+                {{ assert(not member.optional) }}
+            {% endfor %}
+        };
+    {% endfor %}
+
 {% macro write_command_struct(command, is_return_command) %}
     {% set Return = "Return" if is_return_command else "" %}
     {% set Cmd = command.name.CamelCase() + "Cmd" %}
@@ -24,7 +24,8 @@ namespace dawn::wire::server {
 
         {% set Suffix = command.name.CamelCase() %}
         {% if Suffix not in client_side_commands %}
-            {% if is_method and Suffix not in server_handwritten_commands %}
+            {% if is_method and Suffix not in server_handwritten_commands and
+                  Suffix not in server_fast_path_commands %}
                 bool Server::Do{{Suffix}}(
                     {%- for member in command.members -%}
                         {%- if member.is_return_value -%}
@@ -12,7 +12,10 @@
 //* See the License for the specific language governing permissions and
 //* limitations under the License.
 
+#include <cstring>
+
 #include "dawn/common/Assert.h"
+#include "dawn/wire/BufferConsumer_impl.h"
 #include "dawn/wire/server/Server.h"
 
 namespace dawn::wire::server {
@@ -22,70 +25,137 @@ namespace dawn::wire::server {
         {% set returns = is_method and method.return_type.name.canonical_case() != "void" %}
 
         {% set Suffix = command.name.CamelCase() %}
-        //* The generic command handlers
-        bool Server::Handle{{Suffix}}(DeserializeBuffer* deserializeBuffer) {
-            {{Suffix}}Cmd cmd;
-            WireResult deserializeResult = cmd.Deserialize(deserializeBuffer, &mAllocator
-                {%- if command.may_have_dawn_object -%}
-                    , *this
-                {%- endif -%}
-            );
-
-            if (deserializeResult == WireResult::FatalError) {
-                return false;
-            }
-
-            {% if Suffix in server_custom_pre_handler_commands %}
-                if (!PreHandle{{Suffix}}(cmd)) {
+        {% if Suffix in server_fast_path_commands %}
+            {{ assert(is_method and not returns) }}
+            {{ assert(Suffix not in server_custom_pre_handler_commands) }}
+            {{ assert(Suffix not in server_handwritten_commands) }}
+            {{ assert(Suffix not in client_side_commands) }}
+            //* The fast path handlers read the command in place instead of deserializing it into a
+            //* {{Suffix}}Cmd. The objects are looked up directly in the known objects instead of
+            //* through the ObjectIdResolver, and the procs are called without going through a doer.
+            bool Server::Handle{{Suffix}}(DeserializeBuffer* deserializeBuffer) {
+                const volatile {{Suffix}}Transfer* transfer;
+                if (deserializeBuffer->Read(&transfer) != WireResult::Success) {
                     return false;
                 }
-            {% endif %}
 
-            //* Allocate any result objects
-            {%- for member in command.members if member.is_return_value -%}
-                {{ assert(member.handle_type) }}
-                {% set Type = member.handle_type.name.CamelCase() %}
-                {% set name = as_varName(member.name) %}
+                //* Each value is read from the buffer exactly once so that the server can't be
+                //* confused by the client changing the buffer concurrently.
+                {% for member in command.members if member.annotation == "value" %}
+                    {% set name = as_varName(member.name) %}
+                    {% if member.type.category == "object" %}
+                        {% set Type = member.type.name.CamelCase() %}
+                        ObjectId {{name}}Id = transfer->{{name}};
+                        {{as_cType(member.type.name)}} {{name}} = nullptr;
+                        {% if member.optional %}
+                            if ({{name}}Id != 0)
+                        {% endif %}
+                        {
+                            auto* {{name}}Data = {{Type}}Objects().Get({{name}}Id);
+                            if ({{name}}Data == nullptr) {
+                                return false;
+                            }
+                            {{name}} = {{name}}Data->handle;
+                        }
+                    {% else %}
+                        {{as_annotated_cType(member)}} = transfer->{{name}};
+                    {% endif %}
+                {% endfor %}
+
+                //* Arrays of values are copied out of the buffer for the same reason. They use the
+                //* inline storage of the allocator unless they are very large.
+                {% for member in command.members if member.annotation != "value" %}
+                    {% set name = as_varName(member.name) %}
+                    {% set cType = as_cType(member.type.name) %}
+                    const volatile {{cType}}* {{name}}Buffer;
+                    if (deserializeBuffer->ReadN({{as_varName(member.length.name)}}, &{{name}}Buffer) !=
+                        WireResult::Success) {
+                        return false;
+                    }
+                    {{cType}}* {{name}}Copy = static_cast<{{cType}}*>(
+                        mAllocator.GetSpace(sizeof({{cType}}) * {{as_varName(member.length.name)}}));
+                    if ({{name}}Copy == nullptr) {
+                        return false;
+                    }
+                    memcpy({{name}}Copy, const_cast<const {{cType}}*>({{name}}Buffer),
+                           sizeof({{cType}}) * {{as_varName(member.length.name)}});
+                    const {{cType}}* {{name}} = {{name}}Copy;
+                {% endfor %}
+
+                mProcs.{{as_varName(command.derived_object.name, method.name)}}(
+                    {%- for member in command.members -%}
+                        {{as_varName(member.name)}}
+                        {%- if not loop.last -%}, {% endif %}
+                    {%- endfor -%}
+                );
+                return true;
+            }
+        {% else %}
+            //* The generic command handlers
+            bool Server::Handle{{Suffix}}(DeserializeBuffer* deserializeBuffer) {
+                {{Suffix}}Cmd cmd;
+                WireResult deserializeResult = cmd.Deserialize(deserializeBuffer, &mAllocator
+                    {%- if command.may_have_dawn_object -%}
+                        , *this
+                    {%- endif -%}
+                );
 
-                auto* {{name}}Data = {{Type}}Objects().Allocate(cmd.{{name}});
-                if ({{name}}Data == nullptr) {
+                if (deserializeResult == WireResult::FatalError) {
                     return false;
                 }
-                {{name}}Data->generation = cmd.{{name}}.generation;
-            {% endfor %}
-
-            //* Do command
-            bool success = Do{{Suffix}}(
-                {%- for member in command.members -%}
-                    {%- if member.is_return_value -%}
-                        {%- if member.handle_type -%}
-                            &{{as_varName(member.name)}}Data->handle //* Pass the handle of the output object to be written by the doer
+
+                {% if Suffix in server_custom_pre_handler_commands %}
+                    if (!PreHandle{{Suffix}}(cmd)) {
+                        return false;
+                    }
+                {% endif %}
+
+                //* Allocate any result objects
+                {%- for member in command.members if member.is_return_value -%}
+                    {{ assert(member.handle_type) }}
+                    {% set Type = member.handle_type.name.CamelCase() %}
+                    {% set name = as_varName(member.name) %}
+
+                    auto* {{name}}Data = {{Type}}Objects().Allocate(cmd.{{name}});
+                    if ({{name}}Data == nullptr) {
+                        return false;
+                    }
+                    {{name}}Data->generation = cmd.{{name}}.generation;
+                {% endfor %}
+
+                //* Do command
+                bool success = Do{{Suffix}}(
+                    {%- for member in command.members -%}
+                        {%- if member.is_return_value -%}
+                            {%- if member.handle_type -%}
+                                &{{as_varName(member.name)}}Data->handle //* Pass the handle of the output object to be written by the doer
+                            {%- else -%}
+                                &cmd.{{as_varName(member.name)}}
+                            {%- endif -%}
                         {%- else -%}
-                            &cmd.{{as_varName(member.name)}}
+                            cmd.{{as_varName(member.name)}}
                         {%- endif -%}
-                    {%- else -%}
-                        cmd.{{as_varName(member.name)}}
-                    {%- endif -%}
-                    {%- if not loop.last -%}, {% endif %}
-                {%- endfor -%}
-            );
+                        {%- if not loop.last -%}, {% endif %}
+                    {%- endfor -%}
+                );
 
-            if (!success) {
-                return false;
-            }
+                if (!success) {
+                    return false;
+                }
 
-            {%- for member in command.members if member.is_return_value and member.handle_type -%}
-                {% set Type = member.handle_type.name.CamelCase() %}
-                {% set name = as_varName(member.name) %}
+                {%- for member in command.members if member.is_return_value and member.handle_type -%}
+                    {% set Type = member.handle_type.name.CamelCase() %}
+                    {% set name = as_varName(member.name) %}
 
-                {% if Type in server_reverse_lookup_objects %}
-                    //* For created objects, store a mapping from them back to their client IDs
-                    {{Type}}ObjectIdTable().Store({{name}}Data->handle, cmd.{{name}}.id);
-                {% endif %}
-            {% endfor %}
+                    {% if Type in server_reverse_lookup_objects %}
+                        //* For created objects, store a mapping from them back to their client IDs
+                        {{Type}}ObjectIdTable().Store({{name}}Data->handle, cmd.{{name}}.id);
+                    {% endif %}
+                {% endfor %}
 
-            return true;
-        }
+                return true;
+            }
+        {% endif %}
     {% endfor %}
 
     const volatile char* Server::HandleCommandsImpl(const volatile char* commands, size_t size) {
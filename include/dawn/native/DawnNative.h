@@ -145,6 +145,17 @@ struct DAWN_NATIVE_EXPORT AdapterDiscoveryOptionsBase {
 
 enum BackendValidationLevel { Full, Partial, Disabled };
 
+// Statistics of the cache of parsed WGSL programs that an instance shares between its devices.
+struct DAWN_NATIVE_EXPORT TintProgramCacheStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictionCount = 0;
+    size_t programCount = 0;
+    // The estimated memory used by the cached programs, and the size they are limited to.
+    size_t estimatedSize = 0;
+    size_t maxSize = 0;
+};
+
 // Represents a connection to dawn_native and is used for dependency injection, discovering
 // system adapters and injecting custom adapters (like a Swiftshader Vulkan adapter).
 //
@@ -182,6 +193,11 @@ class DAWN_NATIVE_EXPORT Instance {
     // Enable / disable the adapter blocklist.
     void EnableAdapterBlocklist(bool enable);
 
+    // Limits the estimated memory used by the parsed WGSL programs that the devices of the instance
+    // share when they create shader modules with the same source. 0 disables the sharing.
+    void SetTintProgramCacheMaxSize(size_t maxSize);
+    TintProgramCacheStats GetTintProgramCacheStats() const;
+
     // TODO(dawn:1374) Deprecate this once it is passed via the descriptor.
     void SetPlatform(dawn::platform::Platform* platform);
 
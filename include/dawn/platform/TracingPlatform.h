@@ -0,0 +1,78 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDE_DAWN_PLATFORM_TRACINGPLATFORM_H_
+#define INCLUDE_DAWN_PLATFORM_TRACINGPLATFORM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "dawn/platform/DawnPlatform.h"
+
+namespace dawn::platform {
+
+// A Platform that records the trace events of Dawn (device ticks, submits, pipeline and shader
+// compilations, ...) in memory and exports them in the JSON Trace Event Format, which can be
+// loaded in Chrome's about://tracing and in Perfetto.
+//
+// Each thread records its events in its own ring buffer without taking locks, and the oldest
+// events of a thread are overwritten when its buffer is full. Recording is disabled by default and
+// can be toggled at any time, and while it is disabled the trace events only cost a load and a
+// branch. The category flags are shared by all the TracingPlatforms, and the TRACE_EVENT macros
+// cache the flags of the first platform they are called with, so the TracingPlatform should be the
+// first platform that Dawn is used with in the process.
+class DAWN_PLATFORM_EXPORT TracingPlatform : public Platform {
+  public:
+    static constexpr size_t kDefaultEventsPerThread = 16384;
+
+    explicit TracingPlatform(size_t eventsPerThread = kDefaultEventsPerThread);
+    ~TracingPlatform() override;
+
+    void EnableRecording(bool enable);
+    bool IsRecording() const;
+
+    // Returns the recorded events, oldest first for each thread, in the JSON Trace Event Format.
+    // This doesn't clear the events. It can be called while events are recorded, in which case
+    // the events overwritten during the export are skipped.
+    std::string ExportTraceJSON() const;
+    // Writes the result of ExportTraceJSON() to |path|. Returns false if the file couldn't be
+    // written.
+    bool WriteTraceJSON(const char* path) const;
+
+    // Discards the recorded events. Must not be called while events are recorded.
+    void ClearEvents();
+
+    const unsigned char* GetTraceCategoryEnabledFlag(TraceCategory category) override;
+    double MonotonicallyIncreasingTime() override;
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override;
+
+  private:
+    class Recorder;
+    std::unique_ptr<Recorder> mRecorder;
+};
+
+}  // namespace dawn::platform
+
+#endif  // INCLUDE_DAWN_PLATFORM_TRACINGPLATFORM_H_
@@ -0,0 +1,53 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
+#define INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
+
+#include <memory>
+
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+// MemoryTransferServices that allocate the data of mappable buffers in named shared memory objects
+// that are mapped by both the client and the server. The content of mapped buffers is then never
+// sent in the commands of the wire:
+//  - Unmapping a buffer mapped for writing copies the written range from the shared memory
+//    directly to the mapping of the buffer on the server.
+//  - Mapping a buffer for reading copies the mapped range from the mapping of the buffer on the
+//    server directly to the shared memory.
+// The client creates a shared memory object for each Read/WriteHandle, named |namePrefix|
+// followed by a number, and the server opens it. |namePrefix| must be the same on both sides and
+// should be unique to the pair of client and server, for example "/dawn-<pid of the client>" on
+// POSIX systems. A handle can be destroyed before the server processed the command that creates
+// it, so the client keeps each object until the server opened it. Shared memory objects aren't
+// supported on all the platforms, in which case the services aren't created.
+namespace dawn::wire {
+
+namespace client {
+// Returns nullptr if shared memory objects aren't supported.
+DAWN_WIRE_EXPORT std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    const char* namePrefix);
+}  // namespace client
+
+namespace server {
+// Returns nullptr if shared memory objects aren't supported. Handles that name a shared memory
+// object that doesn't start with |namePrefix| are rejected.
+DAWN_WIRE_EXPORT std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    const char* namePrefix);
+}  // namespace server
+
+}  // namespace dawn::wire
+
+#endif  // INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
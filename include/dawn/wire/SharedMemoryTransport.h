@@ -0,0 +1,107 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSPORT_H_
+#define INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSPORT_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "dawn/wire/Wire.h"
+
+namespace dawn::wire {
+
+class SharedMemoryRing;
+
+// A single-producer, single-consumer transport for wire commands, backed by a ring buffer in a
+// named shared memory object so that the client and the server can live in different processes.
+// A bidirectional wire uses two rings: one for the commands of the client to the server, and one
+// for the commands of the server to the client.
+//  - The producer serializes the commands directly in the ring, and the consumer handles them in
+//    place. Commands are never copied by the transport.
+//  - The ring is mapped twice in a row in memory so that commands that wrap around the end of the
+//    ring are still contiguous. Only commands larger than the whole ring are chunked.
+// Either side of the ring may create the shared memory object, the other one opens it by name.
+// Names follow the rules of the platform, for example "/dawn-wire-1234" on POSIX systems, with at
+// most 31 characters on macOS. Shared memory objects aren't supported on all the platforms, in
+// which case Create and Open return nullptr.
+class DAWN_WIRE_EXPORT SharedMemoryCommandSerializer final : public CommandSerializer {
+  public:
+    // Creates a ring of at least |minCapacity| bytes. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryCommandSerializer> Create(const char* name,
+                                                                 size_t minCapacity);
+    // Opens a ring created by a SharedMemoryCommandReceiver. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryCommandSerializer> Open(const char* name);
+    ~SharedMemoryCommandSerializer() override;
+
+    // Waits for space in the ring when it is full. Returns nullptr if the receiver is closed.
+    void* GetCmdSpace(size_t size) override;
+    // Makes the commands serialized since the last Flush visible to the receiver.
+    bool Flush() override;
+    size_t GetMaximumAllocationSize() const override;
+
+    // Tells the receiver that no more commands will be serialized. Also done on destruction.
+    void Close();
+
+  private:
+    explicit SharedMemoryCommandSerializer(std::unique_ptr<SharedMemoryRing> ring);
+
+    std::unique_ptr<SharedMemoryRing> mRing;
+    // The end of the commands returned by GetCmdSpace, that aren't visible to the receiver until
+    // the next Flush.
+    uint64_t mReservedOffset = 0;
+    // The last known read offset of the receiver. It is only reloaded when the ring looks full.
+    uint64_t mCachedReadOffset = 0;
+    bool mClosed = false;
+};
+
+class DAWN_WIRE_EXPORT SharedMemoryCommandReceiver final {
+  public:
+    // Creates a ring of at least |minCapacity| bytes. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryCommandReceiver> Create(const char* name,
+                                                               size_t minCapacity);
+    // Opens a ring created by a SharedMemoryCommandSerializer. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryCommandReceiver> Open(const char* name);
+    ~SharedMemoryCommandReceiver();
+
+    SharedMemoryCommandReceiver(const SharedMemoryCommandReceiver& rhs) = delete;
+    SharedMemoryCommandReceiver& operator=(const SharedMemoryCommandReceiver& rhs) = delete;
+
+    // Passes all the flushed commands to |handler|, in place in the shared memory, and then
+    // releases their space to the serializer. Returns false if |handler| fails or if the
+    // serializer corrupted the ring. The commands are in memory that the other process can still
+    // write to, which the deserialization of the wire already guards against.
+    bool HandleCommands(CommandHandler* handler);
+
+    // Waits until there are flushed commands to handle. Returns false if the serializer was
+    // closed and all its commands were handled.
+    bool WaitForCommands();
+
+    // Returns the number of bytes of commands handled since the creation of the ring.
+    uint64_t GetHandledSize() const;
+
+    // Tells the serializer that no more commands will be handled. Also done on destruction.
+    void Close();
+
+  private:
+    explicit SharedMemoryCommandReceiver(std::unique_ptr<SharedMemoryRing> ring);
+
+    std::unique_ptr<SharedMemoryRing> mRing;
+    uint64_t mReadOffset = 0;
+    bool mClosed = false;
+};
+
+}  // namespace dawn::wire
+
+#endif  // INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSPORT_H_
@@ -58,9 +58,19 @@ struct ReservedInstance {
     uint32_t generation;
 };
 
+// The number of objects of a type that are alive on the client, that were created and not released
+// yet. |type| is the name of the type, like "BindGroup".
+struct LiveObjectCount {
+    const char* type;
+    size_t count;
+};
+
 struct DAWN_WIRE_EXPORT WireClientDescriptor {
     CommandSerializer* serializer;
     client::MemoryTransferService* memoryTransferService = nullptr;
+    // Packs the draws and the state changes of render passes in a compact encoding that uses fewer
+    // bytes per command. The server must be created with acceptCompactEncoding.
+    bool useCompactEncoding = false;
 };
 
 class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
@@ -75,6 +85,17 @@ class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
     ReservedDevice ReserveDevice();
     ReservedInstance ReserveInstance();
 
+    // Makes the server push the content of the range [offset, offset + size) of |buffer| after
+    // each QueueSubmit and keep the buffer mapped for reading. A MapAsync for reading inside the
+    // range then completes without a round trip to the server, calling the callback before
+    // returning, unless the buffer was written with QueueWriteBuffer or mapped since the last
+    // QueueSubmit. |buffer| must have the MapRead usage and must not be mapped. The range follows
+    // the rules of MapAsync. Returns false if the read-ahead can't be enabled.
+    bool EnableBufferReadAhead(WGPUBuffer buffer, size_t offset, size_t size);
+
+    // Returns the number of live objects of each type, to help finding leaks of objects.
+    std::vector<LiveObjectCount> GetLiveObjectCounts() const;
+
     void ReclaimTextureReservation(const ReservedTexture& reservation);
     void ReclaimSwapChainReservation(const ReservedSwapChain& reservation);
     void ReclaimDeviceReservation(const ReservedDevice& reservation);
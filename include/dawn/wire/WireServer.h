@@ -32,6 +32,8 @@ struct DAWN_WIRE_EXPORT WireServerDescriptor {
     const DawnProcTable* procs;
     CommandSerializer* serializer;
     server::MemoryTransferService* memoryTransferService = nullptr;
+    // Accepts the packed render pass commands of clients created with useCompactEncoding.
+    bool acceptCompactEncoding = false;
 };
 
 class DAWN_WIRE_EXPORT WireServer : public CommandHandler {
@@ -0,0 +1,146 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
+#define SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
+
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+#include "dawn/common/NonCopyable.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn {
+
+// A thread-safe cache of RefCounted objects that deduplicates them based on their content instead
+// of their pointer. The cache doesn't hold references to the objects: objects are expected to
+// remove themselves from the cache with Erase() when they are destroyed.
+//
+// To reduce contention between threads that create objects at the same time, the cache is split
+// in kShardCount shards selected from the content hash of the objects. Each shard has its own
+// reader-writer lock so lookups, which are the common case, only take a shared lock and never
+// block each other.
+//
+// Since objects are removed from the cache only once their refcount reached zero, a lookup can
+// find an object that is being destroyed on another thread. Such objects are never returned:
+// Find() and Insert() only return objects they successfully took a new reference on, and Insert()
+// replaces dying objects with the new one.
+//
+// `RefCountedT` is the type of the cached objects and `BlueprintT` is the type used to hash and
+// compare them (it must provide HashFunc and EqualityFunc functors). `RefCountedT` must derive
+// from `BlueprintT`, which allows looking up objects using a blueprint that isn't refcounted.
+template <typename RefCountedT, typename BlueprintT = RefCountedT>
+class ContentLessObjectCache : public NonMovable {
+    static_assert(std::is_base_of_v<BlueprintT, RefCountedT>,
+                  "The cached type must derive from the blueprint type.");
+
+  public:
+    static constexpr size_t kShardCount = 16;
+
+    ContentLessObjectCache() = default;
+
+    // Returns a new reference to the cached object equal to |blueprint|, or nullptr if there is
+    // none.
+    Ref<RefCountedT> Find(BlueprintT* blueprint) {
+        Shard& shard = GetShard(blueprint);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.set.find(blueprint);
+        if (iter == shard.set.end()) {
+            return nullptr;
+        }
+        return TryGetRef(*iter);
+    }
+
+    // Inserts |object| in the cache unless an equal, live object is already cached. Returns the
+    // cached object and whether |object| was inserted.
+    std::pair<Ref<RefCountedT>, bool> Insert(RefCountedT* object) {
+        Shard& shard = GetShard(object);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto [iter, inserted] = shard.set.insert(object);
+        if (inserted) {
+            return {object, true};
+        }
+
+        Ref<RefCountedT> existing = TryGetRef(*iter);
+        if (existing != nullptr) {
+            return {std::move(existing), false};
+        }
+
+        // The cached object is being destroyed and will call Erase() later. Replace it with
+        // |object| so that the Erase() of the dying object becomes a no-op.
+        shard.set.erase(iter);
+        shard.set.insert(object);
+        return {object, true};
+    }
+
+    // Removes |object| from the cache. Returns false if it wasn't found, which can happen if it
+    // was replaced by an equal object after its refcount dropped to zero.
+    bool Erase(RefCountedT* object) {
+        Shard& shard = GetShard(object);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.set.find(object);
+        if (iter == shard.set.end() || *iter != static_cast<BlueprintT*>(object)) {
+            return false;
+        }
+        shard.set.erase(iter);
+        return true;
+    }
+
+    bool Empty() {
+        for (Shard& shard : mShards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            if (!shard.set.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    using Set = std::unordered_set<BlueprintT*,
+                                   typename BlueprintT::HashFunc,
+                                   typename BlueprintT::EqualityFunc>;
+
+    // Shards are aligned to avoid false sharing of their locks between cores.
+    struct alignas(64) Shard {
+        std::shared_mutex mutex;
+        Set set;
+    };
+
+    Shard& GetShard(const BlueprintT* blueprint) {
+        size_t hash = typename BlueprintT::HashFunc()(blueprint);
+        // Mix the high bits in since content hashes are often combined with multiplications that
+        // leave the low bits poorly distributed.
+        hash ^= hash >> 17;
+        return mShards[hash % kShardCount];
+    }
+
+    static Ref<RefCountedT> TryGetRef(BlueprintT* cached) {
+        RefCountedT* object = static_cast<RefCountedT*>(cached);
+        if (!object->TryReference()) {
+            return nullptr;
+        }
+        return AcquireRef(object);
+    }
+
+    std::array<Shard, kShardCount> mShards;
+};
+
+}  // namespace dawn
+
+#endif  // SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
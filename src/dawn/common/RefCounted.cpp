@@ -54,6 +54,19 @@ void RefCount::Increment() {
     mRefCount.fetch_add(kRefCountIncrement, std::memory_order_relaxed);
 }
 
+bool RefCount::TryIncrement() {
+    uint64_t current = mRefCount.load(std::memory_order_relaxed);
+    do {
+        if ((current & ~kPayloadMask) == 0) {
+            return false;
+        }
+        // Relaxed ordering is enough on success for the same reason as in Increment(): the
+        // caller synchronizes with the destruction of the object through the cache lock.
+    } while (!mRefCount.compare_exchange_weak(current, current + kRefCountIncrement,
+                                              std::memory_order_relaxed));
+    return true;
+}
+
 bool RefCount::Decrement() {
     ASSERT((mRefCount & ~kPayloadMask) != 0);
 
@@ -102,6 +115,10 @@ void RefCounted::Reference() {
     mRefCount.Increment();
 }
 
+bool RefCounted::TryReference() {
+    return mRefCount.TryIncrement();
+}
+
 void RefCounted::Release() {
     if (mRefCount.Decrement()) {
         DeleteThis();
@@ -31,6 +31,10 @@ class RefCount {
     // Add a reference.
     void Increment();
 
+    // Tries to add a reference. Returns false if the refcount already reached zero, in which
+    // case the object is being destroyed and must not be resurrected.
+    bool TryIncrement();
+
     // Remove a reference. Returns true if this was the last reference.
     bool Decrement();
 
@@ -46,6 +50,9 @@ class RefCounted {
     uint64_t GetRefCountPayload() const;
 
     void Reference();
+    // Like Reference() but fails and returns false if the object is being destroyed. This is
+    // used by caches that hold raw pointers to objects that remove themselves on destruction.
+    bool TryReference();
     // Release() is called by internal code, so it's assumed that there is already a thread
     // synchronization in place for destruction.
     void Release();
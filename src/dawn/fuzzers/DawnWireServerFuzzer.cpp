@@ -128,6 +128,8 @@ int DawnWireServerFuzzer::Run(const uint8_t* data,
     dawn::wire::WireServerDescriptor serverDesc = {};
     serverDesc.procs = &procs;
     serverDesc.serializer = &devNull;
+    // Also fuzz the decoding of the packed render pass commands.
+    serverDesc.acceptCompactEncoding = true;
 
     std::unique_ptr<dawn::wire::WireServer> wireServer(new dawn_wire::WireServer(serverDesc));
     wireServer->InjectInstance(sInstance->Get(), 1, 0);
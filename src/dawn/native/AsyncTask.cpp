@@ -20,14 +20,83 @@
 
 namespace dawn::native {
 
+AsyncTaskHandle::AsyncTaskHandle(AsyncTaskManager* taskManager,
+                                 AsyncTask asyncTask,
+                                 AsyncTask cancelTask)
+    : mTaskManager(taskManager),
+      mAsyncTask(std::move(asyncTask)),
+      mCancelTask(std::move(cancelTask)) {}
+
+AsyncTaskHandle::~AsyncTaskHandle() = default;
+
+bool AsyncTaskHandle::TryStart() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mState != State::Pending) {
+        return false;
+    }
+    mState = State::Running;
+    return true;
+}
+
+void AsyncTaskHandle::RunAndComplete() {
+    mAsyncTask();
+
+    // Release what the task captured now instead of when the last reference to the handle is
+    // dropped, which may happen after the device is destroyed.
+    mAsyncTask = nullptr;
+    mCancelTask = nullptr;
+    mTaskManager->HandleTaskCompletion(this);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mState = State::Done;
+    }
+    mCondition.notify_all();
+}
+
+bool AsyncTaskHandle::Cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mState != State::Pending) {
+            return false;
+        }
+        mState = State::Cancelled;
+    }
+
+    // The worker thread will skip the task since it isn't pending anymore, and no other thread
+    // touches the task functions after that.
+    AsyncTask cancelTask = std::move(mCancelTask);
+    mAsyncTask = nullptr;
+    mCancelTask = nullptr;
+    if (cancelTask) {
+        cancelTask();
+    }
+    mTaskManager->HandleTaskCompletion(this);
+    return true;
+}
+
+void AsyncTaskHandle::RunNow() {
+    if (TryStart()) {
+        RunAndComplete();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mState == State::Done || mState == State::Cancelled; });
+}
+
+bool AsyncTaskHandle::IsDone() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mState == State::Done || mState == State::Cancelled;
+}
+
 AsyncTaskManager::AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool)
     : mWorkerTaskPool(workerTaskPool) {}
 
-void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
+Ref<AsyncTaskHandle> AsyncTaskManager::PostTask(AsyncTask asyncTask, AsyncTask cancelTask) {
     // If these allocations becomes expensive, we can slab-allocate tasks.
-    Ref<WaitableTask> waitableTask = AcquireRef(new WaitableTask());
-    waitableTask->taskManager = this;
-    waitableTask->asyncTask = std::move(asyncTask);
+    Ref<AsyncTaskHandle> waitableTask =
+        AcquireRef(new AsyncTaskHandle(this, std::move(asyncTask), std::move(cancelTask)));
 
     {
         // We insert new waitableTask objects into mPendingTasks in main thread (PostTask()),
@@ -41,11 +110,17 @@ void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
     // Ref the task since it is accessed inside the worker function.
     // The worker function will acquire and release the task upon completion.
     waitableTask->Reference();
-    waitableTask->waitableEvent =
+    std::unique_ptr<dawn::platform::WaitableEvent> waitableEvent =
         mWorkerTaskPool->PostWorkerTask(DoWaitableTask, waitableTask.Get());
+    {
+        std::lock_guard<std::mutex> lock(waitableTask->mMutex);
+        waitableTask->mWaitableEvent = std::move(waitableEvent);
+    }
+
+    return waitableTask;
 }
 
-void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
+void AsyncTaskManager::HandleTaskCompletion(AsyncTaskHandle* task) {
     std::lock_guard<std::mutex> lock(mPendingTasksMutex);
     auto iter = mPendingTasks.find(task);
     if (iter != mPendingTasks.end()) {
@@ -54,15 +129,33 @@ void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
 }
 
 void AsyncTaskManager::WaitAllPendingTasks() {
-    std::unordered_map<WaitableTask*, Ref<WaitableTask>> allPendingTasks;
+    std::unordered_map<AsyncTaskHandle*, Ref<AsyncTaskHandle>> allPendingTasks;
 
     {
         std::lock_guard<std::mutex> lock(mPendingTasksMutex);
         allPendingTasks.swap(mPendingTasks);
     }
 
+    // Steal the tasks that haven't started yet instead of waiting for a worker to be available.
     for (auto& [_, task] : allPendingTasks) {
-        task->waitableEvent->Wait();
+        task->RunNow();
+    }
+}
+
+void AsyncTaskManager::CancelAllPendingTasks() {
+    std::unordered_map<AsyncTaskHandle*, Ref<AsyncTaskHandle>> allPendingTasks;
+
+    {
+        std::lock_guard<std::mutex> lock(mPendingTasksMutex);
+        allPendingTasks.swap(mPendingTasks);
+    }
+
+    for (auto& [_, task] : allPendingTasks) {
+        task->Cancel();
+    }
+    // Wait for the tasks that were already running.
+    for (auto& [_, task] : allPendingTasks) {
+        task->RunNow();
     }
 }
 
@@ -72,13 +165,12 @@ bool AsyncTaskManager::HasPendingTasks() {
 }
 
 void AsyncTaskManager::DoWaitableTask(void* task) {
-    Ref<WaitableTask> waitableTask = AcquireRef(static_cast<WaitableTask*>(task));
-    waitableTask->asyncTask();
-    waitableTask->taskManager->HandleTaskCompletion(waitableTask.Get());
+    Ref<AsyncTaskHandle> waitableTask = AcquireRef(static_cast<AsyncTaskHandle*>(task));
+    // The task may have been cancelled or stolen by another thread in the meantime. In that case
+    // it must not touch the task manager, which may already be destroyed.
+    if (waitableTask->TryStart()) {
+        waitableTask->RunAndComplete();
+    }
 }
 
-AsyncTaskManager::WaitableTask::WaitableTask() = default;
-
-AsyncTaskManager::WaitableTask::~WaitableTask() = default;
-
 }  // namespace dawn::native
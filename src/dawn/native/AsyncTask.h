@@ -15,6 +15,7 @@
 #ifndef SRC_DAWN_NATIVE_ASYNCTASK_H_
 #define SRC_DAWN_NATIVE_ASYNCTASK_H_
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,37 +30,78 @@ class WorkerTaskPool;
 
 namespace dawn::native {
 
-// TODO(crbug.com/dawn/826): we'll add additional things to AsyncTask in the future, like
-// Cancel() and RunNow(). Cancelling helps avoid running the task's body when we are just
-// shutting down the device. RunNow() could be used for more advanced scenarios, for example
-// always doing ShaderModule initial compilation asynchronously, but being able to steal the
-// task if we need it for synchronous pipeline compilation.
 using AsyncTask = std::function<void()>;
 
+class AsyncTaskManager;
+
+// A handle on a task posted to the AsyncTaskManager. A task that hasn't started running on a
+// worker thread yet can either be cancelled, in which case its body never runs, or be stolen with
+// RunNow() and run on the calling thread, for example when the result of an asynchronous pipeline
+// compilation is needed synchronously.
+class AsyncTaskHandle : public RefCounted {
+  public:
+    ~AsyncTaskHandle() override;
+
+    // Prevents the task from running if it hasn't started yet and calls its cancellation callback
+    // instead. Returns true if the task was cancelled.
+    bool Cancel();
+
+    // Runs the task on the calling thread if it hasn't started yet, otherwise waits for it to
+    // complete. Does nothing if the task was cancelled.
+    void RunNow();
+
+    bool IsDone();
+
+  private:
+    friend class AsyncTaskManager;
+
+    enum class State {
+        Pending,
+        Running,
+        Done,
+        Cancelled,
+    };
+
+    AsyncTaskHandle(AsyncTaskManager* taskManager, AsyncTask asyncTask, AsyncTask cancelTask);
+
+    // Transitions the task from Pending to Running. Returns false if it was already taken by
+    // another thread or cancelled.
+    bool TryStart();
+    void RunAndComplete();
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    State mState = State::Pending;
+
+    AsyncTaskManager* mTaskManager;
+    AsyncTask mAsyncTask;
+    AsyncTask mCancelTask;
+    std::unique_ptr<dawn::platform::WaitableEvent> mWaitableEvent;
+};
+
 class AsyncTaskManager {
   public:
     explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
 
-    void PostTask(AsyncTask asyncTask);
+    // Posts |asyncTask| to the worker task pool. If the task is cancelled before it starts,
+    // |cancelTask| is called on the cancelling thread instead.
+    Ref<AsyncTaskHandle> PostTask(AsyncTask asyncTask, AsyncTask cancelTask = nullptr);
+
+    // Waits for all the pending tasks to complete. Tasks that haven't started yet are run on the
+    // calling thread instead of waiting for a worker to pick them up.
     void WaitAllPendingTasks();
+    // Cancels all the tasks that haven't started yet and waits for the ones that are running.
+    void CancelAllPendingTasks();
     bool HasPendingTasks();
 
   private:
-    class WaitableTask : public RefCounted {
-      public:
-        WaitableTask();
-        ~WaitableTask() override;
-
-        AsyncTask asyncTask;
-        AsyncTaskManager* taskManager;
-        std::unique_ptr<dawn::platform::WaitableEvent> waitableEvent;
-    };
+    friend class AsyncTaskHandle;
 
     static void DoWaitableTask(void* task);
-    void HandleTaskCompletion(WaitableTask* task);
+    void HandleTaskCompletion(AsyncTaskHandle* task);
 
     std::mutex mPendingTasksMutex;
-    std::unordered_map<WaitableTask*, Ref<WaitableTask>> mPendingTasks;
+    std::unordered_map<AsyncTaskHandle*, Ref<AsyncTaskHandle>> mPendingTasks;
     dawn::platform::WorkerTaskPool* mWorkerTaskPool;
 };
 
@@ -15,24 +15,67 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/CacheKey.h"
 #include "dawn/native/Instance.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native {
 
-BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface)
-    : mCache(cachingInterface) {}
+namespace {
+
+// Store blocks when more than this many bytes are queued for asynchronous stores, unless the queue
+// is empty.
+constexpr uint64_t kMaxQueuedBytes = 64 * 1024 * 1024;
+
+}  // anonymous namespace
+
+BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface,
+                     dawn::platform::Platform* platform,
+                     bool asyncStores)
+    : mCache(cachingInterface), mPlatform(platform), mAsyncStores(asyncStores) {}
+
+BlobCache::~BlobCache() {
+    {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        mStopWriterThread = true;
+    }
+    mQueueCondition.notify_all();
+    // The writer thread writes the remaining stores before exiting.
+    if (mWriterThread.joinable()) {
+        mWriterThread.join();
+    }
+}
 
 Blob BlobCache::Load(const CacheKey& key) {
+    if (mAsyncStores) {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        // mQueuedStores contains more recent values than mWritingStores.
+        for (const auto* stores : {&mQueuedStores, &mWritingStores}) {
+            auto it = stores->find(key);
+            if (it != stores->end()) {
+                Blob result = CreateBlob(it->second.Size());
+                memcpy(result.Data(), it->second.Data(), it->second.Size());
+                return result;
+            }
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
     return LoadInternal(key);
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
+    if (mAsyncStores) {
+        EnqueueStore(key, valueSize, value);
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
     StoreInternal(key, valueSize, value);
 }
@@ -41,6 +84,96 @@ void BlobCache::Store(const CacheKey& key, const Blob& value) {
     Store(key, value.Size(), value.Data());
 }
 
+void BlobCache::Flush() {
+    std::unique_lock<std::mutex> lock(mQueueMutex);
+    mQueueCondition.wait(lock,
+                         [this] { return mQueuedStores.empty() && mWritingStores.empty(); });
+}
+
+size_t BlobCache::GetQueuedStoreCount() {
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    return mQueuedStores.size() + mWritingStores.size();
+}
+
+uint64_t BlobCache::GetBytesWritten() {
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    return mBytesWritten;
+}
+
+void BlobCache::EnqueueStore(const CacheKey& key, size_t valueSize, const void* value) {
+    ASSERT(ValidateCacheKey(key));
+    ASSERT(value != nullptr);
+    ASSERT(valueSize > 0);
+    if (mCache == nullptr) {
+        return;
+    }
+
+    // Copy the value before taking the lock.
+    Blob blob = CreateBlob(valueSize);
+    memcpy(blob.Data(), value, valueSize);
+
+    std::unique_lock<std::mutex> lock(mQueueMutex);
+    mQueueCondition.wait(lock, [&] {
+        return mQueuedBytes == 0 || mQueuedBytes + valueSize <= kMaxQueuedBytes;
+    });
+
+    // Replace the value of the key if it is already queued, so that only the latest one is written.
+    auto [it, inserted] = mQueuedStores.try_emplace(key, Blob());
+    if (!inserted) {
+        mQueuedBytes -= it->second.Size();
+    }
+    it->second = std::move(blob);
+    mQueuedBytes += valueSize;
+    ReportMetrics();
+
+    if (!mWriterThread.joinable()) {
+        mWriterThread = std::thread([this] { WriterThreadLoop(); });
+    }
+    lock.unlock();
+    mQueueCondition.notify_all();
+}
+
+void BlobCache::WriterThreadLoop() {
+    std::unique_lock<std::mutex> lock(mQueueMutex);
+    while (true) {
+        mQueueCondition.wait(lock, [this] { return mStopWriterThread || !mQueuedStores.empty(); });
+        if (mQueuedStores.empty()) {
+            ASSERT(mStopWriterThread);
+            return;
+        }
+
+        // Take all the queued stores and write them as a single batch.
+        ASSERT(mWritingStores.empty());
+        std::swap(mWritingStores, mQueuedStores);
+        lock.unlock();
+
+        uint64_t batchBytes = 0;
+        {
+            std::lock_guard<std::mutex> cacheLock(mMutex);
+            for (const auto& [key, value] : mWritingStores) {
+                mCache->StoreData(key.data(), key.size(), value.Data(), value.Size());
+                batchBytes += value.Size();
+            }
+        }
+
+        lock.lock();
+        mWritingStores.clear();
+        mQueuedBytes -= batchBytes;
+        mBytesWritten += batchBytes;
+        ReportMetrics();
+        mQueueCondition.notify_all();
+    }
+}
+
+void BlobCache::ReportMetrics() {
+    if (mPlatform == nullptr) {
+        return;
+    }
+    TRACE_COUNTER1(mPlatform, General, "BlobCache::QueuedStores",
+                   mQueuedStores.size() + mWritingStores.size());
+    TRACE_COUNTER1(mPlatform, General, "BlobCache::KilobytesWritten", mBytesWritten / 1024);
+}
+
 Blob BlobCache::LoadInternal(const CacheKey& key) {
     ASSERT(ValidateCacheKey(key));
     if (mCache == nullptr) {
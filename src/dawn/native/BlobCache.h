@@ -15,7 +15,11 @@
 #ifndef SRC_DAWN_NATIVE_BLOBCACHE_H_
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
+#include <condition_variable>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
@@ -23,6 +27,7 @@
 
 namespace dawn::platform {
 class CachingInterface;
+class Platform;
 }
 
 namespace dawn::native {
@@ -32,9 +37,17 @@ class InstanceBase;
 
 // This class should always be thread-safe because it may be called asynchronously. Its purpose
 // is to wrap the CachingInterface provided via a platform.
+// With asynchronous stores, Store copies the value into a queue that a writer thread stores in the
+// CachingInterface in batches. Successive stores of the same key only write the latest value, and
+// Store blocks while too many bytes are queued. Load returns the queued values that aren't written
+// yet.
 class BlobCache {
   public:
-    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr);
+    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr,
+                       dawn::platform::Platform* platform = nullptr,
+                       bool asyncStores = false);
+    // Writes the queued stores before returning.
+    ~BlobCache();
 
     // Returns empty blob if the key is not found in the cache.
     Blob Load(const CacheKey& key);
@@ -43,6 +56,13 @@ class BlobCache {
     void Store(const CacheKey& key, size_t valueSize, const void* value);
     void Store(const CacheKey& key, const Blob& value);
 
+    // Waits until all the queued stores are written to the CachingInterface.
+    void Flush();
+
+    // Metrics for asynchronous stores, which are also reported as trace counters.
+    size_t GetQueuedStoreCount();
+    uint64_t GetBytesWritten();
+
     // Store a CacheResult into the cache if it isn't cached yet.
     // Calls T::ToBlob which should be defined elsewhere.
     template <typename T>
@@ -62,9 +82,31 @@ class BlobCache {
     // that the cache key contains the dawn version string in it.
     bool ValidateCacheKey(const CacheKey& key);
 
+    void EnqueueStore(const CacheKey& key, size_t valueSize, const void* value);
+    void WriterThreadLoop();
+    // Must be called with mQueueMutex held.
+    void ReportMetrics();
+
     // Protects thread safety of access to mCache.
     std::mutex mMutex;
     dawn::platform::CachingInterface* mCache;
+
+    dawn::platform::Platform* mPlatform;
+    const bool mAsyncStores;
+
+    // Protects the members below, that are used for asynchronous stores.
+    std::mutex mQueueMutex;
+    std::condition_variable mQueueCondition;
+    // The stores queued since the writer thread took the current batch.
+    std::map<std::vector<uint8_t>, Blob> mQueuedStores;
+    // The batch of stores being written by the writer thread. It is only modified with
+    // mQueueMutex held, so it can be read by Load while the writer thread writes it.
+    std::map<std::vector<uint8_t>, Blob> mWritingStores;
+    // The size of the values in mQueuedStores and mWritingStores.
+    uint64_t mQueuedBytes = 0;
+    uint64_t mBytesWritten = 0;
+    bool mStopWriterThread = false;
+    std::thread mWriterThread;
 };
 
 }  // namespace dawn::native
@@ -21,9 +21,25 @@
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Math.h"
+#include "dawn/native/CommandBlockPool.h"
 
 namespace dawn::native {
 
+namespace {
+
+void FreeBlocks(CommandBlockPool* blockPool, CommandBlocks* blocks) {
+    for (BlockDef& block : *blocks) {
+        if (blockPool != nullptr) {
+            blockPool->Release(block.block, block.size);
+        } else {
+            free(block.block);
+        }
+    }
+    blocks->clear();
+}
+
+}  // anonymous namespace
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -34,7 +50,7 @@ CommandIterator::~CommandIterator() {
     ASSERT(IsEmpty());
 }
 
-CommandIterator::CommandIterator(CommandIterator&& other) {
+CommandIterator::CommandIterator(CommandIterator&& other) : mBlockPool(other.mBlockPool) {
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
         other.Reset();
@@ -44,6 +60,7 @@ CommandIterator::CommandIterator(CommandIterator&& other) {
 
 CommandIterator& CommandIterator::operator=(CommandIterator&& other) {
     ASSERT(IsEmpty());
+    mBlockPool = other.mBlockPool;
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
         other.Reset();
@@ -52,7 +69,8 @@ CommandIterator& CommandIterator::operator=(CommandIterator&& other) {
     return *this;
 }
 
-CommandIterator::CommandIterator(CommandAllocator allocator) : mBlocks(allocator.AcquireBlocks()) {
+CommandIterator::CommandIterator(CommandAllocator allocator)
+    : mBlocks(allocator.AcquireBlocks()), mBlockPool(allocator.mBlockPool) {
     Reset();
 }
 
@@ -60,6 +78,9 @@ void CommandIterator::AcquireCommandBlocks(std::vector<CommandAllocator> allocat
     ASSERT(IsEmpty());
     mBlocks.clear();
     for (CommandAllocator& allocator : allocators) {
+        // All the allocators of an encoder use the block pool of its device.
+        ASSERT(mBlocks.empty() || mBlockPool == allocator.mBlockPool);
+        mBlockPool = allocator.mBlockPool;
         CommandBlocks blocks = allocator.AcquireBlocks();
         if (!blocks.empty()) {
             mBlocks.reserve(mBlocks.size() + blocks.size());
@@ -102,10 +123,7 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
         return;
     }
 
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
-    }
-    mBlocks.clear();
+    FreeBlocks(mBlockPool, &mBlocks);
     Reset();
     ASSERT(IsEmpty());
 }
@@ -128,12 +146,18 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* blockPool) : mBlockPool(blockPool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mBlockPool(other.mBlockPool),
+      mLastAllocationSize(other.mLastAllocationSize) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -146,6 +170,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mBlockPool = other.mBlockPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -157,10 +182,7 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 }
 
 void CommandAllocator::Reset() {
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
-    }
-    mBlocks.clear();
+    FreeBlocks(mBlockPool, &mBlocks);
     mLastAllocationSize = kDefaultBaseAllocationSize;
     ResetPointers();
 }
@@ -205,12 +227,19 @@ uint8_t* CommandAllocator::AllocateInNewBlock(uint32_t commandId,
 
 bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
-    mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
+    size_t blockSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
 
-    uint8_t* block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    uint8_t* block;
+    if (mBlockPool != nullptr) {
+        // The pool rounds the size up to its size classes.
+        block = mBlockPool->Acquire(blockSize, &blockSize);
+    } else {
+        block = static_cast<uint8_t*>(malloc(blockSize));
+    }
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
+    mLastAllocationSize = blockSize;
 
     mBlocks.push_back({mLastAllocationSize, block});
     mCurrentPtr = AlignPtr(block, alignof(uint32_t));
@@ -53,6 +53,10 @@ namespace dawn::native {
 // and must tell the CommandIterator when the allocated commands have been processed for
 // deletion.
 
+// The blocks can come from a CommandBlockPool shared by all the encoders of a device, in which
+// case they are given back to it instead of being freed. The pool must outlive the allocators
+// and iterators that use it.
+
 // These are the lists of blocks, should not be used directly, only through CommandAllocator
 // and CommandIterator
 struct BlockDef {
@@ -67,6 +71,7 @@ constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
 }  // namespace detail
 
 class CommandAllocator;
+class CommandBlockPool;
 
 class CommandIterator : public NonCopyable {
   public:
@@ -141,6 +146,7 @@ class CommandIterator : public NonCopyable {
     }
 
     CommandBlocks mBlocks;
+    CommandBlockPool* mBlockPool = nullptr;
     uint8_t* mCurrentPtr = nullptr;
     size_t mCurrentBlock = 0;
     // Used to avoid a special case for empty iterators.
@@ -150,9 +156,11 @@ class CommandIterator : public NonCopyable {
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    explicit CommandAllocator(CommandBlockPool* blockPool);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state and keeps its
+    // CommandBlockPool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
@@ -253,6 +261,7 @@ class CommandAllocator : public NonCopyable {
     void ResetPointers();
 
     CommandBlocks mBlocks;
+    CommandBlockPool* mBlockPool = nullptr;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
 
     // Data used for the block range at initialization so that the first call to Allocate sees
@@ -0,0 +1,181 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/CommandBlockPool.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+namespace {
+
+void UpdateHighWaterMark(std::atomic<size_t>* highWaterMark, size_t value) {
+    size_t current = highWaterMark->load(std::memory_order_relaxed);
+    while (value > current &&
+           !highWaterMark->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+}  // anonymous namespace
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() {
+    for (SizeClass& sizeClass : mSizeClasses) {
+        ASSERT(sizeClass.inUseCount == 0);
+        for (uint8_t* block : sizeClass.freeBlocks) {
+            free(block);
+        }
+    }
+}
+
+// static
+size_t CommandBlockPool::GetSizeClassIndex(size_t size) {
+    ASSERT(size <= kMaxPooledBlockSize);
+    size_t index = 0;
+    while ((kMinBlockSize << index) < size) {
+        index++;
+    }
+    return index;
+}
+
+uint8_t* CommandBlockPool::Acquire(size_t minimumSize, size_t* size) {
+    if (minimumSize > kMaxPooledBlockSize) {
+        uint8_t* block = static_cast<uint8_t*>(malloc(minimumSize));
+        if (DAWN_UNLIKELY(block == nullptr)) {
+            return nullptr;
+        }
+        mAllocatedBlockCount.fetch_add(1, std::memory_order_relaxed);
+        AddInUseBytes(minimumSize);
+        *size = minimumSize;
+        return block;
+    }
+
+    size_t index = GetSizeClassIndex(minimumSize);
+    size_t blockSize = kMinBlockSize << index;
+    SizeClass& sizeClass = mSizeClasses[index];
+
+    uint8_t* block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (!sizeClass.freeBlocks.empty()) {
+            block = sizeClass.freeBlocks.back();
+            sizeClass.freeBlocks.pop_back();
+            // Cached bytes are updated with the free list so that they never underflow.
+            mCachedBytes.fetch_sub(blockSize, std::memory_order_relaxed);
+        }
+        sizeClass.inUseCount++;
+        sizeClass.peakInUseCount = std::max(sizeClass.peakInUseCount, sizeClass.inUseCount);
+    }
+
+    if (block != nullptr) {
+        mReusedBlockCount.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        block = static_cast<uint8_t*>(malloc(blockSize));
+        if (DAWN_UNLIKELY(block == nullptr)) {
+            std::lock_guard<std::mutex> lock(sizeClass.mutex);
+            sizeClass.inUseCount--;
+            return nullptr;
+        }
+        mAllocatedBlockCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    AddInUseBytes(blockSize);
+    *size = blockSize;
+    return block;
+}
+
+void CommandBlockPool::Release(uint8_t* block, size_t size) {
+    ASSERT(block != nullptr);
+    mInUseBytes.fetch_sub(size, std::memory_order_relaxed);
+
+    if (size > kMaxPooledBlockSize) {
+        free(block);
+        return;
+    }
+
+    size_t index = GetSizeClassIndex(size);
+    ASSERT(size == kMinBlockSize << index);
+    SizeClass& sizeClass = mSizeClasses[index];
+
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        ASSERT(sizeClass.inUseCount > 0);
+        sizeClass.inUseCount--;
+        if (mCachedBytes.load(std::memory_order_relaxed) + size <= kMaxCachedBytes) {
+            sizeClass.freeBlocks.push_back(block);
+            AddCachedBytes(size);
+            cached = true;
+        }
+    }
+
+    if (!cached) {
+        free(block);
+    }
+}
+
+void CommandBlockPool::Trim() {
+    std::vector<uint8_t*> blocksToFree;
+    for (size_t index = 0; index < kSizeClassCount; ++index) {
+        SizeClass& sizeClass = mSizeClasses[index];
+        {
+            std::lock_guard<std::mutex> lock(sizeClass.mutex);
+            // Keep enough free blocks to reach the peak usage since the last trim again without
+            // allocating, and free half of the others.
+            size_t neededCount = sizeClass.peakInUseCount - sizeClass.inUseCount;
+            size_t freeCount = sizeClass.freeBlocks.size();
+            if (freeCount > neededCount) {
+                size_t trimCount = (freeCount - neededCount + 1) / 2;
+                blocksToFree.insert(blocksToFree.end(), sizeClass.freeBlocks.end() - trimCount,
+                                    sizeClass.freeBlocks.end());
+                sizeClass.freeBlocks.resize(freeCount - trimCount);
+                mCachedBytes.fetch_sub(trimCount * (kMinBlockSize << index),
+                                       std::memory_order_relaxed);
+            }
+            sizeClass.peakInUseCount = sizeClass.inUseCount;
+        }
+
+        for (uint8_t* block : blocksToFree) {
+            free(block);
+        }
+        blocksToFree.clear();
+    }
+}
+
+CommandBlockPoolStats CommandBlockPool::GetStats() const {
+    CommandBlockPoolStats stats;
+    stats.inUseBytes = mInUseBytes.load(std::memory_order_relaxed);
+    stats.cachedBytes = mCachedBytes.load(std::memory_order_relaxed);
+    stats.inUseHighWaterMarkBytes = mInUseHighWaterMarkBytes.load(std::memory_order_relaxed);
+    stats.cachedHighWaterMarkBytes = mCachedHighWaterMarkBytes.load(std::memory_order_relaxed);
+    stats.allocatedBlockCount = mAllocatedBlockCount.load(std::memory_order_relaxed);
+    stats.reusedBlockCount = mReusedBlockCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void CommandBlockPool::AddInUseBytes(size_t size) {
+    size_t inUseBytes = mInUseBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    UpdateHighWaterMark(&mInUseHighWaterMarkBytes, inUseBytes);
+}
+
+void CommandBlockPool::AddCachedBytes(size_t size) {
+    size_t cachedBytes = mCachedBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    UpdateHighWaterMark(&mCachedHighWaterMarkBytes, cachedBytes);
+}
+
+}  // namespace dawn::native
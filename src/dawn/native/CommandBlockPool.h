@@ -0,0 +1,99 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_COMMANDBLOCKPOOL_H_
+#define SRC_DAWN_NATIVE_COMMANDBLOCKPOOL_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "dawn/common/NonCopyable.h"
+
+namespace dawn::native {
+
+struct CommandBlockPoolStats {
+    // Bytes of the blocks currently used by command allocators and iterators.
+    size_t inUseBytes = 0;
+    // Bytes of the free blocks kept for reuse.
+    size_t cachedBytes = 0;
+    size_t inUseHighWaterMarkBytes = 0;
+    size_t cachedHighWaterMarkBytes = 0;
+    // Number of blocks that had to be allocated from the heap.
+    uint64_t allocatedBlockCount = 0;
+    // Number of blocks that were reused from the pool.
+    uint64_t reusedBlockCount = 0;
+};
+
+// A thread-safe pool of the memory blocks used by CommandAllocator, shared by all the command
+// encoders of a device. Blocks are rounded up to power-of-two size classes and freed blocks are
+// kept in a free list per size class so that recording the commands of the next frame doesn't
+// need to go through the heap allocator. Blocks larger than the largest size class aren't pooled.
+//
+// Trim() is called periodically and frees the blocks that weren't needed to reach the peak usage
+// since the previous call, half of them at a time so that the pool shrinks progressively when
+// fewer commands are recorded.
+class CommandBlockPool : public NonCopyable {
+  public:
+    static constexpr size_t kMinBlockSize = 4096;
+    static constexpr size_t kMaxPooledBlockSize = 65536;
+    // The pool never caches more than this many bytes of free blocks.
+    static constexpr size_t kMaxCachedBytes = 8 * 1024 * 1024;
+
+    CommandBlockPool();
+    ~CommandBlockPool();
+
+    // Returns a block of at least |minimumSize| bytes and sets |size| to its actual size, or
+    // nullptr if the allocation failed.
+    uint8_t* Acquire(size_t minimumSize, size_t* size);
+    // Gives back a block returned by Acquire() along with its actual size.
+    void Release(uint8_t* block, size_t size);
+
+    void Trim();
+
+    CommandBlockPoolStats GetStats() const;
+
+  private:
+    static constexpr size_t kSizeClassCount = 5;
+    static_assert(kMinBlockSize << (kSizeClassCount - 1) == kMaxPooledBlockSize);
+
+    struct alignas(64) SizeClass {
+        std::mutex mutex;
+        std::vector<uint8_t*> freeBlocks;
+        size_t inUseCount = 0;
+        // The maximum of inUseCount since the last Trim().
+        size_t peakInUseCount = 0;
+    };
+
+    static size_t GetSizeClassIndex(size_t size);
+
+    void AddInUseBytes(size_t size);
+    void AddCachedBytes(size_t size);
+
+    std::array<SizeClass, kSizeClassCount> mSizeClasses;
+
+    std::atomic<size_t> mInUseBytes{0};
+    std::atomic<size_t> mCachedBytes{0};
+    std::atomic<size_t> mInUseHighWaterMarkBytes{0};
+    std::atomic<size_t> mCachedHighWaterMarkBytes{0};
+    std::atomic<uint64_t> mAllocatedBlockCount{0};
+    std::atomic<uint64_t> mReusedBlockCount{0};
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_COMMANDBLOCKPOOL_H_
@@ -14,6 +14,8 @@
 
 #include "dawn/native/CommandBufferStateTracker.h"
 
+#include <algorithm>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -54,6 +56,33 @@ std::optional<uint32_t> FindFirstUndersizedBuffer(
     return std::nullopt;
 }
 
+// Returns the largest stride count (first + count) of the vertices or instances that the buffers
+// bound to the |slots| of |pipeline| can hold.
+uint64_t ComputeMaxStrideCount(
+    const RenderPipelineBase* pipeline,
+    const ityp::bitset<VertexBufferSlot, kMaxVertexBuffers>& slots,
+    const ityp::array<VertexBufferSlot, uint64_t, kMaxVertexBuffers>& bufferSizes) {
+    uint64_t maxStrideCount = std::numeric_limits<uint64_t>::max();
+    for (VertexBufferSlot slot : IterateBitSet(slots)) {
+        const VertexBufferInfo& vertexBuffer = pipeline->GetVertexBuffer(slot);
+        uint64_t bufferSize = bufferSizes[slot];
+        if (vertexBuffer.arrayStride == 0) {
+            if (vertexBuffer.usedBytesInStride > bufferSize) {
+                return 0;
+            }
+        } else {
+            // (strideCount - 1) * arrayStride + lastStride <= bufferSize
+            if (vertexBuffer.lastStride > bufferSize) {
+                return 0;
+            }
+            maxStrideCount = std::min(
+                maxStrideCount,
+                (bufferSize - vertexBuffer.lastStride) / vertexBuffer.arrayStride + 1);
+        }
+    }
+    return maxStrideCount;
+}
+
 struct BufferAliasing {
     struct Entry {
         BindGroupIndex bindGroupIndex;
@@ -317,6 +346,14 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForVertexBuffer(uint3
         return {};
     }
 
+    if (mVertexBufferLimitsDirty) {
+        RecomputeVertexBufferLimits();
+    }
+    if (strideCount <= mMaxVertexStrideCount) {
+        return {};
+    }
+
+    // Find the vertex buffer that is too small to produce a detailed error.
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const ityp::bitset<VertexBufferSlot, kMaxVertexBuffers>& vertexBufferSlotsUsedAsVertexBuffer =
@@ -365,6 +402,14 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForInstanceBuffer(
         return {};
     }
 
+    if (mVertexBufferLimitsDirty) {
+        RecomputeVertexBufferLimits();
+    }
+    if (strideCount <= mMaxInstanceStrideCount) {
+        return {};
+    }
+
+    // Find the vertex buffer that is too small to produce a detailed error.
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const ityp::bitset<VertexBufferSlot, kMaxVertexBuffers>& vertexBufferSlotsUsedAsInstanceBuffer =
@@ -441,20 +486,22 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
     ASSERT((aspects & ~kLazyAspects).none());
 
     if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
-        bool matches = true;
-
-        for (BindGroupIndex i : IterateBitSet(mLastPipelineLayout->GetBindGroupLayoutsMask())) {
-            if (mBindgroups[i] == nullptr ||
-                mLastPipelineLayout->GetBindGroupLayout(i) != mBindgroups[i]->GetLayout() ||
-                FindFirstUndersizedBuffer(mBindgroups[i]->GetUnverifiedBufferSizes(),
-                                          (*mMinBufferSizes)[i])
-                    .has_value()) {
-                matches = false;
-                break;
+        const BindGroupLayoutMask& requiredBindGroups =
+            mLastPipelineLayout->GetBindGroupLayoutsMask();
+
+        for (BindGroupIndex i : IterateBitSet(requiredBindGroups & ~mCompatibleBindGroups)) {
+            if (mBindgroups[i] != nullptr &&
+                mLastPipelineLayout->GetBindGroupLayout(i) == mBindgroups[i]->GetLayout() &&
+                !FindFirstUndersizedBuffer(mBindgroups[i]->GetUnverifiedBufferSizes(),
+                                           (*mMinBufferSizes)[i])
+                     .has_value()) {
+                mCompatibleBindGroups.set(i);
             }
         }
 
-        if (matches) {
+        bool matches = IsSubset(requiredBindGroups, mCompatibleBindGroups);
+
+        if (matches && mLastPipelineLayout->HasPotentialWritableBindingAliasing()) {
             // Continue checking if there is writable storage buffer binding aliasing or not
             if (FindStorageBufferBindingAliasing<bool>(mLastPipelineLayout, mBindgroups,
                                                        mDynamicOffsets)) {
@@ -654,6 +701,7 @@ void CommandBufferStateTracker::SetBindGroup(BindGroupIndex index,
                                              const uint32_t* dynamicOffsets) {
     mBindgroups[index] = bindgroup;
     mDynamicOffsets[index].assign(dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
+    mCompatibleBindGroups.reset(index);
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
 }
 
@@ -666,12 +714,37 @@ void CommandBufferStateTracker::SetIndexBuffer(wgpu::IndexFormat format, uint64_
 void CommandBufferStateTracker::SetVertexBuffer(VertexBufferSlot slot, uint64_t size) {
     mVertexBufferSlotsUsed.set(slot);
     mVertexBufferSizes[slot] = size;
+    mVertexBufferLimitsDirty = true;
 }
 
 void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
+    // Setting the same pipeline again doesn't change the result of any validation.
+    if (pipeline != nullptr && pipeline == mLastPipeline) {
+        return;
+    }
+
+    PipelineLayoutBase* layout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
+    const RequiredBufferSizes* minBufferSizes =
+        pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
+
+    // The bind groups stay compatible if the new pipeline uses the same bind group layouts and
+    // minimum buffer sizes for them.
+    BindGroupLayoutMask compatibleBindGroups;
+    if (layout != nullptr && mLastPipelineLayout != nullptr) {
+        for (BindGroupIndex i :
+             IterateBitSet(mCompatibleBindGroups & layout->GetBindGroupLayoutsMask())) {
+            if (layout->GetBindGroupLayout(i) == mLastPipelineLayout->GetBindGroupLayout(i) &&
+                (*minBufferSizes)[i] == (*mMinBufferSizes)[i]) {
+                compatibleBindGroups.set(i);
+            }
+        }
+    }
+    mCompatibleBindGroups = compatibleBindGroups;
+
     mLastPipeline = pipeline;
-    mLastPipelineLayout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
-    mMinBufferSizes = pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
+    mLastPipelineLayout = layout;
+    mMinBufferSizes = minBufferSizes;
+    mVertexBufferLimitsDirty = true;
 
     mAspects.set(VALIDATION_ASPECT_PIPELINE);
 
@@ -679,6 +752,19 @@ void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
     mAspects &= ~kLazyAspects;
 }
 
+void CommandBufferStateTracker::RecomputeVertexBufferLimits() {
+    RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
+    mMaxVertexStrideCount =
+        ComputeMaxStrideCount(lastRenderPipeline,
+                              lastRenderPipeline->GetVertexBufferSlotsUsedAsVertexBuffer(),
+                              mVertexBufferSizes);
+    mMaxInstanceStrideCount =
+        ComputeMaxStrideCount(lastRenderPipeline,
+                              lastRenderPipeline->GetVertexBufferSlotsUsedAsInstanceBuffer(),
+                              mVertexBufferSizes);
+    mVertexBufferLimitsDirty = false;
+}
+
 BindGroupBase* CommandBufferStateTracker::GetBindGroup(BindGroupIndex index) const {
     return mBindgroups[index];
 }
@@ -23,6 +23,7 @@
 #include "dawn/native/BindingInfo.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
+#include "dawn/native/PipelineLayout.h"
 
 namespace dawn::native {
 
@@ -73,8 +74,12 @@ class CommandBufferStateTracker {
     MaybeError CheckMissingAspects(ValidationAspects aspects);
 
     void SetPipelineCommon(PipelineBase* pipeline);
+    void RecomputeVertexBufferLimits();
 
     ValidationAspects mAspects;
+    // The bind groups known to be compatible with the current pipeline. Only the other bind groups
+    // of the pipeline layout are validated again when the lazy bind groups aspect is recomputed.
+    BindGroupLayoutMask mCompatibleBindGroups;
 
     ityp::array<BindGroupIndex, BindGroupBase*, kMaxBindGroups> mBindgroups = {};
     ityp::array<BindGroupIndex, std::vector<uint32_t>, kMaxBindGroups> mDynamicOffsets = {};
@@ -84,6 +89,11 @@ class CommandBufferStateTracker {
     uint64_t mIndexBufferSize = 0;
 
     ityp::array<VertexBufferSlot, uint64_t, kMaxVertexBuffers> mVertexBufferSizes = {};
+    // The largest firstVertex + vertexCount and firstInstance + instanceCount that the bound vertex
+    // buffers can hold for the current render pipeline, recomputed lazily when either changes.
+    bool mVertexBufferLimitsDirty = true;
+    uint64_t mMaxVertexStrideCount = 0;
+    uint64_t mMaxInstanceStrideCount = 0;
 
     PipelineLayoutBase* mLastPipelineLayout = nullptr;
     PipelineBase* mLastPipeline = nullptr;
@@ -111,16 +111,23 @@ void CreateRenderPipelineAsyncCallbackTask::HandleDeviceLossImpl() {
 
 CreateComputePipelineAsyncTask::CreateComputePipelineAsyncTask(
     Ref<ComputePipelineBase> nonInitializedComputePipeline,
-    WGPUCreateComputePipelineAsyncCallback callback,
+    Callback callback,
     void* userdata)
-    : mComputePipeline(std::move(nonInitializedComputePipeline)),
-      mCallback(callback),
-      mUserdata(userdata) {
+    : mComputePipeline(std::move(nonInitializedComputePipeline)) {
     ASSERT(mComputePipeline != nullptr);
+    mCallbacks.emplace_back(callback, userdata);
 }
 
 CreateComputePipelineAsyncTask::~CreateComputePipelineAsyncTask() = default;
 
+ComputePipelineBase* CreateComputePipelineAsyncTask::GetPipeline() const {
+    return mComputePipeline.Get();
+}
+
+void CreateComputePipelineAsyncTask::AddCallback(Callback callback, void* userdata) {
+    mCallbacks.emplace_back(callback, userdata);
+}
+
 void CreateComputePipelineAsyncTask::Run() {
     const char* eventLabel = utils::GetLabelForTrace(mComputePipeline->GetLabel().c_str());
 
@@ -131,88 +138,176 @@ void CreateComputePipelineAsyncTask::Run() {
                  eventLabel);
 
     MaybeError maybeError = mComputePipeline->Initialize();
+
+    // No callback can be added once the task is unregistered.
+    device->GetInFlightComputePipelineTasks()->Remove(this);
+
     if (maybeError.IsError()) {
         std::unique_ptr<ErrorData> error = maybeError.AcquireError();
         WGPUCreatePipelineAsyncStatus status =
             CreatePipelineAsyncStatusFromErrorType(error->GetType());
-        device->GetCallbackTaskManager()->AddCallbackTask(
-            std::make_unique<CreateComputePipelineAsyncCallbackTask>(status, error->GetMessage(),
-                                                                     mCallback, mUserdata));
+        for (auto [callback, userdata] : mCallbacks) {
+            device->GetCallbackTaskManager()->AddCallbackTask(
+                std::make_unique<CreateComputePipelineAsyncCallbackTask>(
+                    status, error->GetMessage(), callback, userdata));
+        }
     } else {
-        device->AddComputePipelineAsyncCallbackTask(mComputePipeline, mCallback, mUserdata);
+        for (auto [callback, userdata] : mCallbacks) {
+            device->AddComputePipelineAsyncCallbackTask(mComputePipeline, callback, userdata);
+        }
+    }
+
+    // The task can run on a worker thread without the device lock. If an identical pipeline was
+    // cached first, or if the initialization failed, this is the last reference to the pipeline,
+    // so hand it to the device thread to be released there instead of destroying it here.
+    device->GetCallbackTaskManager()->AddCallbackTask([pipeline = std::move(mComputePipeline)] {});
+}
+
+void CreateComputePipelineAsyncTask::Cancel() {
+    DeviceBase* device = mComputePipeline->GetDevice();
+    device->GetInFlightComputePipelineTasks()->Remove(this);
+
+    // Tasks are only cancelled right before the device calls HandleShutDown() or
+    // HandleDeviceLoss() on its CallbackTaskManager, so these callback tasks end up called with the
+    // DeviceDestroyed or DeviceLost status instead of the placeholder Unknown status.
+    for (auto [callback, userdata] : mCallbacks) {
+        device->GetCallbackTaskManager()->AddCallbackTask(
+            std::make_unique<CreateComputePipelineAsyncCallbackTask>(
+                WGPUCreatePipelineAsyncStatus_Unknown, "Pipeline creation was cancelled.",
+                callback, userdata));
     }
 }
 
 void CreateComputePipelineAsyncTask::RunAsync(
     std::unique_ptr<CreateComputePipelineAsyncTask> task) {
     DeviceBase* device = task->mComputePipeline->GetDevice();
+    Ref<ComputePipelineBase> pipeline = task->mComputePipeline;
 
-    const char* eventLabel = utils::GetLabelForTrace(task->mComputePipeline->GetLabel().c_str());
+    const char* eventLabel = utils::GetLabelForTrace(pipeline->GetLabel().c_str());
 
+    // Exactly one of the task and its cancellation runs, and it takes ownership of the task.
     // Using "taskPtr = std::move(task)" causes compilation error while it should be supported
     // since C++14:
     // https://docs.microsoft.com/en-us/cpp/cpp/lambda-expressions-in-cpp?view=msvc-160
-    auto asyncTask = [taskPtr = task.release()] {
-        std::unique_ptr<CreateComputePipelineAsyncTask> innnerTaskPtr(taskPtr);
-        innnerTaskPtr->Run();
+    CreateComputePipelineAsyncTask* taskPtr = task.release();
+    auto asyncTask = [taskPtr] {
+        std::unique_ptr<CreateComputePipelineAsyncTask> innerTaskPtr(taskPtr);
+        innerTaskPtr->Run();
+    };
+    auto cancelTask = [taskPtr] {
+        std::unique_ptr<CreateComputePipelineAsyncTask> innerTaskPtr(taskPtr);
+        innerTaskPtr->Cancel();
     };
 
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
-                            "CreateComputePipelineAsyncTask::RunAsync", task.get(), "label",
+                            "CreateComputePipelineAsyncTask::RunAsync", taskPtr, "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+
+    // Register the task before posting it so that identical pipeline creations can find it.
+    InFlightComputePipelineTasks* inFlightTasks = device->GetInFlightComputePipelineTasks();
+    inFlightTasks->Add(taskPtr);
+    Ref<AsyncTaskHandle> handle =
+        device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), std::move(cancelTask));
+    inFlightTasks->SetTaskHandle(pipeline.Get(), taskPtr, std::move(handle));
 }
 
 CreateRenderPipelineAsyncTask::CreateRenderPipelineAsyncTask(
     Ref<RenderPipelineBase> nonInitializedRenderPipeline,
-    WGPUCreateRenderPipelineAsyncCallback callback,
+    Callback callback,
     void* userdata)
-    : mRenderPipeline(std::move(nonInitializedRenderPipeline)),
-      mCallback(callback),
-      mUserdata(userdata) {
+    : mRenderPipeline(std::move(nonInitializedRenderPipeline)) {
     ASSERT(mRenderPipeline != nullptr);
+    mCallbacks.emplace_back(callback, userdata);
 }
 
 CreateRenderPipelineAsyncTask::~CreateRenderPipelineAsyncTask() = default;
 
+RenderPipelineBase* CreateRenderPipelineAsyncTask::GetPipeline() const {
+    return mRenderPipeline.Get();
+}
+
+void CreateRenderPipelineAsyncTask::AddCallback(Callback callback, void* userdata) {
+    mCallbacks.emplace_back(callback, userdata);
+}
+
 void CreateRenderPipelineAsyncTask::Run() {
     const char* eventLabel = utils::GetLabelForTrace(mRenderPipeline->GetLabel().c_str());
 
     DeviceBase* device = mRenderPipeline->GetDevice();
-    TRACE_EVENT_FLOW_END1(device->GetPlatform(), General, "CreateRenderPipelineAsyncTask::RunAsync",
-                          this, "label", eventLabel);
+    TRACE_EVENT_FLOW_END1(device->GetPlatform(), General,
+                          "CreateRenderPipelineAsyncTask::RunAsync", this, "label", eventLabel);
     TRACE_EVENT1(device->GetPlatform(), General, "CreateRenderPipelineAsyncTask::Run", "label",
                  eventLabel);
 
     MaybeError maybeError = mRenderPipeline->Initialize();
+
+    // No callback can be added once the task is unregistered.
+    device->GetInFlightRenderPipelineTasks()->Remove(this);
+
     if (maybeError.IsError()) {
         std::unique_ptr<ErrorData> error = maybeError.AcquireError();
         WGPUCreatePipelineAsyncStatus status =
             CreatePipelineAsyncStatusFromErrorType(error->GetType());
-        device->GetCallbackTaskManager()->AddCallbackTask(
-            std::make_unique<CreateRenderPipelineAsyncCallbackTask>(status, error->GetMessage(),
-                                                                    mCallback, mUserdata));
+        for (auto [callback, userdata] : mCallbacks) {
+            device->GetCallbackTaskManager()->AddCallbackTask(
+                std::make_unique<CreateRenderPipelineAsyncCallbackTask>(
+                    status, error->GetMessage(), callback, userdata));
+        }
     } else {
-        device->AddRenderPipelineAsyncCallbackTask(mRenderPipeline, mCallback, mUserdata);
+        for (auto [callback, userdata] : mCallbacks) {
+            device->AddRenderPipelineAsyncCallbackTask(mRenderPipeline, callback, userdata);
+        }
+    }
+
+    // See the comment in CreateComputePipelineAsyncTask::Run().
+    device->GetCallbackTaskManager()->AddCallbackTask([pipeline = std::move(mRenderPipeline)] {});
+}
+
+void CreateRenderPipelineAsyncTask::Cancel() {
+    DeviceBase* device = mRenderPipeline->GetDevice();
+    device->GetInFlightRenderPipelineTasks()->Remove(this);
+
+    // Tasks are only cancelled right before the device calls HandleShutDown() or
+    // HandleDeviceLoss() on its CallbackTaskManager, so these callback tasks end up called with the
+    // DeviceDestroyed or DeviceLost status instead of the placeholder Unknown status.
+    for (auto [callback, userdata] : mCallbacks) {
+        device->GetCallbackTaskManager()->AddCallbackTask(
+            std::make_unique<CreateRenderPipelineAsyncCallbackTask>(
+                WGPUCreatePipelineAsyncStatus_Unknown, "Pipeline creation was cancelled.",
+                callback, userdata));
     }
 }
 
 void CreateRenderPipelineAsyncTask::RunAsync(std::unique_ptr<CreateRenderPipelineAsyncTask> task) {
     DeviceBase* device = task->mRenderPipeline->GetDevice();
+    Ref<RenderPipelineBase> pipeline = task->mRenderPipeline;
 
-    const char* eventLabel = utils::GetLabelForTrace(task->mRenderPipeline->GetLabel().c_str());
+    const char* eventLabel = utils::GetLabelForTrace(pipeline->GetLabel().c_str());
 
+    // Exactly one of the task and its cancellation runs, and it takes ownership of the task.
     // Using "taskPtr = std::move(task)" causes compilation error while it should be supported
     // since C++14:
     // https://docs.microsoft.com/en-us/cpp/cpp/lambda-expressions-in-cpp?view=msvc-160
-    auto asyncTask = [taskPtr = task.release()] {
+    CreateRenderPipelineAsyncTask* taskPtr = task.release();
+    auto asyncTask = [taskPtr] {
         std::unique_ptr<CreateRenderPipelineAsyncTask> innerTaskPtr(taskPtr);
         innerTaskPtr->Run();
     };
+    auto cancelTask = [taskPtr] {
+        std::unique_ptr<CreateRenderPipelineAsyncTask> innerTaskPtr(taskPtr);
+        innerTaskPtr->Cancel();
+    };
 
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
-                            "CreateRenderPipelineAsyncTask::RunAsync", task.get(), "label",
+                            "CreateRenderPipelineAsyncTask::RunAsync", taskPtr, "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+
+    // Register the task before posting it so that identical pipeline creations can find it.
+    InFlightRenderPipelineTasks* inFlightTasks = device->GetInFlightRenderPipelineTasks();
+    inFlightTasks->Add(taskPtr);
+    Ref<AsyncTaskHandle> handle =
+        device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), std::move(cancelTask));
+    inFlightTasks->SetTaskHandle(pipeline.Get(), taskPtr, std::move(handle));
 }
+
 }  // namespace dawn::native
@@ -16,9 +16,15 @@
 #define SRC_DAWN_NATIVE_CREATEPIPELINEASYNCTASK_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "dawn/common/NonCopyable.h"
 #include "dawn/common/RefCounted.h"
+#include "dawn/native/AsyncTask.h"
 #include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/Error.h"
 #include "dawn/webgpu.h"
@@ -87,40 +93,139 @@ struct CreateRenderPipelineAsyncCallbackTask : CreatePipelineAsyncCallbackTaskBa
 // CreateComputePipelineAsync() tasks, which are the same among all the backends.
 class CreateComputePipelineAsyncTask {
   public:
+    using Callback = WGPUCreateComputePipelineAsyncCallback;
+
     CreateComputePipelineAsyncTask(Ref<ComputePipelineBase> nonInitializedComputePipeline,
-                                   WGPUCreateComputePipelineAsyncCallback callback,
+                                   Callback callback,
                                    void* userdata);
     ~CreateComputePipelineAsyncTask();
 
+    ComputePipelineBase* GetPipeline() const;
+
+    // Adds a callback that gets the result of this task, for the creation of an identical
+    // pipeline. Must only be called while the task is registered in the device's
+    // InFlightPipelineTasks, which serializes it with the completion of the task.
+    void AddCallback(Callback callback, void* userdata);
+
     void Run();
+    // Called instead of Run() when the task is cancelled before it started.
+    void Cancel();
 
     static void RunAsync(std::unique_ptr<CreateComputePipelineAsyncTask> task);
 
   private:
     Ref<ComputePipelineBase> mComputePipeline;
-    WGPUCreateComputePipelineAsyncCallback mCallback;
-    void* mUserdata;
+    std::vector<std::pair<Callback, void*>> mCallbacks;
 };
 
 // CreateRenderPipelineAsyncTask defines all the inputs and outputs of
 // CreateRenderPipelineAsync() tasks, which are the same among all the backends.
 class CreateRenderPipelineAsyncTask {
   public:
+    using Callback = WGPUCreateRenderPipelineAsyncCallback;
+
     CreateRenderPipelineAsyncTask(Ref<RenderPipelineBase> nonInitializedRenderPipeline,
-                                  WGPUCreateRenderPipelineAsyncCallback callback,
+                                  Callback callback,
                                   void* userdata);
     ~CreateRenderPipelineAsyncTask();
 
+    RenderPipelineBase* GetPipeline() const;
+
+    // Adds a callback that gets the result of this task, for the creation of an identical
+    // pipeline. Must only be called while the task is registered in the device's
+    // InFlightPipelineTasks, which serializes it with the completion of the task.
+    void AddCallback(Callback callback, void* userdata);
+
     void Run();
+    // Called instead of Run() when the task is cancelled before it started.
+    void Cancel();
 
     static void RunAsync(std::unique_ptr<CreateRenderPipelineAsyncTask> task);
 
   private:
     Ref<RenderPipelineBase> mRenderPipeline;
-    WGPUCreateRenderPipelineAsyncCallback mCallback;
-    void* mUserdata;
+    std::vector<std::pair<Callback, void*>> mCallbacks;
 };
 
+// Tracks the CreatePipelineAsyncTasks that haven't completed yet, so that creating a pipeline
+// identical to one that is being compiled reuses that compilation instead of starting another:
+// asynchronous creations add their callback to the in-flight task and synchronous creations
+// steal it with RunNow().
+template <typename PipelineT, typename TaskT>
+class InFlightPipelineTasks : public NonMovable {
+  public:
+    // Registers |task|. Nothing is done if an identical pipeline is already in flight.
+    void Add(TaskT* task) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTasks.emplace(task->GetPipeline(), Entry{task, nullptr});
+    }
+
+    // Sets the handle used to steal |task| once it is posted. |pipeline| must be kept alive by the
+    // caller since |task| may already be completed and deleted.
+    void SetTaskHandle(PipelineT* pipeline, const TaskT* task, Ref<AsyncTaskHandle> handle) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mTasks.find(pipeline);
+        if (iter != mTasks.end() && iter->second.task == task) {
+            iter->second.handle = std::move(handle);
+        }
+    }
+
+    // Unregisters |task|. After this no callback can be added to it anymore.
+    void Remove(TaskT* task) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mTasks.find(task->GetPipeline());
+        if (iter != mTasks.end() && iter->second.task == task) {
+            mTasks.erase(iter);
+        }
+    }
+
+    // Adds the callback to the in-flight task for a pipeline identical to |pipeline|. Returns
+    // false if there is none.
+    bool AddCallback(PipelineT* pipeline, typename TaskT::Callback callback, void* userdata) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mTasks.find(pipeline);
+        if (iter == mTasks.end()) {
+            return false;
+        }
+        iter->second.task->AddCallback(callback, userdata);
+        return true;
+    }
+
+    // Runs the in-flight task for a pipeline identical to |pipeline| on the calling thread if it
+    // hasn't started yet, or waits for it. Returns false if there is no such task.
+    bool RunNow(PipelineT* pipeline) {
+        Ref<AsyncTaskHandle> handle;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = mTasks.find(pipeline);
+            if (iter == mTasks.end() || iter->second.handle == nullptr) {
+                return false;
+            }
+            handle = iter->second.handle;
+        }
+        handle->RunNow();
+        return true;
+    }
+
+  private:
+    struct Entry {
+        TaskT* task;
+        Ref<AsyncTaskHandle> handle;
+    };
+
+    std::mutex mMutex;
+    std::unordered_map<PipelineT*,
+                       Entry,
+                       typename PipelineT::HashFunc,
+                       typename PipelineT::EqualityFunc>
+        mTasks;
+};
+
+using InFlightComputePipelineTasks =
+    InFlightPipelineTasks<ComputePipelineBase, CreateComputePipelineAsyncTask>;
+using InFlightRenderPipelineTasks =
+    InFlightPipelineTasks<RenderPipelineBase, CreateRenderPipelineAsyncTask>;
+
 }  // namespace dawn::native
 
 #endif  // SRC_DAWN_NATIVE_CREATEPIPELINEASYNCTASK_H_
@@ -22,6 +22,7 @@
 #include "dawn/native/Device.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Texture.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/platform/DawnPlatform.h"
 #include "tint/tint.h"
 
@@ -242,6 +243,14 @@ void Instance::EnableAdapterBlocklist(bool enable) {
     mImpl->EnableAdapterBlocklist(enable);
 }
 
+void Instance::SetTintProgramCacheMaxSize(size_t maxSize) {
+    mImpl->GetTintProgramCache()->SetMaxSize(maxSize);
+}
+
+TintProgramCacheStats Instance::GetTintProgramCacheStats() const {
+    return mImpl->GetTintProgramCache()->GetStats();
+}
+
 // TODO(dawn:1374) Deprecate this once it is passed via the descriptor.
 void Instance::SetPlatform(dawn::platform::Platform* platform) {
     mImpl->SetPlatform(platform);
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <unordered_set>
 
+#include "dawn/common/ContentLessObjectCache.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/Adapter.h"
@@ -30,6 +31,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils_autogen.h"
+#include "dawn/native/CommandBlockPool.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -60,24 +62,21 @@ namespace dawn::native {
 
 // DeviceBase sub-structures
 
-// The caches are unordered_sets of pointers with special hash and compare functions
-// to compare the value of the objects, instead of the pointers.
-template <typename Object>
-using ContentLessObjectCache =
-    std::unordered_set<Object*, typename Object::HashFunc, typename Object::EqualityFunc>;
-
+// The caches are sharded sets of pointers with special hash and compare functions to compare the
+// value of the objects, instead of the pointers. They are thread-safe so that objects can be
+// created concurrently from multiple threads without serializing on a single cache lock.
 struct DeviceBase::Caches {
     ~Caches() {
-        ASSERT(attachmentStates.empty());
-        ASSERT(bindGroupLayouts.empty());
-        ASSERT(computePipelines.empty());
-        ASSERT(pipelineLayouts.empty());
-        ASSERT(renderPipelines.empty());
-        ASSERT(samplers.empty());
-        ASSERT(shaderModules.empty());
+        ASSERT(attachmentStates.Empty());
+        ASSERT(bindGroupLayouts.Empty());
+        ASSERT(computePipelines.Empty());
+        ASSERT(pipelineLayouts.Empty());
+        ASSERT(renderPipelines.Empty());
+        ASSERT(samplers.Empty());
+        ASSERT(shaderModules.Empty());
     }
 
-    ContentLessObjectCache<AttachmentStateBlueprint> attachmentStates;
+    ContentLessObjectCache<AttachmentState, AttachmentStateBlueprint> attachmentStates;
     ContentLessObjectCache<BindGroupLayoutBase> bindGroupLayouts;
     ContentLessObjectCache<ComputePipelineBase> computePipelines;
     ContentLessObjectCache<PipelineLayoutBase> pipelineLayouts;
@@ -92,10 +91,6 @@ struct DeviceBase::DeprecationWarnings {
 };
 
 namespace {
-bool IsMutexLockedByCurrentThreadIfNeeded(const Ref<Mutex>& mutex) {
-    return mutex == nullptr || mutex->IsLockedByCurrentThread();
-}
-
 struct LoggingCallbackTask : CallbackTask {
   public:
     LoggingCallbackTask() = delete;
@@ -259,6 +254,11 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
     ASSERT(GetPlatform() != nullptr);
     mWorkerTaskPool = GetPlatform()->CreateWorkerTaskPool();
     mAsyncTaskManager = std::make_unique<AsyncTaskManager>(mWorkerTaskPool.get());
+    if (!IsToggleEnabled(Toggle::DisableCommandBlockPool)) {
+        mCommandBlockPool = std::make_unique<CommandBlockPool>();
+    }
+    mInFlightComputePipelineTasks = std::make_unique<InFlightComputePipelineTasks>();
+    mInFlightRenderPipelineTasks = std::make_unique<InFlightRenderPipelineTasks>();
 
     // Starting from now the backend can start doing reentrant calls so the device is marked as
     // alive.
@@ -421,9 +421,10 @@ void DeviceBase::Destroy() {
             mDeviceLostCallback = nullptr;
         }
 
-        // Call all the callbacks immediately as the device is about to shut down.
-        // TODO(crbug.com/dawn/826): Cancel the tasks that are in flight if possible.
-        mAsyncTaskManager->WaitAllPendingTasks();
+        // Call all the callbacks immediately as the device is about to shut down. Tasks that
+        // haven't started yet, like pipeline compilations, are cancelled since nobody will use
+        // their result.
+        mAsyncTaskManager->CancelAllPendingTasks();
         mCallbackTaskManager->HandleShutDown();
     }
 
@@ -555,8 +556,7 @@ void DeviceBase::HandleError(std::unique_ptr<ErrorData> error,
 
         mQueue->HandleDeviceLoss();
 
-        // TODO(crbug.com/dawn/826): Cancel the tasks that are in flight if possible.
-        mAsyncTaskManager->WaitAllPendingTasks();
+        mAsyncTaskManager->CancelAllPendingTasks();
         mCallbackTaskManager->HandleDeviceLoss();
 
         // Still forward device loss errors to the error scopes so they all reject.
@@ -673,6 +673,13 @@ BlobCache* DeviceBase::GetBlobCache() {
 #endif
 }
 
+TintProgramCache* DeviceBase::GetTintProgramCache() {
+    if (mAdapter == nullptr) {
+        return nullptr;
+    }
+    return mAdapter->GetInstance()->GetTintProgramCache();
+}
+
 Blob DeviceBase::LoadCachedBlob(const CacheKey& key) {
     return GetBlobCache()->Load(key);
 }
@@ -816,15 +823,14 @@ ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<BindGroupLayoutBase> result;
-    auto iter = mCaches->bindGroupLayouts.find(&blueprint);
-    if (iter != mCaches->bindGroupLayouts.end()) {
-        result = *iter;
-    } else {
+    Ref<BindGroupLayoutBase> result = mCaches->bindGroupLayouts.Find(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreateBindGroupLayoutImpl(descriptor, pipelineCompatibilityToken));
         result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->bindGroupLayouts.insert(result.Get());
+        // Another thread may have created an equal object concurrently, in which case we use
+        // theirs and ours is destroyed.
+        result = mCaches->bindGroupLayouts.Insert(result.Get()).first;
     }
 
     return std::move(result);
@@ -832,8 +838,7 @@ ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
 
 void DeviceBase::UncacheBindGroupLayout(BindGroupLayoutBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->bindGroupLayouts.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->bindGroupLayouts.Erase(obj);
 }
 
 // Private function used at initialization
@@ -852,53 +857,35 @@ BindGroupLayoutBase* DeviceBase::GetEmptyBindGroupLayout() {
 
 Ref<ComputePipelineBase> DeviceBase::GetCachedComputePipeline(
     ComputePipelineBase* uninitializedComputePipeline) {
-    Ref<ComputePipelineBase> cachedPipeline;
-    auto iter = mCaches->computePipelines.find(uninitializedComputePipeline);
-    if (iter != mCaches->computePipelines.end()) {
-        cachedPipeline = *iter;
-    }
-
-    return cachedPipeline;
+    return mCaches->computePipelines.Find(uninitializedComputePipeline);
 }
 
 Ref<RenderPipelineBase> DeviceBase::GetCachedRenderPipeline(
     RenderPipelineBase* uninitializedRenderPipeline) {
-    Ref<RenderPipelineBase> cachedPipeline;
-    auto iter = mCaches->renderPipelines.find(uninitializedRenderPipeline);
-    if (iter != mCaches->renderPipelines.end()) {
-        cachedPipeline = *iter;
-    }
-    return cachedPipeline;
+    return mCaches->renderPipelines.Find(uninitializedRenderPipeline);
 }
 
 Ref<ComputePipelineBase> DeviceBase::AddOrGetCachedComputePipeline(
     Ref<ComputePipelineBase> computePipeline) {
-    ASSERT(IsMutexLockedByCurrentThreadIfNeeded(mMutex));
-    auto [cachedPipeline, inserted] = mCaches->computePipelines.insert(computePipeline.Get());
-    if (inserted) {
-        computePipeline->SetIsCachedReference();
-        return computePipeline;
-    } else {
-        return *cachedPipeline;
-    }
+    // The object must be marked as cached before it is visible in the cache so that it removes
+    // itself on destruction. If an equal pipeline is already cached, |computePipeline| is dropped
+    // and its removal from the cache is a no-op.
+    computePipeline->SetIsCachedReference();
+    return mCaches->computePipelines.Insert(computePipeline.Get()).first;
 }
 
 Ref<RenderPipelineBase> DeviceBase::AddOrGetCachedRenderPipeline(
     Ref<RenderPipelineBase> renderPipeline) {
-    ASSERT(IsMutexLockedByCurrentThreadIfNeeded(mMutex));
-    auto [cachedPipeline, inserted] = mCaches->renderPipelines.insert(renderPipeline.Get());
-    if (inserted) {
-        renderPipeline->SetIsCachedReference();
-        return renderPipeline;
-    } else {
-        return *cachedPipeline;
-    }
+    // The object must be marked as cached before it is visible in the cache so that it removes
+    // itself on destruction. If an equal pipeline is already cached, |renderPipeline| is dropped
+    // and its removal from the cache is a no-op.
+    renderPipeline->SetIsCachedReference();
+    return mCaches->renderPipelines.Insert(renderPipeline.Get()).first;
 }
 
 void DeviceBase::UncacheComputePipeline(ComputePipelineBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->computePipelines.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->computePipelines.Erase(obj);
 }
 
 ResultOrError<Ref<TextureViewBase>>
@@ -937,15 +924,14 @@ ResultOrError<Ref<PipelineLayoutBase>> DeviceBase::GetOrCreatePipelineLayout(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<PipelineLayoutBase> result;
-    auto iter = mCaches->pipelineLayouts.find(&blueprint);
-    if (iter != mCaches->pipelineLayouts.end()) {
-        result = *iter;
-    } else {
+    Ref<PipelineLayoutBase> result = mCaches->pipelineLayouts.Find(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreatePipelineLayoutImpl(descriptor));
         result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->pipelineLayouts.insert(result.Get());
+        // Another thread may have created an equal object concurrently, in which case we use
+        // theirs and ours is destroyed.
+        result = mCaches->pipelineLayouts.Insert(result.Get()).first;
     }
 
     return std::move(result);
@@ -953,14 +939,12 @@ ResultOrError<Ref<PipelineLayoutBase>> DeviceBase::GetOrCreatePipelineLayout(
 
 void DeviceBase::UncachePipelineLayout(PipelineLayoutBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->pipelineLayouts.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->pipelineLayouts.Erase(obj);
 }
 
 void DeviceBase::UncacheRenderPipeline(RenderPipelineBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->renderPipelines.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->renderPipelines.Erase(obj);
 }
 
 ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
@@ -970,15 +954,14 @@ ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<SamplerBase> result;
-    auto iter = mCaches->samplers.find(&blueprint);
-    if (iter != mCaches->samplers.end()) {
-        result = *iter;
-    } else {
+    Ref<SamplerBase> result = mCaches->samplers.Find(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreateSamplerImpl(descriptor));
         result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->samplers.insert(result.Get());
+        // Another thread may have created an equal object concurrently, in which case we use
+        // theirs and ours is destroyed.
+        result = mCaches->samplers.Insert(result.Get()).first;
     }
 
     return std::move(result);
@@ -986,8 +969,7 @@ ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
 
 void DeviceBase::UncacheSampler(SamplerBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->samplers.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->samplers.Erase(obj);
 }
 
 ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
@@ -1001,11 +983,8 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<ShaderModuleBase> result;
-    auto iter = mCaches->shaderModules.find(&blueprint);
-    if (iter != mCaches->shaderModules.end()) {
-        result = *iter;
-    } else {
+    Ref<ShaderModuleBase> result = mCaches->shaderModules.Find(&blueprint);
+    if (result == nullptr) {
         if (!parseResult->HasParsedShader()) {
             // We skip the parse on creation if validation isn't enabled which let's us quickly
             // lookup in the cache without validating and parsing. We need the parsed module
@@ -1018,7 +997,7 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
                         CreateShaderModuleImpl(descriptor, parseResult, compilationMessages));
         result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->shaderModules.insert(result.Get());
+        result = mCaches->shaderModules.Insert(result.Get()).first;
     }
 
     return std::move(result);
@@ -1026,21 +1005,19 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
 
 void DeviceBase::UncacheShaderModule(ShaderModuleBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->shaderModules.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->shaderModules.Erase(obj);
 }
 
 Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(AttachmentStateBlueprint* blueprint) {
-    auto iter = mCaches->attachmentStates.find(blueprint);
-    if (iter != mCaches->attachmentStates.end()) {
-        return static_cast<AttachmentState*>(*iter);
+    Ref<AttachmentState> cached = mCaches->attachmentStates.Find(blueprint);
+    if (cached != nullptr) {
+        return cached;
     }
 
     Ref<AttachmentState> attachmentState = AcquireRef(new AttachmentState(this, *blueprint));
     attachmentState->SetIsCachedReference();
     attachmentState->SetContentHash(attachmentState->ComputeContentHash());
-    mCaches->attachmentStates.insert(attachmentState.Get());
-    return attachmentState;
+    return mCaches->attachmentStates.Insert(attachmentState.Get()).first;
 }
 
 Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(
@@ -1063,8 +1040,7 @@ Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(
 
 void DeviceBase::UncacheAttachmentState(AttachmentState* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->attachmentStates.erase(obj);
-    ASSERT(removedCount == 1);
+    mCaches->attachmentStates.Erase(obj);
 }
 
 Ref<PipelineCacheBase> DeviceBase::GetOrCreatePipelineCache(const CacheKey& key) {
@@ -1291,6 +1267,7 @@ bool DeviceBase::APITick() {
     // Tick may trigger callbacks which drop a ref to the device itself. Hold a Ref to ourselves
     // to avoid deleting |this| in the middle of this function call.
     Ref<DeviceBase> self(this);
+    TRACE_EVENT0(GetPlatform(), General, "DeviceBase::APITick");
     bool tickError;
     {
         // Note: we cannot hold the lock when flushing the callbacks so have to limit the scope of
@@ -1321,7 +1298,16 @@ bool DeviceBase::APITick() {
 }
 
 MaybeError DeviceBase::Tick() {
-    if (IsLost() || !HasScheduledCommands()) {
+    if (IsLost()) {
+        return {};
+    }
+
+    // Free the command blocks that weren't needed since the last tick, even if the device is idle.
+    if (mCommandBlockPool != nullptr) {
+        mCommandBlockPool->Trim();
+    }
+
+    if (!HasScheduledCommands()) {
         return {};
     }
 
@@ -1540,6 +1526,16 @@ ResultOrError<Ref<ComputePipelineBase>> DeviceBase::CreateComputePipeline(
         return cachedComputePipeline;
     }
 
+    // If an identical pipeline is being created asynchronously, run that task now or wait for it
+    // instead of compiling the pipeline a second time. If it failed, compile it again below to get
+    // the error.
+    if (mInFlightComputePipelineTasks->RunNow(uninitializedComputePipeline.Get())) {
+        cachedComputePipeline = GetCachedComputePipeline(uninitializedComputePipeline.Get());
+        if (cachedComputePipeline != nullptr) {
+            return cachedComputePipeline;
+        }
+    }
+
     DAWN_TRY(uninitializedComputePipeline->Initialize());
     return AddOrGetCachedComputePipeline(std::move(uninitializedComputePipeline));
 }
@@ -1587,10 +1583,11 @@ MaybeError DeviceBase::CreateComputePipelineAsync(const ComputePipelineDescripto
         mCallbackTaskManager->AddCallbackTask(
             std::bind(callback, WGPUCreatePipelineAsyncStatus_Success,
                       ToAPI(cachedComputePipeline.Detach()), "", userdata));
-    } else {
-        // Otherwise we will create the pipeline object in InitializeComputePipelineAsyncImpl(),
-        // where the pipeline object may be initialized asynchronously and the result will be
-        // saved to mCreatePipelineAsyncTracker.
+    } else if (!mInFlightComputePipelineTasks->AddCallback(uninitializedComputePipeline.Get(),
+                                                         callback, userdata)) {
+        // Otherwise, unless an identical pipeline is already being created asynchronously, we
+        // will create the pipeline object in InitializeComputePipelineAsyncImpl(), where the
+        // pipeline object may be initialized asynchronously.
         InitializeComputePipelineAsyncImpl(std::move(uninitializedComputePipeline), callback,
                                            userdata);
     }
@@ -1699,6 +1696,16 @@ ResultOrError<Ref<RenderPipelineBase>> DeviceBase::CreateRenderPipeline(
         return cachedRenderPipeline;
     }
 
+    // If an identical pipeline is being created asynchronously, run that task now or wait for it
+    // instead of compiling the pipeline a second time. If it failed, compile it again below to get
+    // the error.
+    if (mInFlightRenderPipelineTasks->RunNow(uninitializedRenderPipeline.Get())) {
+        cachedRenderPipeline = GetCachedRenderPipeline(uninitializedRenderPipeline.Get());
+        if (cachedRenderPipeline != nullptr) {
+            return cachedRenderPipeline;
+        }
+    }
+
     DAWN_TRY(uninitializedRenderPipeline->Initialize());
     return AddOrGetCachedRenderPipeline(std::move(uninitializedRenderPipeline));
 }
@@ -1729,10 +1736,11 @@ MaybeError DeviceBase::CreateRenderPipelineAsync(const RenderPipelineDescriptor*
         mCallbackTaskManager->AddCallbackTask(
             std::bind(callback, WGPUCreatePipelineAsyncStatus_Success,
                       ToAPI(cachedRenderPipeline.Detach()), "", userdata));
-    } else {
-        // Otherwise we will create the pipeline object in InitializeRenderPipelineAsyncImpl(),
-        // where the pipeline object may be initialized asynchronously and the result will be
-        // saved to mCreatePipelineAsyncTracker.
+    } else if (!mInFlightRenderPipelineTasks->AddCallback(uninitializedRenderPipeline.Get(),
+                                                         callback, userdata)) {
+        // Otherwise, unless an identical pipeline is already being created asynchronously, we
+        // will create the pipeline object in InitializeRenderPipelineAsyncImpl(), where the
+        // pipeline object may be initialized asynchronously.
         InitializeRenderPipelineAsyncImpl(std::move(uninitializedRenderPipeline), callback,
                                           userdata);
     }
@@ -1862,10 +1870,22 @@ const CombinedLimits& DeviceBase::GetLimits() const {
     return mLimits;
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
 AsyncTaskManager* DeviceBase::GetAsyncTaskManager() const {
     return mAsyncTaskManager.get();
 }
 
+InFlightComputePipelineTasks* DeviceBase::GetInFlightComputePipelineTasks() const {
+    return mInFlightComputePipelineTasks.get();
+}
+
+InFlightRenderPipelineTasks* DeviceBase::GetInFlightRenderPipelineTasks() const {
+    return mInFlightRenderPipelineTasks.get();
+}
+
 CallbackTaskManager* DeviceBase::GetCallbackTaskManager() const {
     return mCallbackTaskManager.Get();
 }
@@ -1878,65 +1898,21 @@ void DeviceBase::AddComputePipelineAsyncCallbackTask(
     Ref<ComputePipelineBase> pipeline,
     WGPUCreateComputePipelineAsyncCallback callback,
     void* userdata) {
-    // CreateComputePipelineAsyncWaitableCallbackTask is declared as an internal class as it
-    // needs to call the private member function DeviceBase::AddOrGetCachedComputePipeline().
-    struct CreateComputePipelineAsyncWaitableCallbackTask final
-        : CreateComputePipelineAsyncCallbackTask {
-        using CreateComputePipelineAsyncCallbackTask::CreateComputePipelineAsyncCallbackTask;
-        void FinishImpl() final {
-            // TODO(dawn:529): call AddOrGetCachedComputePipeline() asynchronously in
-            // CreateComputePipelineAsyncTaskImpl::Run() when the front-end pipeline cache is
-            // thread-safe.
-            ASSERT(mPipeline != nullptr);
-            {
-                // This is called inside a callback, and no lock will be held by default so we have
-                // to lock now to protect the cache.
-                // Note: we don't lock inside AddOrGetCachedComputePipeline() to avoid deadlock
-                // because many places calling that method might already have the lock held. For
-                // example, APICreateComputePipeline()
-                auto deviceLock(mPipeline->GetDevice()->GetScopedLock());
-                mPipeline = mPipeline->GetDevice()->AddOrGetCachedComputePipeline(mPipeline);
-            }
-
-            CreateComputePipelineAsyncCallbackTask::FinishImpl();
-        }
-    };
-
-    mCallbackTaskManager->AddCallbackTask(
-        std::make_unique<CreateComputePipelineAsyncWaitableCallbackTask>(std::move(pipeline),
-                                                                         callback, userdata));
+    // The pipeline is added to the cache right away, instead of when the callback is called, so
+    // that synchronous creations of the same pipeline can find it. The cache is thread-safe so
+    // this doesn't need the device lock. The caller keeps its own reference to |pipeline| and
+    // releases it on the device thread, since it's the last one if an identical pipeline was
+    // cached first.
+    mCallbackTaskManager->AddCallbackTask(std::make_unique<CreateComputePipelineAsyncCallbackTask>(
+        AddOrGetCachedComputePipeline(std::move(pipeline)), callback, userdata));
 }
 
 void DeviceBase::AddRenderPipelineAsyncCallbackTask(Ref<RenderPipelineBase> pipeline,
                                                     WGPUCreateRenderPipelineAsyncCallback callback,
                                                     void* userdata) {
-    // CreateRenderPipelineAsyncWaitableCallbackTask is declared as an internal class as it
-    // needs to call the private member function DeviceBase::AddOrGetCachedRenderPipeline().
-    struct CreateRenderPipelineAsyncWaitableCallbackTask final
-        : CreateRenderPipelineAsyncCallbackTask {
-        using CreateRenderPipelineAsyncCallbackTask::CreateRenderPipelineAsyncCallbackTask;
-
-        void FinishImpl() final {
-            // TODO(dawn:529): call AddOrGetCachedRenderPipeline() asynchronously in
-            // CreateRenderPipelineAsyncTaskImpl::Run() when the front-end pipeline cache is
-            // thread-safe.
-            if (mPipeline.Get() != nullptr) {
-                // This is called inside a callback, and no lock will be held by default so we have
-                // to lock now to protect the cache.
-                // Note: we don't lock inside AddOrGetCachedRenderPipeline() to avoid deadlock
-                // because many places calling that method might already have the lock held. For
-                // example, APICreateRenderPipeline()
-                auto deviceLock(mPipeline->GetDevice()->GetScopedLock());
-                mPipeline = mPipeline->GetDevice()->AddOrGetCachedRenderPipeline(mPipeline);
-            }
-
-            CreateRenderPipelineAsyncCallbackTask::FinishImpl();
-        }
-    };
-
-    mCallbackTaskManager->AddCallbackTask(
-        std::make_unique<CreateRenderPipelineAsyncWaitableCallbackTask>(std::move(pipeline),
-                                                                        callback, userdata));
+    // See the comment in AddComputePipelineAsyncCallbackTask.
+    mCallbackTaskManager->AddCallbackTask(std::make_unique<CreateRenderPipelineAsyncCallbackTask>(
+        AddOrGetCachedRenderPipeline(std::move(pipeline)), callback, userdata));
 }
 
 PipelineCompatibilityToken DeviceBase::GetNextPipelineCompatibilityToken() {
@@ -1972,6 +1948,10 @@ bool DeviceBase::ShouldDuplicateParametersForDrawIndirect(
     return false;
 }
 
+bool DeviceBase::CanWriteBufferDirectly(const BufferBase* buffer) const {
+    return false;
+}
+
 uint64_t DeviceBase::GetBufferCopyOffsetAlignmentForDepthStencil() const {
     // For depth-stencil texture, buffer offset must be a multiple of 4, which is required
     // by WebGPU and Vulkan SPEC.
@@ -50,13 +50,24 @@ class AttachmentStateBlueprint;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
+class CreateComputePipelineAsyncTask;
+class CreateRenderPipelineAsyncTask;
 class DynamicUploader;
 class ErrorScopeStack;
 class OwnedCompilationMessages;
+class TintProgramCache;
 struct CallbackTask;
 struct InternalPipelineStore;
 struct ShaderModuleParseResult;
 
+template <typename PipelineT, typename TaskT>
+class InFlightPipelineTasks;
+using InFlightComputePipelineTasks =
+    InFlightPipelineTasks<ComputePipelineBase, CreateComputePipelineAsyncTask>;
+using InFlightRenderPipelineTasks =
+    InFlightPipelineTasks<RenderPipelineBase, CreateRenderPipelineAsyncTask>;
+
 using WGSLExtensionSet = std::unordered_set<std::string>;
 
 class DeviceBase : public RefCountedWithExternalCount {
@@ -310,6 +321,8 @@ class DeviceBase : public RefCountedWithExternalCount {
     MaybeError ValidateIsAlive() const;
 
     BlobCache* GetBlobCache();
+    // Returns nullptr for devices that aren't created from an adapter, like mock devices.
+    TintProgramCache* GetTintProgramCache();
     Blob LoadCachedBlob(const CacheKey& key);
     void StoreCachedBlob(const CacheKey& key, const Blob& blob);
 
@@ -324,6 +337,8 @@ class DeviceBase : public RefCountedWithExternalCount {
                                         const Extent3D& copySizePixels);
 
     DynamicUploader* GetDynamicUploader() const;
+    // Returns nullptr if the command blocks aren't pooled.
+    CommandBlockPool* GetCommandBlockPool() const;
 
     // The device state which is a combination of creation state and loss state.
     //
@@ -386,11 +401,18 @@ class DeviceBase : public RefCountedWithExternalCount {
     virtual bool ShouldDuplicateParametersForDrawIndirect(
         const RenderPipelineBase* renderPipelineBase) const;
 
+    // Returns true if the memory of |buffer| is persistently mapped and coherent so that
+    // WriteBuffer can copy data directly into it when the GPU is done using the buffer, instead
+    // of going through the DynamicUploader.
+    virtual bool CanWriteBufferDirectly(const BufferBase* buffer) const;
+
     bool HasFeature(Feature feature) const;
 
     const CombinedLimits& GetLimits() const;
 
     AsyncTaskManager* GetAsyncTaskManager() const;
+    InFlightComputePipelineTasks* GetInFlightComputePipelineTasks() const;
+    InFlightRenderPipelineTasks* GetInFlightRenderPipelineTasks() const;
     CallbackTaskManager* GetCallbackTaskManager() const;
     dawn::platform::WorkerTaskPool* GetWorkerTaskPool() const;
 
@@ -564,6 +586,9 @@ class DeviceBase : public RefCountedWithExternalCount {
 
     std::unique_ptr<ErrorScopeStack> mErrorScopeStack;
 
+    // Declared before the members that might hold commands so that it is destroyed after them.
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
+
     Ref<AdapterBase> mAdapter;
 
     // The object caches aren't exposed in the header as they would require a lot of
@@ -577,6 +602,8 @@ class DeviceBase : public RefCountedWithExternalCount {
 
     std::unique_ptr<DynamicUploader> mDynamicUploader;
     std::unique_ptr<AsyncTaskManager> mAsyncTaskManager;
+    std::unique_ptr<InFlightComputePipelineTasks> mInFlightComputePipelineTasks;
+    std::unique_ptr<InFlightRenderPipelineTasks> mInFlightRenderPipelineTasks;
     Ref<QueueBase> mQueue;
 
     struct DeprecationWarnings;
@@ -14,6 +14,7 @@
 
 #include "dawn/native/DynamicUploader.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "dawn/common/Math.h"
@@ -23,39 +24,84 @@
 namespace dawn::native {
 
 DynamicUploader::DynamicUploader(DeviceBase* device) : mDevice(device) {
-    mRingBuffers.emplace_back(
-        std::unique_ptr<RingBuffer>(new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+    mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
+        new RingBuffer{nullptr, RingBufferAllocator(kMinRingBufferSize)}));
 }
 
 void DynamicUploader::ReleaseStagingBuffer(Ref<BufferBase> stagingBuffer) {
     mReleasedStagingBuffers.Enqueue(std::move(stagingBuffer), mDevice->GetPendingCommandSerial());
 }
 
+ResultOrError<Ref<BufferBase>> DynamicUploader::CreateStagingBuffer(uint64_t size) {
+    BufferDescriptor bufferDesc = {};
+    bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
+    bufferDesc.size = Align(size, 4);
+    bufferDesc.mappedAtCreation = true;
+    bufferDesc.label = "Dawn_DynamicUploaderStaging";
+
+    IgnoreLazyClearCountScope scope(mDevice);
+    return mDevice->CreateBuffer(&bufferDesc);
+}
+
+void DynamicUploader::UpdateRingBufferSize(uint64_t allocationSize, ExecutionSerial serial) {
+    if (serial != mLastUploadSerial) {
+        // Decay the recent upload size so that the ring buffers shrink back once the uploads get
+        // smaller.
+        mRecentUploadSize =
+            std::max(mLastSerialUploadSize, mRecentUploadSize - mRecentUploadSize / 4);
+        mLastUploadSerial = serial;
+        mLastSerialUploadSize = 0;
+    }
+    mLastSerialUploadSize += allocationSize;
+
+    uint64_t uploadSize = std::max(mRecentUploadSize, mLastSerialUploadSize);
+    mRingBufferSize =
+        std::clamp(NextPowerOfTwo(uploadSize), kMinRingBufferSize, kMaxRingBufferSize);
+}
+
+ResultOrError<UploadHandle> DynamicUploader::AllocateStagingBuffer(uint64_t allocationSize,
+                                                                   ExecutionSerial serial) {
+    // Reuse the smallest free staging buffer that is large enough, unless more than half of it
+    // would be wasted.
+    uint64_t bufferSize = Align(allocationSize, 4);
+    auto bestFit = mFreeStagingBuffers.end();
+    for (auto it = mFreeStagingBuffers.begin(); it != mFreeStagingBuffers.end(); ++it) {
+        uint64_t size = (*it)->GetSize();
+        if (size >= bufferSize && size / 2 <= bufferSize &&
+            (bestFit == mFreeStagingBuffers.end() || size < (*bestFit)->GetSize())) {
+            bestFit = it;
+        }
+    }
+
+    Ref<BufferBase> stagingBuffer;
+    if (bestFit != mFreeStagingBuffers.end()) {
+        stagingBuffer = std::move(*bestFit);
+        mFreeStagingBuffers.erase(bestFit);
+        mFreeStagingBuffersSize -= stagingBuffer->GetSize();
+    } else {
+        DAWN_TRY_ASSIGN(stagingBuffer, CreateStagingBuffer(bufferSize));
+    }
+
+    UploadHandle uploadHandle;
+    uploadHandle.mappedBuffer = static_cast<uint8_t*>(stagingBuffer->GetMappedPointer());
+    uploadHandle.stagingBuffer = stagingBuffer.Get();
+
+    mInFlightStagingBuffers.Enqueue(std::move(stagingBuffer), serial);
+    return uploadHandle;
+}
+
 ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocationSize,
                                                               ExecutionSerial serial) {
     // Disable further sub-allocation should the request be too large.
-    if (allocationSize > kRingBufferSize) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = Align(allocationSize, 4);
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
-        Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
-
-        UploadHandle uploadHandle;
-        uploadHandle.mappedBuffer = static_cast<uint8_t*>(stagingBuffer->GetMappedPointer());
-        uploadHandle.stagingBuffer = stagingBuffer.Get();
-
-        ReleaseStagingBuffer(std::move(stagingBuffer));
-        return uploadHandle;
+    if (allocationSize > kMaxRingBufferSize) {
+        return AllocateStagingBuffer(allocationSize, serial);
     }
 
+    UpdateRingBufferSize(allocationSize, serial);
+
     // Note: Validation ensures size is already aligned.
     // First-fit: find next smallest buffer large enough to satisfy the allocation request.
-    RingBuffer* targetRingBuffer = mRingBuffers.back().get();
+    RingBuffer* targetRingBuffer = nullptr;
     for (auto& ringBuffer : mRingBuffers) {
         const RingBufferAllocator& ringBufferAllocator = ringBuffer->mAllocator;
         // Prevent overflow.
@@ -76,8 +122,9 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
     // Upon failure, append a newly created ring buffer to fulfill the
     // request.
     if (startOffset == RingBufferAllocator::kInvalidOffset) {
+        ASSERT(allocationSize <= mRingBufferSize);
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(mRingBufferSize)}));
 
         targetRingBuffer = mRingBuffers.back().get();
         startOffset = targetRingBuffer->mAllocator.Allocate(allocationSize, serial);
@@ -88,16 +135,8 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
     // Allocate the staging buffer backing the ringbuffer.
     // Note: the first ringbuffer will be lazily created.
     if (targetRingBuffer->mStagingBuffer == nullptr) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = Align(targetRingBuffer->mAllocator.GetSize(), 4);
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
-        Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
-        targetRingBuffer->mStagingBuffer = std::move(stagingBuffer);
+        DAWN_TRY_ASSIGN(targetRingBuffer->mStagingBuffer,
+                        CreateStagingBuffer(targetRingBuffer->mAllocator.GetSize()));
     }
 
     ASSERT(targetRingBuffer->mStagingBuffer != nullptr);
@@ -114,16 +153,39 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
 void DynamicUploader::Deallocate(ExecutionSerial lastCompletedSerial) {
     // Reclaim memory within the ring buffers by ticking (or removing requests no longer
     // in-flight).
-    for (size_t i = 0; i < mRingBuffers.size(); ++i) {
-        mRingBuffers[i]->mAllocator.Deallocate(lastCompletedSerial);
-
-        // Never erase the last buffer as to prevent re-creating smaller buffers
-        // again. The last buffer is the largest.
-        if (mRingBuffers[i]->mAllocator.Empty() && i < mRingBuffers.size() - 1) {
+    bool keptEmptyRingBuffer = false;
+    for (size_t i = 0; i < mRingBuffers.size();) {
+        RingBufferAllocator& allocator = mRingBuffers[i]->mAllocator;
+        allocator.Deallocate(lastCompletedSerial);
+
+        // Keep one empty buffer of the current size as to prevent re-creating it for the next
+        // uploads. Empty buffers of other sizes are released, so that the ring buffers shrink
+        // when the uploads get smaller.
+        if (allocator.Empty() &&
+            (keptEmptyRingBuffer || allocator.GetSize() != mRingBufferSize)) {
             mRingBuffers.erase(mRingBuffers.begin() + i);
+            continue;
         }
+        keptEmptyRingBuffer = keptEmptyRingBuffer || allocator.Empty();
+        ++i;
     }
     mReleasedStagingBuffers.ClearUpTo(lastCompletedSerial);
+
+    // The staging buffers of completed uploads can be reused. Release the least recently freed
+    // ones if too many are kept.
+    for (Ref<BufferBase>& stagingBuffer :
+         mInFlightStagingBuffers.IterateUpTo(lastCompletedSerial)) {
+        mFreeStagingBuffersSize += stagingBuffer->GetSize();
+        mFreeStagingBuffers.push_back(std::move(stagingBuffer));
+    }
+    mInFlightStagingBuffers.ClearUpTo(lastCompletedSerial);
+
+    auto firstKept = mFreeStagingBuffers.begin();
+    while (mFreeStagingBuffersSize > kMaxFreeStagingBuffersSize) {
+        mFreeStagingBuffersSize -= (*firstKept)->GetSize();
+        ++firstKept;
+    }
+    mFreeStagingBuffers.erase(mFreeStagingBuffers.begin(), firstKept);
 }
 
 // TODO(dawn:512): Optimize this function so that it doesn't allocate additional memory
@@ -153,6 +215,9 @@ uint64_t DynamicUploader::GetTotalAllocatedSize() {
     for (const auto& buffer : mReleasedStagingBuffers.IterateAll()) {
         size += buffer->GetSize();
     }
+    for (const auto& buffer : mInFlightStagingBuffers.IterateAll()) {
+        size += buffer->GetSize();
+    }
     for (const auto& buffer : mRingBuffers) {
         if (buffer->mStagingBuffer != nullptr) {
             size += buffer->mStagingBuffer->GetSize();
@@ -55,7 +55,14 @@ class DynamicUploader {
     bool ShouldFlush();
 
   private:
-    static constexpr uint64_t kRingBufferSize = 4 * 1024 * 1024;
+    // The size of the ring buffers adapts to the volume of the recent uploads, so that the uploads
+    // of a serial fit in a single ring buffer, within these bounds.
+    static constexpr uint64_t kMinRingBufferSize = 4 * 1024 * 1024;
+    static constexpr uint64_t kMaxRingBufferSize = 32 * 1024 * 1024;
+    // The staging buffers of allocations larger than kMaxRingBufferSize are kept for reuse once
+    // their uploads are complete, up to this total size.
+    static constexpr uint64_t kMaxFreeStagingBuffersSize = 256 * 1024 * 1024;
+
     uint64_t GetTotalAllocatedSize();
 
     struct RingBuffer {
@@ -64,9 +71,25 @@ class DynamicUploader {
     };
 
     ResultOrError<UploadHandle> AllocateInternal(uint64_t allocationSize, ExecutionSerial serial);
+    ResultOrError<UploadHandle> AllocateStagingBuffer(uint64_t allocationSize,
+                                                      ExecutionSerial serial);
+    ResultOrError<Ref<BufferBase>> CreateStagingBuffer(uint64_t size);
+    void UpdateRingBufferSize(uint64_t allocationSize, ExecutionSerial serial);
 
     std::vector<std::unique_ptr<RingBuffer>> mRingBuffers;
+    // The size of the ring buffers created for the next allocations.
+    uint64_t mRingBufferSize = kMinRingBufferSize;
+    // The number of bytes uploaded for the latest serial, and the decaying maximum of the number
+    // of bytes uploaded for the previous ones.
+    ExecutionSerial mLastUploadSerial = ExecutionSerial(0);
+    uint64_t mLastSerialUploadSize = 0;
+    uint64_t mRecentUploadSize = 0;
+
     SerialQueue<ExecutionSerial, Ref<BufferBase>> mReleasedStagingBuffers;
+    SerialQueue<ExecutionSerial, Ref<BufferBase>> mInFlightStagingBuffers;
+    // The staging buffers that can be reused, from the least to the most recently freed.
+    std::vector<Ref<BufferBase>> mFreeStagingBuffers;
+    uint64_t mFreeStagingBuffersSize = 0;
     DeviceBase* mDevice;
 };
 }  // namespace dawn::native
@@ -15,6 +15,7 @@
 #include "dawn/native/EncodingContext.h"
 
 #include "dawn/common/Assert.h"
+#include "dawn/native/CommandBlockPool.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/Commands.h"
 #include "dawn/native/Device.h"
@@ -28,6 +29,7 @@ EncodingContext::EncodingContext(DeviceBase* device, const ApiObjectBase* initia
     : mDevice(device),
       mTopLevelEncoder(initialEncoder),
       mCurrentEncoder(initialEncoder),
+      mPendingCommands(device->GetCommandBlockPool()),
       mDestroyed(device->IsLost()) {}
 
 EncodingContext::~EncodingContext() {
@@ -64,6 +66,7 @@ CommandIterator* EncodingContext::GetIterator() {
 }
 
 void EncodingContext::MoveToIterator() {
+    CommitPassCommands();
     CommitCommands(std::move(mPendingCommands));
     if (!mWasMovedToIterator) {
         mIterator.AcquireCommandBlocks(std::move(mAllocators));
@@ -128,8 +131,9 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
         // With validation enabled, commands were committed just before BeginRenderPassCmd was
         // encoded by our RenderPassEncoder (see WillBeginRenderPass above). This means
         // mPendingCommands contains only the commands from BeginRenderPassCmd to
-        // EndRenderPassCmd, inclusive. Now we swap out this allocator with a fresh one to give
-        // the validation encoder a chance to insert its commands first.
+        // EndRenderPassCmd, inclusive, unless secondary encoders were appended in which case the
+        // commands before them are in mPendingPassCommands. Now we swap out this allocator with a
+        // fresh one to give the validation encoder a chance to insert its commands first.
         // Note: If encoding validation commands fails, no commands should be in mPendingCommands,
         //       so swap back the renderCommands to ensure that they are not leaked.
         CommandAllocator renderCommands = std::move(mPendingCommands);
@@ -137,7 +141,10 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
                                   mDevice, commandEncoder, &usageTracker, &indirectDrawMetadata),
                               { mPendingCommands = std::move(renderCommands); });
         CommitCommands(std::move(mPendingCommands));
+        CommitPassCommands();
         CommitCommands(std::move(renderCommands));
+    } else {
+        CommitPassCommands();
     }
 
     mRenderPassUsages.push_back(usageTracker.AcquireResourceUsage());
@@ -203,6 +210,7 @@ MaybeError EncodingContext::Finish() {
     // if Finish() has been called.
     mCurrentEncoder = nullptr;
     mTopLevelEncoder = nullptr;
+    CommitPassCommands();
     CommitCommands(std::move(mPendingCommands));
 
     if (mError != nullptr) {
@@ -213,12 +221,33 @@ MaybeError EncodingContext::Finish() {
     return {};
 }
 
+void EncodingContext::AppendSecondaryCommands(EncodingContext* secondaryContext) {
+    ASSERT(mCurrentEncoder != mTopLevelEncoder);
+    ASSERT(secondaryContext->IsFinished());
+    ASSERT(!secondaryContext->mWasMovedToIterator);
+
+    if (!mPendingCommands.IsEmpty()) {
+        mPendingPassCommands.push_back(std::move(mPendingCommands));
+    }
+    for (CommandAllocator& allocator : secondaryContext->mAllocators) {
+        mPendingPassCommands.push_back(std::move(allocator));
+    }
+    secondaryContext->mAllocators.clear();
+}
+
 void EncodingContext::CommitCommands(CommandAllocator allocator) {
     if (!allocator.IsEmpty()) {
         mAllocators.push_back(std::move(allocator));
     }
 }
 
+void EncodingContext::CommitPassCommands() {
+    for (CommandAllocator& allocator : mPendingPassCommands) {
+        CommitCommands(std::move(allocator));
+    }
+    mPendingPassCommands.clear();
+}
+
 bool EncodingContext::IsFinished() const {
     return mTopLevelEncoder == nullptr;
 }
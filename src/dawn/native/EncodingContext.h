@@ -132,6 +132,11 @@ class EncodingContext {
     void ExitComputePass(const ApiObjectBase* passEncoder, ComputePassResourceUsage usages);
     MaybeError Finish();
 
+    // Moves the commands of the finished |secondaryContext| of a secondary render pass encoder
+    // after the commands recorded so far in the current render pass. The command blocks are
+    // spliced in, not copied. Must be called before the EndRenderPassCmd is encoded.
+    void AppendSecondaryCommands(EncodingContext* secondaryContext);
+
     // Called when a pass encoder is deleted. Provides an opportunity to clean up if it's the
     // mCurrentEncoder.
     void EnsurePassExited(const ApiObjectBase* passEncoder);
@@ -146,6 +151,7 @@ class EncodingContext {
 
   private:
     void CommitCommands(CommandAllocator allocator);
+    void CommitPassCommands();
 
     bool IsFinished() const;
     void MoveToIterator();
@@ -168,6 +174,9 @@ class EncodingContext {
     bool mWereComputePassUsagesAcquired = false;
 
     CommandAllocator mPendingCommands;
+    // When secondary render pass encoders are appended, the commands recorded so far followed by
+    // the commands of the secondary encoders. They go before the commands in mPendingCommands.
+    std::vector<CommandAllocator> mPendingPassCommands;
 
     std::vector<CommandAllocator> mAllocators;
     CommandIterator mIterator;
@@ -0,0 +1,524 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/FileCache.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Log.h"
+#include "dawn/common/Platform.h"
+#include "dawn/common/SystemUtils.h"
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+#include "dawn/common/windows_with_undefs.h"
+#elif DAWN_PLATFORM_IS(POSIX)
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#else
+#error "Implement FileCache for your platform."
+#endif
+
+namespace dawn::native {
+
+namespace {
+
+constexpr uint32_t kEntryMagic = 0x43574144;  // "DAWC"
+constexpr char kEntryExtension[] = ".entry";
+
+// The header at the start of each entry file, followed by the key and the value.
+struct EntryHeader {
+    uint32_t magic;
+    // CRC-32 of the key and the value.
+    uint32_t checksum;
+    uint64_t keySize;
+    uint64_t valueSize;
+};
+
+constexpr std::array<uint32_t, 256> ComputeCRC32Table() {
+    std::array<uint32_t, 256> table = {};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (uint32_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) != 0 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCRC32Table = ComputeCRC32Table();
+
+uint32_t UpdateCRC32(uint32_t crc, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        crc = kCRC32Table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t ComputeEntryChecksum(const void* key,
+                              size_t keySize,
+                              const void* value,
+                              size_t valueSize) {
+    uint32_t crc = 0xFFFFFFFFu;
+    crc = UpdateCRC32(crc, key, keySize);
+    crc = UpdateCRC32(crc, value, valueSize);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// FNV-1a hash of the key. Unlike std::hash, it is the same in every process.
+uint64_t HashKey(const void* key, size_t keySize) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(key);
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < keySize; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+struct EntryFileInfo {
+    std::string path;
+    uint64_t size;
+    uint64_t lastUseTime;
+};
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+bool MakeDirectory(const std::string& path) {
+    return CreateDirectoryA(path.c_str(), nullptr) != 0 || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+std::vector<EntryFileInfo> ListEntryFiles(const std::string& directory) {
+    std::vector<EntryFileInfo> entries;
+    std::string pattern = directory + GetPathSeparator() + "*" + kEntryExtension;
+
+    WIN32_FIND_DATAA findData;
+    HANDLE find = FindFirstFileA(pattern.c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE) {
+        return entries;
+    }
+    do {
+        if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+            continue;
+        }
+        uint64_t size = (uint64_t(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+        uint64_t lastWriteTime = (uint64_t(findData.ftLastWriteTime.dwHighDateTime) << 32) |
+                                 findData.ftLastWriteTime.dwLowDateTime;
+        entries.push_back(
+            {directory + GetPathSeparator() + findData.cFileName, size, lastWriteTime});
+    } while (FindNextFileA(find, &findData));
+    FindClose(find);
+
+    return entries;
+}
+
+void MarkEntryFileAsUsed(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, nullptr, nullptr, &now);
+    CloseHandle(file);
+}
+
+uint64_t GetFileSize(const std::string& path) {
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data)) {
+        return 0;
+    }
+    return (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+}
+
+bool RenameFile(const std::string& from, const std::string& to) {
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+uint64_t GetCurrentProcessIdentifier() {
+    return GetCurrentProcessId();
+}
+#elif DAWN_PLATFORM_IS(POSIX)
+bool EndsWith(const std::string& str, const char* suffix) {
+    size_t suffixLength = strlen(suffix);
+    return str.size() >= suffixLength &&
+           str.compare(str.size() - suffixLength, suffixLength, suffix) == 0;
+}
+
+bool MakeDirectory(const std::string& path) {
+    if (mkdir(path.c_str(), 0755) == 0) {
+        return true;
+    }
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+std::vector<EntryFileInfo> ListEntryFiles(const std::string& directory) {
+    std::vector<EntryFileInfo> entries;
+
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        return entries;
+    }
+    while (const dirent* dirEntry = readdir(dir)) {
+        std::string name = dirEntry->d_name;
+        if (!EndsWith(name, kEntryExtension)) {
+            continue;
+        }
+        std::string path = directory + GetPathSeparator() + name;
+        struct stat info;
+        if (stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+            continue;
+        }
+#if DAWN_PLATFORM_IS(APPLE)
+        const timespec& lastModification = info.st_mtimespec;
+#else
+        const timespec& lastModification = info.st_mtim;
+#endif
+        uint64_t lastModificationTime =
+            static_cast<uint64_t>(lastModification.tv_sec) * 1000000000ull +
+            static_cast<uint64_t>(lastModification.tv_nsec);
+        entries.push_back(
+            {std::move(path), static_cast<uint64_t>(info.st_size), lastModificationTime});
+    }
+    closedir(dir);
+
+    return entries;
+}
+
+void MarkEntryFileAsUsed(const std::string& path) {
+    utimes(path.c_str(), nullptr);
+}
+
+uint64_t GetFileSize(const std::string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+        return 0;
+    }
+    return static_cast<uint64_t>(info.st_size);
+}
+
+bool RenameFile(const std::string& from, const std::string& to) {
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
+uint64_t GetCurrentProcessIdentifier() {
+    return static_cast<uint64_t>(getpid());
+}
+#endif
+
+}  // anonymous namespace
+
+// A read-only memory mapping of a whole file.
+class MappedFile {
+  public:
+    static std::unique_ptr<MappedFile> Open(const std::string& path);
+    ~MappedFile();
+
+    const uint8_t* GetData() const { return mData; }
+    size_t GetSize() const { return mSize; }
+
+  private:
+    MappedFile(const uint8_t* data, size_t size) : mData(data), mSize(size) {}
+
+    const uint8_t* mData;
+    size_t mSize;
+};
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+// static
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // The view keeps the file mapping alive after the handles are closed.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<MappedFile>(
+        new MappedFile(static_cast<const uint8_t*>(data), static_cast<size_t>(size.QuadPart)));
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(mData);
+}
+#elif DAWN_PLATFORM_IS(POSIX)
+// static
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    // The mapping stays valid after the file descriptor is closed.
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<const uint8_t*>(data), size));
+}
+
+MappedFile::~MappedFile() {
+    munmap(const_cast<uint8_t*>(mData), mSize);
+}
+#endif
+
+namespace {
+
+enum class EntryStatus {
+    Valid,
+    // The entry is for another key with the same hash.
+    OtherKey,
+    // The entry is truncated or its checksum doesn't match its contents.
+    Corrupted,
+};
+
+EntryStatus ValidateEntry(const MappedFile& file,
+                          const void* key,
+                          size_t keySize,
+                          const uint8_t** valueOut,
+                          size_t* valueSizeOut) {
+    EntryHeader header;
+    if (file.GetSize() < sizeof(header)) {
+        return EntryStatus::Corrupted;
+    }
+    memcpy(&header, file.GetData(), sizeof(header));
+
+    size_t payloadSize = file.GetSize() - sizeof(header);
+    if (header.magic != kEntryMagic || header.keySize > payloadSize ||
+        header.valueSize != payloadSize - header.keySize) {
+        return EntryStatus::Corrupted;
+    }
+
+    const uint8_t* entryKey = file.GetData() + sizeof(header);
+    const uint8_t* entryValue = entryKey + header.keySize;
+    size_t entryValueSize = static_cast<size_t>(header.valueSize);
+    if (header.checksum != ComputeEntryChecksum(entryKey, static_cast<size_t>(header.keySize),
+                                                entryValue, entryValueSize)) {
+        return EntryStatus::Corrupted;
+    }
+    if (header.keySize != keySize || memcmp(entryKey, key, keySize) != 0) {
+        return EntryStatus::OtherKey;
+    }
+
+    *valueOut = entryValue;
+    *valueSizeOut = entryValueSize;
+    return EntryStatus::Valid;
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<FileCache> FileCache::Create(std::string directory, uint64_t maxSize) {
+    while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\')) {
+        directory.pop_back();
+    }
+    if (directory.empty() || !MakeDirectory(directory)) {
+        dawn::WarningLog() << "Failed to create the cache directory \"" << directory << "\".";
+        return nullptr;
+    }
+
+    std::unique_ptr<FileCache> cache(new FileCache(std::move(directory), maxSize));
+    std::lock_guard<std::mutex> lock(cache->mMutex);
+    cache->EvictEntries();
+    return cache;
+}
+
+FileCache::FileCache(std::string directory, uint64_t maxSize)
+    : mDirectory(std::move(directory)), mMaxSize(maxSize) {}
+
+FileCache::~FileCache() = default;
+
+size_t FileCache::LoadData(const void* key, size_t keySize, void* valueOut, size_t valueSize) {
+    ASSERT(key != nullptr && keySize > 0);
+    ASSERT(valueOut != nullptr || valueSize == 0);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::string path = GetEntryPath(key, keySize);
+
+    std::unique_ptr<MappedFile> file;
+    if (mPendingLoad != nullptr && mPendingLoadPath == path) {
+        file = std::move(mPendingLoad);
+    } else {
+        file = MappedFile::Open(path);
+    }
+    mPendingLoad = nullptr;
+    mPendingLoadPath.clear();
+    if (file == nullptr) {
+        return 0;
+    }
+
+    const uint8_t* entryValue = nullptr;
+    size_t entryValueSize = 0;
+    switch (ValidateEntry(*file, key, keySize, &entryValue, &entryValueSize)) {
+        case EntryStatus::Valid:
+            break;
+        case EntryStatus::OtherKey:
+            return 0;
+        case EntryStatus::Corrupted:
+            // The entry isn't deleted, since another process may have renamed a valid entry to
+            // the same path since it was opened. It is atomically replaced when the value is
+            // stored again after this miss, or evicted.
+            return 0;
+    }
+
+    if (valueOut == nullptr) {
+        mPendingLoadPath = std::move(path);
+        mPendingLoad = std::move(file);
+        return entryValueSize;
+    }
+
+    if (valueSize != entryValueSize) {
+        return 0;
+    }
+    memcpy(valueOut, entryValue, entryValueSize);
+    MarkEntryFileAsUsed(path);
+    return entryValueSize;
+}
+
+void FileCache::StoreData(const void* key, size_t keySize, const void* value, size_t valueSize) {
+    ASSERT(key != nullptr && keySize > 0);
+    ASSERT(value != nullptr && valueSize > 0);
+
+    EntryHeader header;
+    header.magic = kEntryMagic;
+    header.checksum = ComputeEntryChecksum(key, keySize, value, valueSize);
+    header.keySize = keySize;
+    header.valueSize = valueSize;
+
+    uint64_t entrySize = sizeof(header) + uint64_t(keySize) + uint64_t(valueSize);
+    if (entrySize > mMaxSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::string path = GetEntryPath(key, keySize);
+    if (mPendingLoadPath == path) {
+        mPendingLoad = nullptr;
+        mPendingLoadPath.clear();
+    }
+
+    // Write the entry to a file that is unique to this process and only rename it once it is
+    // complete, so that other processes never see a partially written entry.
+    std::string temporaryPath = path + "." + std::to_string(GetCurrentProcessIdentifier()) + "." +
+                                std::to_string(mTemporaryFileCount++) + ".tmp";
+    bool success;
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(static_cast<const char*>(key), keySize);
+        file.write(static_cast<const char*>(value), valueSize);
+        file.close();
+        success = !file.fail();
+    }
+    // The rename replaces any existing entry for this key (or for a key with the same hash), so
+    // its size must no longer be counted.
+    uint64_t replacedSize = GetFileSize(path);
+    if (!success || !RenameFile(temporaryPath, path)) {
+        std::remove(temporaryPath.c_str());
+        return;
+    }
+
+    mTotalSize -= std::min(mTotalSize, replacedSize);
+    mTotalSize += entrySize;
+    if (mTotalSize > mMaxSize) {
+        EvictEntries();
+    }
+}
+
+uint64_t FileCache::GetTotalSizeForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mTotalSize;
+}
+
+std::string FileCache::GetEntryPath(const void* key, size_t keySize) const {
+    char name[17];
+    snprintf(name, sizeof(name), "%016llx",
+             static_cast<unsigned long long>(HashKey(key, keySize)));
+    return mDirectory + GetPathSeparator() + name + kEntryExtension;
+}
+
+void FileCache::EvictEntries() {
+    std::vector<EntryFileInfo> entries = ListEntryFiles(mDirectory);
+
+    uint64_t totalSize = 0;
+    for (const EntryFileInfo& entry : entries) {
+        totalSize += entry.size;
+    }
+
+    // Evict down to 3/4 of the maximum size so that the directory isn't listed again on every
+    // store once the cache is full.
+    if (totalSize > mMaxSize) {
+        uint64_t targetSize = mMaxSize - mMaxSize / 4;
+        std::sort(entries.begin(), entries.end(),
+                  [](const EntryFileInfo& a, const EntryFileInfo& b) {
+                      return a.lastUseTime < b.lastUseTime;
+                  });
+        for (const EntryFileInfo& entry : entries) {
+            if (totalSize <= targetSize) {
+                break;
+            }
+            if (entry.path == mPendingLoadPath) {
+                mPendingLoad = nullptr;
+                mPendingLoadPath.clear();
+            }
+            if (std::remove(entry.path.c_str()) == 0) {
+                totalSize -= entry.size;
+            }
+        }
+    }
+
+    mTotalSize = totalSize;
+}
+
+}  // namespace dawn::native
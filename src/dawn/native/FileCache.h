@@ -0,0 +1,81 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_FILECACHE_H_
+#define SRC_DAWN_NATIVE_FILECACHE_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dawn/platform/DawnPlatform.h"
+
+namespace dawn::native {
+
+class MappedFile;
+
+// A CachingInterface that persists the cache entries as files in a directory, used by the instance
+// when the platform doesn't provide a CachingInterface.
+//  - Each entry is stored in its own file, named after a hash of its key, that contains the full
+//    key and a checksum of the entry. Entries that are truncated or corrupted are ignored until
+//    they are replaced by a new store of their key.
+//  - Entries are written to a temporary file that is then renamed, so several processes can share
+//    the same directory without ever observing partially written entries.
+//  - Entries are memory-mapped when they are loaded.
+//  - When the total size of the entries exceeds the maximum size, the least recently used entries
+//    are deleted. The recency of use is tracked with the modification time of the files so that it
+//    is shared between processes.
+class FileCache final : public dawn::platform::CachingInterface {
+  public:
+    static constexpr uint64_t kDefaultMaxSize = 256ull * 1024 * 1024;
+
+    // Creates |directory| if it doesn't exist. Returns nullptr if the directory cannot be created.
+    static std::unique_ptr<FileCache> Create(std::string directory,
+                                             uint64_t maxSize = kDefaultMaxSize);
+    ~FileCache() override;
+
+    size_t LoadData(const void* key, size_t keySize, void* valueOut, size_t valueSize) override;
+    void StoreData(const void* key, size_t keySize, const void* value, size_t valueSize) override;
+
+    // Returns the path of the file that stores the entry for |key|.
+    std::string GetEntryPath(const void* key, size_t keySize) const;
+
+    uint64_t GetTotalSizeForTesting();
+
+  private:
+    FileCache(std::string directory, uint64_t maxSize);
+
+    // Deletes the least recently used entries of the directory until the total size of the
+    // entries is below the maximum size. Also resynchronizes mTotalSize with the entries written
+    // by other processes.
+    void EvictEntries();
+
+    const std::string mDirectory;
+    const uint64_t mMaxSize;
+
+    std::mutex mMutex;
+    // The total size of the entries in the directory, as last seen by this process.
+    uint64_t mTotalSize = 0;
+    uint64_t mTemporaryFileCount = 0;
+
+    // LoadData is called once to query the size of the entry and then again to copy it. The entry
+    // stays mapped in between so that both calls see the same file even if another process
+    // replaces it.
+    std::string mPendingLoadPath;
+    std::unique_ptr<MappedFile> mPendingLoad;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_FILECACHE_H_
@@ -142,8 +142,16 @@ void IndirectDrawMetadata::AddBundle(RenderBundleBase* bundle) {
         return;
     }
 
-    for (const auto& [config, validationInfo] :
-         bundle->GetIndirectDrawMetadata().mIndexedIndirectBufferValidationInfo) {
+    AddValidationInfo(bundle->GetIndirectDrawMetadata().mIndexedIndirectBufferValidationInfo);
+}
+
+void IndirectDrawMetadata::AddSecondaryPass(const IndirectDrawMetadata& secondaryPass) {
+    AddValidationInfo(secondaryPass.mIndexedIndirectBufferValidationInfo);
+}
+
+void IndirectDrawMetadata::AddValidationInfo(
+    const IndexedIndirectBufferValidationInfoMap& validationInfoMap) {
+    for (const auto& [config, validationInfo] : validationInfoMap) {
         auto it = mIndexedIndirectBufferValidationInfo.lower_bound(config);
         if (it != mIndexedIndirectBufferValidationInfo.end() && it->first == config) {
             // We already have batches for the same config. Merge the new ones in.
@@ -118,6 +118,8 @@ class IndirectDrawMetadata : public NonCopyable {
     IndexedIndirectBufferValidationInfoMap* GetIndexedIndirectBufferValidationInfo();
 
     void AddBundle(RenderBundleBase* bundle);
+    // Adds the draws of a secondary render pass encoder of this render pass.
+    void AddSecondaryPass(const IndirectDrawMetadata& secondaryPass);
     void AddIndexedIndirectDraw(wgpu::IndexFormat indexFormat,
                                 uint64_t indexBufferSize,
                                 BufferBase* indirectBuffer,
@@ -131,6 +133,8 @@ class IndirectDrawMetadata : public NonCopyable {
                          DrawIndirectCmd* cmd);
 
   private:
+    void AddValidationInfo(const IndexedIndirectBufferValidationInfoMap& validationInfoMap);
+
     IndexedIndirectBufferValidationInfoMap mIndexedIndirectBufferValidationInfo;
     std::set<RenderBundleBase*> mAddedBundles;
 
@@ -24,6 +24,7 @@
 #include "dawn/native/ChainUtils_autogen.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/ErrorData.h"
+#include "dawn/native/FileCache.h"
 #include "dawn/native/Surface.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
@@ -170,6 +171,12 @@ MaybeError InstanceBase::Initialize(const InstanceDescriptor* descriptor) {
         for (uint32_t i = 0; i < dawnDesc->additionalRuntimeSearchPathsCount; ++i) {
             mRuntimeSearchPaths.push_back(dawnDesc->additionalRuntimeSearchPaths[i]);
         }
+        if (dawnDesc->blobCacheDirectory != nullptr) {
+            uint64_t maxSize = dawnDesc->blobCacheMaxSize != 0 ? dawnDesc->blobCacheMaxSize
+                                                                : FileCache::kDefaultMaxSize;
+            mFileCache = FileCache::Create(dawnDesc->blobCacheDirectory, maxSize);
+        }
+        mBlobCacheAsyncStores = dawnDesc->blobCacheAsyncStores;
     }
     // Default paths to search are next to the shared library, next to the executable, and
     // no path (just libvulkan.so).
@@ -503,7 +510,12 @@ void InstanceBase::SetPlatform(dawn::platform::Platform* platform) {
     } else {
         mPlatform = platform;
     }
-    mBlobCache = std::make_unique<BlobCache>(GetCachingInterface(platform));
+    // Fall back to the file cache of the instance, if any, when the platform doesn't cache.
+    dawn::platform::CachingInterface* cachingInterface = GetCachingInterface(platform);
+    if (cachingInterface == nullptr) {
+        cachingInterface = mFileCache.get();
+    }
+    mBlobCache = std::make_unique<BlobCache>(cachingInterface, mPlatform, mBlobCacheAsyncStores);
 }
 
 void InstanceBase::SetPlatformForTesting(dawn::platform::Platform* platform) {
@@ -521,6 +533,10 @@ BlobCache* InstanceBase::GetBlobCache(bool enabled) {
     return &mPassthroughBlobCache;
 }
 
+TintProgramCache* InstanceBase::GetTintProgramCache() {
+    return &mTintProgramCache;
+}
+
 uint64_t InstanceBase::GetDeviceCountForTesting() const {
     std::lock_guard<std::mutex> lg(mDevicesListMutex);
     return mDevicesList.size();
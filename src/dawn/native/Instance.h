@@ -30,6 +30,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Features.h"
 #include "dawn/native/RefCountedWithExternalCount.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/dawn_platform.h"
 
@@ -41,6 +42,7 @@ namespace dawn::native {
 
 class CallbackTaskManager;
 class DeviceBase;
+class FileCache;
 class Surface;
 class XlibXcbFunctions;
 
@@ -105,6 +107,7 @@ class InstanceBase final : public RefCountedWithExternalCount {
     void SetPlatformForTesting(dawn::platform::Platform* platform);
     dawn::platform::Platform* GetPlatform();
     BlobCache* GetBlobCache(bool enabled = true);
+    TintProgramCache* GetTintProgramCache();
 
     uint64_t GetDeviceCountForTesting() const;
     void AddDevice(DeviceBase* device);
@@ -153,9 +156,14 @@ class InstanceBase final : public RefCountedWithExternalCount {
 
     dawn::platform::Platform* mPlatform = nullptr;
     std::unique_ptr<dawn::platform::Platform> mDefaultPlatform;
+    // Cache used as the CachingInterface of mBlobCache when the platform doesn't provide one.
+    std::unique_ptr<FileCache> mFileCache;
+    bool mBlobCacheAsyncStores = false;
     std::unique_ptr<BlobCache> mBlobCache;
     BlobCache mPassthroughBlobCache;
 
+    TintProgramCache mTintProgramCache;
+
     std::vector<std::unique_ptr<BackendConnection>> mBackends;
     std::vector<Ref<AdapterBase>> mAdapters;
 
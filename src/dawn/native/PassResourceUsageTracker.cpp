@@ -145,6 +145,20 @@ void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
     }
 }
 
+void SyncScopeUsageTracker::AddSyncScopeUsage(const SyncScopeResourceUsage& usage) {
+    for (size_t i = 0; i < usage.buffers.size(); ++i) {
+        BufferUsedAs(usage.buffers[i], usage.bufferUsages[i]);
+    }
+
+    for (size_t i = 0; i < usage.textures.size(); ++i) {
+        AddRenderBundleTextureUsage(usage.textures[i], usage.textureUsages[i]);
+    }
+
+    for (ExternalTextureBase* externalTexture : usage.externalTextures) {
+        mExternalTextureUsages.insert(externalTexture);
+    }
+}
+
 SyncScopeResourceUsage SyncScopeUsageTracker::AcquireSyncScopeUsage() {
     SyncScopeResourceUsage result;
     result.buffers.reserve(mBufferUsages.size());
@@ -50,6 +50,10 @@ class SyncScopeUsageTracker {
     // Walks the bind groups and tracks all its resources.
     void AddBindGroup(BindGroupBase* group);
 
+    // Merges the usages of another synchronization scope recorded for the same render pass, like
+    // the one of a secondary render pass encoder.
+    void AddSyncScopeUsage(const SyncScopeResourceUsage& usage);
+
     // Returns the per-pass usage for use by backends for APIs with explicit barriers.
     SyncScopeResourceUsage AcquireSyncScopeUsage();
 
@@ -66,6 +66,25 @@ PipelineLayoutBase::PipelineLayoutBase(DeviceBase* device,
         mBindGroupLayouts[group] = descriptor->bindGroupLayouts[static_cast<uint32_t>(group)];
         mMask.set(group);
     }
+
+    // Aliasing is only possible between two writable storage buffers or two write-only storage
+    // textures.
+    uint32_t writableStorageBufferCount = 0;
+    uint32_t storageTextureCount = 0;
+    for (BindGroupIndex group : IterateBitSet(mMask)) {
+        const BindGroupLayoutBase* bgl = mBindGroupLayouts[group].Get();
+        for (BindingIndex bindingIndex{0}; bindingIndex < bgl->GetBindingCount(); ++bindingIndex) {
+            const BindingInfo& bindingInfo = bgl->GetBindingInfo(bindingIndex);
+            if (bindingInfo.bindingType == BindingInfoType::Buffer &&
+                bindingInfo.buffer.type == wgpu::BufferBindingType::Storage) {
+                writableStorageBufferCount++;
+            } else if (bindingInfo.bindingType == BindingInfoType::StorageTexture) {
+                storageTextureCount++;
+            }
+        }
+    }
+    mHasPotentialWritableBindingAliasing =
+        writableStorageBufferCount > 1 || storageTextureCount > 1;
 }
 
 PipelineLayoutBase::PipelineLayoutBase(DeviceBase* device,
@@ -373,6 +392,11 @@ BindGroupIndex PipelineLayoutBase::GroupsInheritUpTo(const PipelineLayoutBase* o
     return kMaxBindGroupsTyped;
 }
 
+bool PipelineLayoutBase::HasPotentialWritableBindingAliasing() const {
+    ASSERT(!IsError());
+    return mHasPotentialWritableBindingAliasing;
+}
+
 size_t PipelineLayoutBase::ComputeContentHash() {
     ObjectContentHasher recorder;
     recorder.Record(mMask);
@@ -76,6 +76,10 @@ class PipelineLayoutBase : public ApiObjectBase, public CachedObject {
     // [0, kMaxBindGroups]
     BindGroupIndex GroupsInheritUpTo(const PipelineLayoutBase* other) const;
 
+    // Returns whether writable storage bindings of the layout could alias each other, in which
+    // case draws and dispatches must check the bound resources for aliasing.
+    bool HasPotentialWritableBindingAliasing() const;
+
     // Functions necessary for the unordered_set<PipelineLayoutBase*>-based cache.
     size_t ComputeContentHash() override;
 
@@ -89,6 +93,7 @@ class PipelineLayoutBase : public ApiObjectBase, public CachedObject {
 
     BindGroupLayoutArray mBindGroupLayouts;
     BindGroupLayoutMask mMask;
+    bool mHasPotentialWritableBindingAliasing = false;
 };
 
 }  // namespace dawn::native
@@ -308,6 +308,14 @@ MaybeError QueueBase::WriteBufferImpl(BufferBase* buffer,
 
     DeviceBase* device = GetDevice();
 
+    // When the buffer's memory is accessible by the CPU and all the GPU work using it completed,
+    // copy the data in place instead of copying it to a staging buffer and then on the GPU.
+    if (device->CanWriteBufferDirectly(buffer) &&
+        buffer->GetLastUsageSerial() <= device->GetCompletedCommandSerial()) {
+        WriteBufferDirectly(buffer, bufferOffset, data, size);
+        return {};
+    }
+
     UploadHandle uploadHandle;
     DAWN_TRY_ASSIGN(uploadHandle,
                     device->GetDynamicUploader()->Allocate(size, device->GetPendingCommandSerial(),
@@ -320,6 +328,22 @@ MaybeError QueueBase::WriteBufferImpl(BufferBase* buffer,
                                            buffer, bufferOffset, size);
 }
 
+void QueueBase::WriteBufferDirectly(BufferBase* buffer,
+                                    uint64_t bufferOffset,
+                                    const void* data,
+                                    size_t size) {
+    uint8_t* mappedPointer = static_cast<uint8_t*>(buffer->GetMappedPointer());
+    ASSERT(mappedPointer != nullptr);
+
+    // The lazy clear of the buffer can be done on the CPU as well since the GPU isn't using it.
+    if (buffer->NeedsInitialization() && !buffer->IsFullBufferRange(bufferOffset, size)) {
+        memset(mappedPointer, 0, buffer->GetSize());
+    }
+    buffer->SetIsDataInitialized();
+
+    memcpy(mappedPointer + bufferOffset, data, size);
+}
+
 void QueueBase::APIWriteTexture(const ImageCopyTexture* destination,
                                 const void* data,
                                 size_t dataSize,
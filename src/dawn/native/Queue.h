@@ -111,6 +111,12 @@ class QueueBase : public ApiObjectBase {
                                         const void* data,
                                         const TextureDataLayout& dataLayout,
                                         const Extent3D& writeSize);
+    // Copies the data directly into the mapped memory of |buffer|, which must not be used by the
+    // GPU anymore.
+    void WriteBufferDirectly(BufferBase* buffer,
+                             uint64_t bufferOffset,
+                             const void* data,
+                             size_t size);
 
     MaybeError ValidateSubmit(uint32_t commandCount, CommandBufferBase* const* commands) const;
     MaybeError ValidateOnSubmittedWorkDone(uint64_t signalValue,
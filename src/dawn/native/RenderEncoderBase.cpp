@@ -80,6 +80,12 @@ uint64_t RenderEncoderBase::GetDrawCount() const {
     return mDrawCount;
 }
 
+Ref<AttachmentState> RenderEncoderBase::GetAttachmentStateRef() const {
+    ASSERT(!IsError());
+    ASSERT(mAttachmentState != nullptr);
+    return mAttachmentState;
+}
+
 Ref<AttachmentState> RenderEncoderBase::AcquireAttachmentState() {
     return std::move(mAttachmentState);
 }
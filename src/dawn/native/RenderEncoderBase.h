@@ -71,6 +71,9 @@ class RenderEncoderBase : public ProgrammableEncoder {
 
     void DestroyImpl() override;
 
+    // Returns a new reference to the attachment state for another encoder of the same pass.
+    Ref<AttachmentState> GetAttachmentStateRef() const;
+
     CommandBufferStateTracker mCommandBufferState;
     RenderPassResourceUsageTracker mUsageTracker;
     IndirectDrawMetadata mIndirectDrawMetadata;
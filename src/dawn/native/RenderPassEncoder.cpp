@@ -105,6 +105,20 @@ RenderPassEncoder::RenderPassEncoder(DeviceBase* device,
                                      ErrorTag errorTag)
     : RenderEncoderBase(device, encodingContext, errorTag), mCommandEncoder(commandEncoder) {}
 
+RenderPassEncoder::RenderPassEncoder(DeviceBase* device,
+                                     const RenderPassEncoder* primaryEncoder,
+                                     EncodingContext* encodingContext)
+    : RenderEncoderBase(device,
+                        nullptr,
+                        encodingContext,
+                        primaryEncoder->GetAttachmentStateRef(),
+                        primaryEncoder->IsDepthReadOnly(),
+                        primaryEncoder->IsStencilReadOnly()),
+      mCommandEncoder(primaryEncoder->mCommandEncoder),
+      mRenderTargetWidth(primaryEncoder->mRenderTargetWidth),
+      mRenderTargetHeight(primaryEncoder->mRenderTargetHeight),
+      mMaxDrawCount(primaryEncoder->mMaxDrawCount) {}
+
 // static
 Ref<RenderPassEncoder> RenderPassEncoder::MakeError(DeviceBase* device,
                                                     CommandEncoder* commandEncoder,
@@ -135,7 +149,15 @@ void RenderPassEncoder::TrackQueryAvailability(QuerySetBase* querySet, uint32_t
     mCommandEncoder->TrackQueryAvailability(querySet, queryIndex);
 }
 
+bool RenderPassEncoder::IsSecondary() const {
+    return false;
+}
+
 void RenderPassEncoder::APIEnd() {
+    End();
+}
+
+void RenderPassEncoder::End() {
     if (mEnded && IsValidationEnabled()) {
         GetDevice()->HandleError(DAWN_VALIDATION_ERROR("%s was already ended.", this));
         return;
@@ -146,6 +168,8 @@ void RenderPassEncoder::APIEnd() {
     mEncodingContext->TryEncode(
         this,
         [&](CommandAllocator* allocator) -> MaybeError {
+            DAWN_TRY(AppendSecondaryEncoders());
+
             if (IsValidationEnabled()) {
                 DAWN_TRY(ValidateProgrammableEncoderEnd());
 
@@ -173,6 +197,42 @@ void RenderPassEncoder::APIEnd() {
     }
 }
 
+MaybeError RenderPassEncoder::AppendSecondaryEncoders() {
+    for (Ref<SecondaryRenderPassEncoder>& secondaryEncoder : mSecondaryEncoders) {
+        // The secondary encoder may still be recorded on another thread until it is ended, so
+        // this is checked even when validation is disabled.
+        DAWN_INVALID_IF(!secondaryEncoder->mSecondaryEnded.load(std::memory_order_acquire),
+                        "Secondary encoder %s was not ended before %s.", secondaryEncoder.Get(),
+                        this);
+
+        if (secondaryEncoder->mError != nullptr) {
+            return std::move(secondaryEncoder->mError);
+        }
+
+        mUsageTracker.AddSyncScopeUsage(secondaryEncoder->mUsageTracker.AcquireResourceUsage());
+
+        if (IsValidationEnabled()) {
+            mIndirectDrawMetadata.AddSecondaryPass(secondaryEncoder->mIndirectDrawMetadata);
+        }
+
+        mDrawCount += secondaryEncoder->mDrawCount;
+
+        mEncodingContext->AppendSecondaryCommands(&secondaryEncoder->mSecondaryEncodingContext);
+    }
+    mSecondaryEncoders.clear();
+
+    return {};
+}
+
+void RenderPassEncoder::SetDefaultDynamicState() {
+    APISetViewport(0, 0, static_cast<float>(mRenderTargetWidth),
+                   static_cast<float>(mRenderTargetHeight), 0, 1);
+    APISetScissorRect(0, 0, mRenderTargetWidth, mRenderTargetHeight);
+    Color blendConstant = {0, 0, 0, 0};
+    APISetBlendConstant(&blendConstant);
+    APISetStencilReference(0);
+}
+
 void RenderPassEncoder::APIEndPass() {
     if (GetDevice()->ConsumedError(DAWN_MAKE_DEPRECATION_ERROR(
             GetDevice(), "endPass() has been deprecated. Use end() instead."))) {
@@ -181,6 +241,25 @@ void RenderPassEncoder::APIEndPass() {
     APIEnd();
 }
 
+RenderPassEncoder* RenderPassEncoder::APICreateSecondaryEncoder() {
+    bool success = mEncodingContext->TryEncode(
+        this,
+        [&](CommandAllocator*) -> MaybeError {
+            // The secondary encoders are only appended to the primary encoder.
+            DAWN_INVALID_IF(IsSecondary(), "%s is a secondary encoder.", this);
+            return {};
+        },
+        "encoding %s.CreateSecondaryEncoder().", this);
+
+    // Error encoders are tracked too, so that their errors are reported when this encoder is
+    // ended, like the ones of the other secondary encoders.
+    Ref<SecondaryRenderPassEncoder> secondaryEncoder =
+        success ? SecondaryRenderPassEncoder::Create(GetDevice(), this)
+                : SecondaryRenderPassEncoder::MakeError(GetDevice(), mCommandEncoder.Get());
+    mSecondaryEncoders.push_back(secondaryEncoder);
+    return secondaryEncoder.Detach();
+}
+
 void RenderPassEncoder::APISetStencilReference(uint32_t reference) {
     mEncodingContext->TryEncode(
         this,
@@ -355,6 +434,10 @@ void RenderPassEncoder::APIBeginOcclusionQuery(uint32_t queryIndex) {
         this,
         [&](CommandAllocator* allocator) -> MaybeError {
             if (IsValidationEnabled()) {
+                DAWN_INVALID_IF(IsSecondary(),
+                                "Occlusion queries cannot be used in secondary encoder %s.",
+                                this);
+
                 DAWN_INVALID_IF(mOcclusionQuerySet.Get() == nullptr,
                                 "The occlusionQuerySet in RenderPassDescriptor is not set.");
 
@@ -395,6 +478,9 @@ void RenderPassEncoder::APIEndOcclusionQuery() {
         this,
         [&](CommandAllocator* allocator) -> MaybeError {
             if (IsValidationEnabled()) {
+                DAWN_INVALID_IF(IsSecondary(),
+                                "Occlusion queries cannot be used in secondary encoder %s.",
+                                this);
                 DAWN_INVALID_IF(!mOcclusionQueryActive, "No occlusion queries are active.");
             }
 
@@ -417,6 +503,8 @@ void RenderPassEncoder::APIWriteTimestamp(QuerySetBase* querySet, uint32_t query
         this,
         [&](CommandAllocator* allocator) -> MaybeError {
             if (IsValidationEnabled()) {
+                DAWN_INVALID_IF(IsSecondary(),
+                                "Timestamps cannot be written in secondary encoder %s.", this);
                 DAWN_TRY(ValidateTimestampQuery(GetDevice(), querySet, queryIndex,
                                                 Feature::TimestampQueryInsidePasses));
                 DAWN_TRY_CONTEXT(ValidateQueryIndexOverwrite(
@@ -437,4 +525,73 @@ void RenderPassEncoder::APIWriteTimestamp(QuerySetBase* querySet, uint32_t query
         "encoding %s.WriteTimestamp(%s, %u).", this, querySet, queryIndex);
 }
 
+// static
+Ref<SecondaryRenderPassEncoder> SecondaryRenderPassEncoder::Create(
+    DeviceBase* device,
+    const RenderPassEncoder* primaryEncoder) {
+    return AcquireRef(new SecondaryRenderPassEncoder(device, primaryEncoder));
+}
+
+// static
+Ref<SecondaryRenderPassEncoder> SecondaryRenderPassEncoder::MakeError(
+    DeviceBase* device,
+    CommandEncoder* commandEncoder) {
+    return AcquireRef(new SecondaryRenderPassEncoder(device, commandEncoder, ObjectBase::kError));
+}
+
+SecondaryRenderPassEncoder::SecondaryRenderPassEncoder(DeviceBase* device,
+                                                       const RenderPassEncoder* primaryEncoder)
+    : RenderPassEncoder(device, primaryEncoder, &mSecondaryEncodingContext),
+      mSecondaryEncodingContext(device, this) {
+    // Don't depend on the dynamic state left by the commands spliced before this encoder's.
+    SetDefaultDynamicState();
+    GetObjectTrackingList()->Track(this);
+}
+
+SecondaryRenderPassEncoder::SecondaryRenderPassEncoder(DeviceBase* device,
+                                                       CommandEncoder* commandEncoder,
+                                                       ErrorTag errorTag)
+    : RenderPassEncoder(device, commandEncoder, &mSecondaryEncodingContext, errorTag),
+      mSecondaryEncodingContext(device, this) {
+    mSecondaryEncodingContext.HandleError(DAWN_VALIDATION_ERROR("%s is invalid.", this));
+}
+
+void SecondaryRenderPassEncoder::DestroyImpl() {
+    RenderPassEncoder::DestroyImpl();
+    mSecondaryEncodingContext.Destroy();
+}
+
+bool SecondaryRenderPassEncoder::IsSecondary() const {
+    return true;
+}
+
+void SecondaryRenderPassEncoder::End() {
+    if (mEnded) {
+        if (IsValidationEnabled()) {
+            mSecondaryEncodingContext.HandleError(
+                DAWN_VALIDATION_ERROR("%s was already ended.", this));
+        }
+        return;
+    }
+
+    mEnded = true;
+
+    mSecondaryEncodingContext.TryEncode(
+        this,
+        [&](CommandAllocator*) -> MaybeError {
+            if (IsValidationEnabled()) {
+                DAWN_TRY(ValidateProgrammableEncoderEnd());
+            }
+            return {};
+        },
+        "encoding %s.End().", this);
+
+    // Errors are reported when the primary encoder is ended.
+    MaybeError result = mSecondaryEncodingContext.Finish();
+    if (result.IsError()) {
+        mError = result.AcquireError();
+    }
+    mSecondaryEnded.store(true, std::memory_order_release);
+}
+
 }  // namespace dawn::native
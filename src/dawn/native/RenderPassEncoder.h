@@ -15,17 +15,22 @@
 #ifndef SRC_DAWN_NATIVE_RENDERPASSENCODER_H_
 #define SRC_DAWN_NATIVE_RENDERPASSENCODER_H_
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
+#include "dawn/native/EncodingContext.h"
 #include "dawn/native/Error.h"
+#include "dawn/native/ErrorData.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/RenderEncoderBase.h"
 
 namespace dawn::native {
 
 class RenderBundleBase;
+class SecondaryRenderPassEncoder;
 
-class RenderPassEncoder final : public RenderEncoderBase {
+class RenderPassEncoder : public RenderEncoderBase {
   public:
     static Ref<RenderPassEncoder> Create(DeviceBase* device,
                                          const RenderPassDescriptor* descriptor,
@@ -63,6 +68,11 @@ class RenderPassEncoder final : public RenderEncoderBase {
 
     void APIWriteTimestamp(QuerySetBase* querySet, uint32_t queryIndex);
 
+    // Secondary encoders record commands for this render pass in their own encoding context, so
+    // that several threads can encode parts of the pass at the same time. Their commands are
+    // spliced after the commands of this encoder, in creation order, when this encoder is ended.
+    RenderPassEncoder* APICreateSecondaryEncoder();
+
   protected:
     RenderPassEncoder(DeviceBase* device,
                       const RenderPassDescriptor* descriptor,
@@ -79,12 +89,26 @@ class RenderPassEncoder final : public RenderEncoderBase {
                       CommandEncoder* commandEncoder,
                       EncodingContext* encodingContext,
                       ErrorTag errorTag);
+    // Constructor for the secondary encoders of |primaryEncoder|.
+    RenderPassEncoder(DeviceBase* device,
+                      const RenderPassEncoder* primaryEncoder,
+                      EncodingContext* encodingContext);
 
-  private:
     void DestroyImpl() override;
 
+    virtual void End();
+    virtual bool IsSecondary() const;
+
+    // Encodes the values that the viewport, scissor rect, blend constant and stencil reference
+    // have at the start of the pass.
+    void SetDefaultDynamicState();
+
+  private:
     void TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex);
 
+    // Merges the state and commands of the secondary encoders in this pass.
+    MaybeError AppendSecondaryEncoders();
+
     // For render and compute passes, the encoding context is borrowed from the command encoder.
     // Keep a reference to the encoder to make sure the context isn't freed.
     Ref<CommandEncoder> mCommandEncoder;
@@ -101,6 +125,36 @@ class RenderPassEncoder final : public RenderEncoderBase {
     uint64_t mMaxDrawCount = 50000000;
 
     std::function<void()> mEndCallback;
+
+    std::vector<Ref<SecondaryRenderPassEncoder>> mSecondaryEncoders;
+};
+
+class SecondaryRenderPassEncoder final : public RenderPassEncoder {
+  public:
+    static Ref<SecondaryRenderPassEncoder> Create(DeviceBase* device,
+                                                  const RenderPassEncoder* primaryEncoder);
+    static Ref<SecondaryRenderPassEncoder> MakeError(DeviceBase* device,
+                                                     CommandEncoder* commandEncoder);
+
+  private:
+    friend class RenderPassEncoder;
+
+    SecondaryRenderPassEncoder(DeviceBase* device, const RenderPassEncoder* primaryEncoder);
+    SecondaryRenderPassEncoder(DeviceBase* device,
+                               CommandEncoder* commandEncoder,
+                               ErrorTag errorTag);
+
+    void DestroyImpl() override;
+
+    void End() override;
+    bool IsSecondary() const override;
+
+    EncodingContext mSecondaryEncodingContext;
+
+    // Set by End() on the thread that records this encoder. The primary encoder only reads the
+    // state and commands of this encoder from its own thread once it is set.
+    std::atomic<bool> mSecondaryEnded{false};
+    std::unique_ptr<ErrorData> mError;
 };
 
 }  // namespace dawn::native
@@ -29,6 +29,8 @@
 #include "dawn/native/PipelineLayout.h"
 #include "dawn/native/RenderPipeline.h"
 #include "dawn/native/TintUtils.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 #include "tint/tint.h"
 
@@ -298,23 +300,6 @@ EntryPointMetadata::Override::Type FromTintOverrideType(tint::inspector::Overrid
     UNREACHABLE();
 }
 
-ResultOrError<tint::Program> ParseWGSL(const tint::Source::File* file,
-                                       OwnedCompilationMessages* outMessages) {
-#if TINT_BUILD_WGSL_READER
-    tint::Program program = tint::reader::wgsl::Parse(file);
-    if (outMessages != nullptr) {
-        DAWN_TRY(outMessages->AddMessages(program.Diagnostics()));
-    }
-    if (!program.IsValid()) {
-        return DAWN_VALIDATION_ERROR("Tint WGSL reader failure: %s\n", program.Diagnostics().str());
-    }
-
-    return std::move(program);
-#else
-    return DAWN_VALIDATION_ERROR("TINT_BUILD_WGSL_READER is not defined.");
-#endif
-}
-
 #if TINT_BUILD_SPV_READER
 ResultOrError<tint::Program> ParseSPIRV(const std::vector<uint32_t>& spirv,
                                         OwnedCompilationMessages* outMessages,
@@ -891,16 +876,6 @@ bool ShaderModuleParseResult::HasParsedShader() const {
     return tintProgram != nullptr;
 }
 
-// TintSource is a PIMPL container for a tint::Source::File, which needs to be kept alive for as
-// long as tint diagnostics are inspected / printed.
-class TintSource {
-  public:
-    template <typename... ARGS>
-    explicit TintSource(ARGS&&... args) : file(std::forward<ARGS>(args)...) {}
-
-    tint::Source::File file;
-};
-
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
                                         const ShaderModuleDescriptor* descriptor,
                                         ShaderModuleParseResult* parseResult,
@@ -948,7 +923,10 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 #if TINT_BUILD_WGSL_WRITER
         std::vector<uint32_t> spirv(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
         tint::Program program;
-        DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
+        {
+            TRACE_EVENT0(device->GetPlatform(), General, "tint::reader::spirv::Parse");
+            DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
+        }
 
         tint::writer::wgsl::Options options;
         auto result = tint::writer::wgsl::Generate(&program, options);
@@ -972,7 +950,8 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
         std::vector<uint32_t> spirv(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
         tint::Program program;
         DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
-        parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
+        parseResult->tintProgram =
+            TintProgram::Create(std::make_unique<tint::Program>(std::move(program)));
 
         return {};
     }
@@ -980,20 +959,35 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 
     ASSERT(wgslDesc != nullptr);
 
-    auto tintSource = std::make_unique<TintSource>("", wgslDesc->source);
-
     if (device->IsToggleEnabled(Toggle::DumpShaders)) {
         std::ostringstream dumpedMsg;
         dumpedMsg << "// Dumped WGSL:" << std::endl << wgslDesc->source;
         device->EmitLog(WGPULoggingType_Info, dumpedMsg.str().c_str());
     }
 
-    tint::Program program;
-    DAWN_TRY_ASSIGN(program, ParseWGSL(&tintSource->file, outMessages));
-    parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
-    parseResult->tintSource = std::move(tintSource);
+#if TINT_BUILD_WGSL_READER
+    // Devices of the same instance share the programs parsed from identical sources.
+    Ref<TintProgram> program;
+    {
+        TRACE_EVENT0(device->GetPlatform(), General, "tint::reader::wgsl::Parse");
+        TintProgramCache* programCache = device->GetTintProgramCache();
+        if (programCache != nullptr) {
+            program = programCache->GetOrCreate(wgslDesc->source);
+        } else {
+            program = TintProgram::CreateFromWGSL(wgslDesc->source);
+        }
+    }
+    if (outMessages != nullptr) {
+        DAWN_TRY(outMessages->AddMessages(program->GetDiagnostics()));
+    }
+    DAWN_INVALID_IF(!program->IsValid(), "Tint WGSL reader failure: %s\n",
+                    program->GetDiagnostics().str());
+    parseResult->tintProgram = std::move(program);
 
     return {};
+#else
+    return DAWN_VALIDATION_ERROR("TINT_BUILD_WGSL_READER is not defined.");
+#endif
 }
 
 RequiredBufferSizes ComputeRequiredBufferSizesForLayout(const EntryPointMetadata& entryPoint,
@@ -1154,8 +1148,8 @@ bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
 }
 
 const tint::Program* ShaderModuleBase::GetTintProgram() const {
-    ASSERT(mTintProgram);
-    return mTintProgram.get();
+    ASSERT(mTintProgram != nullptr);
+    return mTintProgram->GetProgram();
 }
 
 void ShaderModuleBase::APIGetCompilationInfo(wgpu::CompilationInfoCallback callback,
@@ -1207,9 +1201,8 @@ OwnedCompilationMessages* ShaderModuleBase::GetCompilationMessages() const {
 MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult,
                                             OwnedCompilationMessages* compilationMessages) {
     mTintProgram = std::move(parseResult->tintProgram);
-    mTintSource = std::move(parseResult->tintSource);
 
-    DAWN_TRY(ReflectShaderUsingTint(GetDevice(), mTintProgram.get(), compilationMessages,
+    DAWN_TRY(ReflectShaderUsingTint(GetDevice(), mTintProgram->GetProgram(), compilationMessages,
                                     &mEntryPoints, &mEnabledWGSLExtensions));
     return {};
 }
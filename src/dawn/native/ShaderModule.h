@@ -36,6 +36,7 @@
 #include "dawn/native/Limits.h"
 #include "dawn/native/ObjectBase.h"
 #include "dawn/native/PerStage.h"
+#include "dawn/native/TintProgramCache.h"
 #include "dawn/native/VertexFormat.h"
 #include "dawn/native/dawn_platform.h"
 #include "tint/override_id.h"
@@ -86,9 +87,6 @@ using PipelineConstantEntries = std::map<std::string, double>;
 using EntryPointMetadataTable =
     std::unordered_map<std::string, std::unique_ptr<EntryPointMetadata>>;
 
-// Source for a tint program
-class TintSource;
-
 struct ShaderModuleParseResult {
     ShaderModuleParseResult();
     ~ShaderModuleParseResult();
@@ -97,8 +95,7 @@ struct ShaderModuleParseResult {
 
     bool HasParsedShader() const;
 
-    std::unique_ptr<tint::Program> tintProgram;
-    std::unique_ptr<TintSource> tintSource;
+    Ref<TintProgram> tintProgram;
 };
 
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
@@ -302,8 +299,8 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
 
     EntryPointMetadataTable mEntryPoints;
     WGSLExtensionSet mEnabledWGSLExtensions;
-    std::unique_ptr<tint::Program> mTintProgram;
-    std::unique_ptr<TintSource> mTintSource;  // Keep the tint::Source::File alive
+    // May be shared with shader modules of other devices through the TintProgramCache.
+    Ref<TintProgram> mTintProgram;
 
     std::unique_ptr<OwnedCompilationMessages> mCompilationMessages;
 };
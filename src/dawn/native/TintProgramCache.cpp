@@ -0,0 +1,173 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/TintProgramCache.h"
+
+#include <string>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "tint/tint.h"
+
+namespace dawn::native {
+
+namespace {
+
+// Rough per-node costs used to estimate the memory used by a program. AST and semantic nodes are
+// allocated in blocks and vary in size, so these are averages rather than exact sizes.
+constexpr size_t kEstimatedASTNodeSize = 96;
+constexpr size_t kEstimatedSemNodeSize = 128;
+
+}  // namespace
+
+// TintSource is a PIMPL container for a tint::Source::File, which needs to be kept alive for as
+// long as tint diagnostics are inspected / printed.
+class TintSource {
+  public:
+    template <typename... ARGS>
+    explicit TintSource(ARGS&&... args) : file(std::forward<ARGS>(args)...) {}
+
+    tint::Source::File file;
+};
+
+// static
+Ref<TintProgram> TintProgram::CreateFromWGSL(std::string_view wgsl) {
+    auto source = std::make_unique<TintSource>("", std::string(wgsl));
+#if TINT_BUILD_WGSL_READER
+    auto program = std::make_unique<tint::Program>(tint::reader::wgsl::Parse(&source->file));
+#else
+    UNREACHABLE();
+    auto program = std::make_unique<tint::Program>();
+#endif
+    return AcquireRef(new TintProgram(std::move(source), std::move(program)));
+}
+
+// static
+Ref<TintProgram> TintProgram::Create(std::unique_ptr<tint::Program> program) {
+    return AcquireRef(new TintProgram(nullptr, std::move(program)));
+}
+
+TintProgram::TintProgram(std::unique_ptr<TintSource> source, std::unique_ptr<tint::Program> program)
+    : mSource(std::move(source)), mProgram(std::move(program)) {
+    mEstimatedSize = sizeof(TintProgram) + sizeof(tint::Program) +
+                     mProgram->ASTNodes().Count() * kEstimatedASTNodeSize +
+                     mProgram->SemNodes().Count() * kEstimatedSemNodeSize;
+    if (mSource != nullptr) {
+        mEstimatedSize += mSource->file.content.data.size() +
+                          mSource->file.content.lines.size() * sizeof(std::string_view);
+    }
+}
+
+TintProgram::~TintProgram() {
+    // Destroy the program before the source it points into.
+    mProgram = nullptr;
+}
+
+const tint::Program* TintProgram::GetProgram() const {
+    return mProgram.get();
+}
+
+bool TintProgram::IsValid() const {
+    return mProgram->IsValid();
+}
+
+const tint::diag::List& TintProgram::GetDiagnostics() const {
+    return mProgram->Diagnostics();
+}
+
+std::string_view TintProgram::GetSource() const {
+    if (mSource == nullptr) {
+        return {};
+    }
+    return mSource->file.content.data;
+}
+
+size_t TintProgram::GetEstimatedSize() const {
+    return mEstimatedSize;
+}
+
+TintProgramCache::TintProgramCache(size_t maxSize) : mMaxSize(maxSize) {}
+
+TintProgramCache::~TintProgramCache() = default;
+
+Ref<TintProgram> TintProgramCache::GetOrCreate(std::string_view wgsl) {
+    bool enabled;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Don't count the lookups while the cache is disabled.
+        enabled = mMaxSize > 0;
+        if (enabled) {
+            auto it = mPrograms.find(wgsl);
+            if (it != mPrograms.end()) {
+                mHitCount++;
+                mLRU.splice(mLRU.begin(), mLRU, it->second);
+                return *it->second;
+            }
+            mMissCount++;
+        }
+    }
+
+    Ref<TintProgram> program = TintProgram::CreateFromWGSL(wgsl);
+    if (!enabled || !program->IsValid()) {
+        return program;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (program->GetEstimatedSize() > mMaxSize) {
+        return program;
+    }
+    // Another thread may have parsed the same source in the meantime. Use its program so that
+    // all the shader modules share a single one.
+    auto it = mPrograms.find(wgsl);
+    if (it != mPrograms.end()) {
+        return *it->second;
+    }
+
+    mLRU.push_front(program);
+    mPrograms.emplace(program->GetSource(), mLRU.begin());
+    mSize += program->GetEstimatedSize();
+    EvictUntilUnder(mMaxSize);
+    return program;
+}
+
+void TintProgramCache::SetMaxSize(size_t maxSize) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxSize = maxSize;
+    EvictUntilUnder(mMaxSize);
+}
+
+TintProgramCacheStats TintProgramCache::GetStats() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    TintProgramCacheStats stats;
+    stats.hitCount = mHitCount;
+    stats.missCount = mMissCount;
+    stats.evictionCount = mEvictionCount;
+    stats.programCount = mPrograms.size();
+    stats.estimatedSize = mSize;
+    stats.maxSize = mMaxSize;
+    return stats;
+}
+
+void TintProgramCache::EvictUntilUnder(size_t maxSize) {
+    while (mSize > maxSize) {
+        ASSERT(!mLRU.empty());
+        const Ref<TintProgram>& program = mLRU.back();
+        mSize -= program->GetEstimatedSize();
+        mPrograms.erase(program->GetSource());
+        mLRU.pop_back();
+        mEvictionCount++;
+    }
+}
+
+}  // namespace dawn::native
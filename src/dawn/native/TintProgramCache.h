@@ -0,0 +1,119 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
+#define SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "dawn/common/RefCounted.h"
+#include "dawn/native/DawnNative.h"
+
+namespace tint {
+class Program;
+namespace diag {
+class List;
+}  // namespace diag
+}  // namespace tint
+
+namespace dawn::native {
+
+class TintSource;
+
+// A parsed and resolved tint::Program, along with the tint::Source::File that its AST and
+// diagnostics point into. It is never modified after its creation so it can be used by several
+// shader modules at once, from any thread and on any device of the instance.
+class TintProgram : public RefCounted {
+  public:
+    // Parses and resolves the WGSL source. The program may be invalid, in which case its
+    // diagnostics contain the errors.
+    static Ref<TintProgram> CreateFromWGSL(std::string_view wgsl);
+    // Takes ownership of an already parsed program, which isn't backed by a tint::Source::File.
+    static Ref<TintProgram> Create(std::unique_ptr<tint::Program> program);
+
+    const tint::Program* GetProgram() const;
+    bool IsValid() const;
+    const tint::diag::List& GetDiagnostics() const;
+
+    // The WGSL source the program was parsed from, or an empty string if it wasn't parsed from
+    // WGSL.
+    std::string_view GetSource() const;
+
+    // A rough estimate of the memory used by the program and its source.
+    size_t GetEstimatedSize() const;
+
+  private:
+    TintProgram(std::unique_ptr<TintSource> source, std::unique_ptr<tint::Program> program);
+    ~TintProgram() override;
+
+    // The source must outlive the program since the program points into it.
+    std::unique_ptr<TintSource> mSource;
+    std::unique_ptr<tint::Program> mProgram;
+    size_t mEstimatedSize;
+};
+
+// An instance-wide cache of the TintPrograms parsed from WGSL, so that devices that create shader
+// modules with the same source share a single program instead of each parsing and resolving it.
+// The source is the whole key: the extensions a shader uses are enabled by its own `enable`
+// directives, and each device validates them against its features when it reflects the program.
+//
+// The cache holds a reference on its most recently used programs until their estimated size
+// exceeds the maximum size, and then drops the least recently used ones. Programs that are
+// dropped stay alive for as long as shader modules use them. Only valid programs are cached.
+// This class is thread-safe.
+class TintProgramCache {
+  public:
+    static constexpr size_t kDefaultMaxSize = 32 * 1024 * 1024;
+
+    explicit TintProgramCache(size_t maxSize = kDefaultMaxSize);
+    ~TintProgramCache();
+
+    TintProgramCache(const TintProgramCache&) = delete;
+    TintProgramCache& operator=(const TintProgramCache&) = delete;
+
+    // Returns the cached program for the WGSL source, or parses it, outside of the lock so
+    // that devices parsing different shaders don't wait on each other.
+    Ref<TintProgram> GetOrCreate(std::string_view wgsl);
+
+    // Changes the maximum estimated size of the cached programs, evicting programs if needed. A
+    // size of 0 disables the cache.
+    void SetMaxSize(size_t maxSize);
+
+    TintProgramCacheStats GetStats();
+
+  private:
+    using LRUList = std::list<Ref<TintProgram>>;
+
+    // Must be called with mMutex held.
+    void EvictUntilUnder(size_t maxSize);
+
+    std::mutex mMutex;
+    size_t mMaxSize;
+    size_t mSize = 0;
+    // The most recently used programs are at the front. The keys of mPrograms are the sources of
+    // the programs, which outlive the entries since the list holds a reference on them.
+    LRUList mLRU;
+    std::unordered_map<std::string_view, LRUList::iterator> mPrograms;
+    uint64_t mHitCount = 0;
+    uint64_t mMissCount = 0;
+    uint64_t mEvictionCount = 0;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_TINTPROGRAMCACHE_H_
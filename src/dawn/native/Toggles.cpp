@@ -403,6 +403,12 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Clears some R8-like textures to full 0 bits as soon as they are created. This Toggle is "
       "enabled on Intel Gen12 GPUs due to a mesa driver issue.",
       "https://crbug.com/chromium/1361662", ToggleStage::Device}},
+    {Toggle::DisableCommandBlockPool,
+     {"disable_command_block_pool",
+      "Allocate the memory blocks used to record commands from the heap instead of reusing them "
+      "from a pool shared by all the encoders of the device. Used to measure the effect of the "
+      "pool.",
+      "", ToggleStage::Device}},
     {Toggle::NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
      {"no_workaround_sample_mask_becomes_zero_for_all_but_last_color_target",
       "MacOS 12.0+ Intel has a bug where the sample mask is only applied for the last color "
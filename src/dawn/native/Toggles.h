@@ -95,6 +95,7 @@ enum class Toggle {
     AllowDeprecatedAPIs,
     D3D12PolyfillReflectVec2F32,
     VulkanClearGen12TextureWithCCSAmbiguateOnCreation,
+    DisableCommandBlockPool,
 
     // Unresolved issues.
     NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
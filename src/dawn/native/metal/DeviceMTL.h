@@ -78,6 +78,8 @@ class Device final : public DeviceBase {
 
     float GetTimestampPeriodInNS() const override;
 
+    bool CanWriteBufferDirectly(const BufferBase* buffer) const override;
+
     bool UseCounterSamplingAtCommandBoundary() const;
     bool UseCounterSamplingAtStageBoundary() const;
 
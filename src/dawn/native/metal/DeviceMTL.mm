@@ -478,6 +478,12 @@ float Device::GetTimestampPeriodInNS() const {
     return mTimestampPeriod;
 }
 
+bool Device::CanWriteBufferDirectly(const BufferBase* buffer) const {
+    // Mappable buffers use MTLResourceStorageModeShared, so their contents are always accessible
+    // and coherent with the GPU.
+    return (buffer->GetUsage() & kMappableBufferUsages) != 0;
+}
+
 bool Device::UseCounterSamplingAtCommandBoundary() const {
     return mCounterSamplingAtCommandBoundary;
 }
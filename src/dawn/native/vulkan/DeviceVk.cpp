@@ -1150,6 +1150,12 @@ float Device::GetTimestampPeriodInNS() const {
     return mDeviceInfo.properties.limits.timestampPeriod;
 }
 
+bool Device::CanWriteBufferDirectly(const BufferBase* buffer) const {
+    // Mappable buffers are allocated in HOST_VISIBLE | HOST_COHERENT memory that stays mapped for
+    // the lifetime of the buffer, and vkQueueSubmit makes the host writes visible to the GPU.
+    return (buffer->GetUsage() & kMappableBufferUsages) != 0;
+}
+
 void Device::SetLabelImpl() {
     SetDebugName(this, VK_OBJECT_TYPE_DEVICE, mVkDevice, "Dawn_Device", GetLabel());
 }
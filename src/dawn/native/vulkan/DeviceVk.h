@@ -108,6 +108,8 @@ class Device final : public DeviceBase {
 
     float GetTimestampPeriodInNS() const override;
 
+    bool CanWriteBufferDirectly(const BufferBase* buffer) const override;
+
     void SetLabelImpl() override;
 
     void OnDebugMessage(std::string message);
@@ -0,0 +1,98 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput of uploading data with GPUQueue.writeBuffer() and with buffers mapped
+// for writing, for several sizes and types of BufferSource.
+//
+// Usage: node write_buffer.js <path-to-dawn.node> [flags...]
+// For example: node write_buffer.js out/Release/dawn.node backend=vulkan
+
+const kSizes = [4 * 1024, 1024 * 1024, 16 * 1024 * 1024, 64 * 1024 * 1024];
+const kMinDurationMs = 1000;
+
+// GPUBufferUsage and GPUMapMode values.
+const kMapWrite = 0x0002;
+const kCopySrc = 0x0004;
+const kCopyDst = 0x0008;
+const kMapModeWrite = 0x0002;
+
+async function measure(name, size, device, step) {
+  // Warm up, and make sure the step works before timing it.
+  await step();
+  await device.queue.onSubmittedWorkDone();
+
+  let iterations = 0;
+  const start = process.hrtime.bigint();
+  let elapsedMs = 0;
+  while (elapsedMs < kMinDurationMs) {
+    await step();
+    iterations++;
+    elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+  }
+  await device.queue.onSubmittedWorkDone();
+  elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+
+  const mbPerSecond = (size * iterations) / (1024 * 1024) / (elapsedMs / 1000);
+  console.log(`${name.padEnd(28)} ${String(size).padStart(10)} bytes: ` +
+              `${mbPerSecond.toFixed(1).padStart(10)} MB/s (${iterations} iterations)`);
+}
+
+async function main() {
+  const [modulePath, ...flags] = process.argv.slice(2);
+  if (!modulePath) {
+    console.error('Usage: node write_buffer.js <path-to-dawn.node> [flags...]');
+    process.exit(1);
+  }
+
+  const gpu = require(modulePath).create(flags);
+  const adapter = await gpu.requestAdapter();
+  const device = await adapter.requestDevice();
+
+  for (const size of kSizes) {
+    const target = device.createBuffer({size, usage: kCopyDst});
+    const arrayBuffer = new ArrayBuffer(size);
+    const float32Array = new Float32Array(size / 4);
+    const uint8Array = new Uint8Array(size);
+
+    // Syncing with the GPU every few writes keeps the staging memory bounded.
+    let writes = 0;
+    const syncEvery = Math.max(1, (64 * 1024 * 1024) / size);
+    const writeStep = (data) => async () => {
+      device.queue.writeBuffer(target, 0, data);
+      if (++writes % syncEvery == 0) {
+        await device.queue.onSubmittedWorkDone();
+      }
+    };
+    await measure('writeBuffer(ArrayBuffer)', size, device, writeStep(arrayBuffer));
+    await measure('writeBuffer(Float32Array)', size, device, writeStep(float32Array));
+    await measure('writeBuffer(Uint8Array)', size, device, writeStep(uint8Array));
+
+    const staging = device.createBuffer({size, usage: kMapWrite | kCopySrc});
+    await measure('mapAsync+getMappedRange', size, device, async () => {
+      await staging.mapAsync(kMapModeWrite);
+      new Uint8Array(staging.getMappedRange()).set(uint8Array);
+      staging.unmap();
+    });
+
+    staging.destroy();
+    target.destroy();
+  }
+
+  device.destroy();
+}
+
+main().catch((e) => {
+  console.error(e);
+  process.exit(1);
+});
@@ -14,46 +14,132 @@
 
 #include "src/dawn/node/binding/AsyncRunner.h"
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 
 namespace wgpu::binding {
 
-AsyncRunner::AsyncRunner(Napi::Env env, wgpu::Device device) : env_(env), device_(device) {}
+namespace {
+
+struct WorkerTask {
+    std::shared_ptr<AsyncRunner> runner;
+    std::function<void()> work;
+};
+
+}  // namespace
+
+AsyncRunner::AsyncRunner(Napi::Env env,
+                         wgpu::Device device,
+                         std::shared_ptr<dawn::platform::WorkerTaskPool> worker_pool)
+    : env_(env), device_(device), worker_pool_(std::move(worker_pool)) {
+    if (worker_pool_) {
+        wake_function_ = Napi::ThreadSafeFunction::New(
+            env_, Napi::Function::New(env_, [](const Napi::CallbackInfo&) {}),
+            "dawn.node AsyncRunner", 0, 1);
+        // Pending worker tasks are already keeping the event loop alive with the tick timer.
+        wake_function_.Unref(env_);
+    }
+}
+
+AsyncRunner::~AsyncRunner() {
+    if (worker_pool_) {
+        // The worker tasks keep the AsyncRunner alive so none of them is running.
+        wake_function_.Release();
+    }
+}
 
 void AsyncRunner::Begin() {
     assert(count_ != std::numeric_limits<decltype(count_)>::max());
     if (count_++ == 0) {
-        QueueTick();
+        Wake();
     }
 }
 
 void AsyncRunner::End() {
     assert(count_ > 0);
     count_--;
+    end_count_++;
+}
+
+bool AsyncRunner::HasWorkerPool() const {
+    return worker_pool_ != nullptr;
+}
+
+void AsyncRunner::PostWorkerTask(std::function<void()> work) {
+    assert(worker_pool_);
+    auto* task = new WorkerTask{shared_from_this(), std::move(work)};
+    worker_pool_->PostWorkerTask(
+        [](void* userdata) {
+            auto* task = static_cast<WorkerTask*>(userdata);
+            task->work();
+            // The task is deleted on the JavaScript thread since it holds a reference to the
+            // AsyncRunner. If the call fails the environment is being torn down, and the task is
+            // leaked instead of destroying the AsyncRunner on this thread.
+            task->runner->wake_function_.NonBlockingCall([task](Napi::Env, Napi::Function) {
+                std::unique_ptr<WorkerTask> t(task);
+                t->runner->Wake();
+            });
+        },
+        task);
+}
+
+void AsyncRunner::Wake() {
+    tick_delay_ms_ = 0;
+    if (tick_queued_ && !tick_timeout_.IsEmpty()) {
+        env_.Global().Get("clearTimeout").As<Napi::Function>().Call({tick_timeout_.Value()});
+        tick_timeout_.Reset();
+        tick_queued_ = false;
+    }
+    if (count_ > 0) {
+        QueueTick();
+    }
 }
 
 void AsyncRunner::QueueTick() {
-    // TODO(crbug.com/dawn/1127): We probably want to reduce the frequency at which this gets
-    // called.
     if (tick_queued_) {
         return;
     }
     tick_queued_ = true;
-    env_.Global()
-        .Get("setImmediate")
-        .As<Napi::Function>()
-        .Call({
-            // TODO(crbug.com/dawn/1127): Create once, reuse.
-            Napi::Function::New(env_,
-                                [this](const Napi::CallbackInfo&) {
-                                    tick_queued_ = false;
-                                    if (count_ > 0) {
-                                        device_.Tick();
-                                        QueueTick();
-                                    }
-                                }),
-        });
+
+    if (tick_function_.IsEmpty()) {
+        tick_function_ = Napi::Persistent(
+            Napi::Function::New(env_, [runner = weak_from_this()](const Napi::CallbackInfo&) {
+                if (auto self = runner.lock()) {
+                    self->Tick();
+                }
+            }));
+    }
+
+    Napi::Object global = env_.Global();
+    if (tick_delay_ms_ == 0) {
+        global.Get("setImmediate").As<Napi::Function>().Call({tick_function_.Value()});
+    } else {
+        tick_timeout_ = Napi::Persistent(global.Get("setTimeout").As<Napi::Function>().Call(
+            {tick_function_.Value(), Napi::Number::New(env_, tick_delay_ms_)}));
+    }
+}
+
+void AsyncRunner::Tick() {
+    tick_queued_ = false;
+    tick_timeout_.Reset();
+    if (count_ == 0) {
+        return;
+    }
+
+    // Tick again as soon as possible while the ticks complete tasks, and back off while they
+    // don't.
+    uint64_t end_count = end_count_;
+    device_.Tick();
+    if (end_count_ != end_count) {
+        tick_delay_ms_ = 0;
+    } else {
+        tick_delay_ms_ = std::min(std::max(tick_delay_ms_ * 2, 1u), kMaxTickDelayMs);
+    }
+
+    if (count_ > 0) {
+        QueueTick();
+    }
 }
 
 }  // namespace wgpu::binding
@@ -16,9 +16,11 @@
 #define SRC_DAWN_NODE_BINDING_ASYNCRUNNER_H_
 
 #include <stdint.h>
+#include <functional>
 #include <memory>
 #include <utility>
 
+#include "dawn/platform/DawnPlatform.h"
 #include "dawn/webgpu_cpp.h"
 #include "src/dawn/node/interop/Napi.h"
 
@@ -26,9 +28,19 @@ namespace wgpu::binding {
 
 // AsyncRunner is used to poll a wgpu::Device with calls to Tick() while there are asynchronous
 // tasks in flight.
-class AsyncRunner {
+// The device is ticked with a timer whose delay adapts to the progress of the tasks: it is ticked
+// as soon as the JavaScript thread is idle while ticks complete tasks, and the delay doubles up to
+// kMaxTickDelayMs while they don't, for example while waiting for the GPU to finish the work
+// that a buffer mapping depends on. Work posted with PostWorkerTask() runs on a worker thread
+// of the Dawn worker pool and wakes the timer up when it completes.
+class AsyncRunner : public std::enable_shared_from_this<AsyncRunner> {
   public:
-    AsyncRunner(Napi::Env env, wgpu::Device device);
+    // |worker_pool| is shared between the devices, and may be null if PostWorkerTask() isn't
+    // used.
+    AsyncRunner(Napi::Env env,
+                wgpu::Device device,
+                std::shared_ptr<dawn::platform::WorkerTaskPool> worker_pool = nullptr);
+    ~AsyncRunner();
 
     // Begin() should be called when a new asynchronous task is started.
     // If the number of executing asynchronous tasks transitions from 0 to 1, then a function
@@ -41,12 +53,40 @@ class AsyncRunner {
     // Every call to Begin() should eventually result in a call to End().
     void End();
 
+    // Returns whether PostWorkerTask() can be used.
+    bool HasWorkerPool() const;
+
+    // Runs |work| on a worker thread, then ticks the device on the JavaScript thread as soon as
+    // it is idle, so that the callbacks queued by |work| are called without waiting for the timer.
+    // |work| must only use thread-safe objects, like devices created with the
+    // ImplicitDeviceSynchronization feature, and no JavaScript values. The AsyncRunner is kept
+    // alive until the device is ticked.
+    void PostWorkerTask(std::function<void()> work);
+
+    static constexpr uint32_t kMaxTickDelayMs = 16;
+
   private:
     void QueueTick();
+    void Tick();
+    // Ticks the device as soon as the JavaScript thread is idle, cancelling the pending timer.
+    void Wake();
+
     Napi::Env env_;
     wgpu::Device const device_;
     uint64_t count_ = 0;
+    // The number of calls to End(), used to know whether a tick made progress.
+    uint64_t end_count_ = 0;
     bool tick_queued_ = false;
+    uint32_t tick_delay_ms_ = 0;
+    // Created once and reused for all the ticks. It only holds a weak reference to the
+    // AsyncRunner so that pending ticks don't use it after it is destroyed.
+    Napi::FunctionReference tick_function_;
+    // The Timeout returned by setTimeout() for the pending tick, if it was queued with a delay.
+    Napi::Reference<Napi::Value> tick_timeout_;
+
+    std::shared_ptr<dawn::platform::WorkerTaskPool> const worker_pool_;
+    // Only created if there is a worker pool.
+    Napi::ThreadSafeFunction wake_function_;
 };
 
 // AsyncTask is a RAII helper for calling AsyncRunner::Begin() on construction, and
@@ -15,6 +15,7 @@
 #include "src/dawn/node/binding/Converter.h"
 
 #include <cassert>
+#include <type_traits>
 
 #include "src/dawn/node/binding/GPUBuffer.h"
 #include "src/dawn/node/binding/GPUPipelineLayout.h"
@@ -155,8 +156,15 @@ bool Converter::Convert(BufferSource& out, interop::BufferSource in) {
     if (auto* view = std::get_if<interop::ArrayBufferView>(&in)) {
         std::visit(
             [&](auto&& v) {
-                auto arr = v.ArrayBuffer();
-                out.data = static_cast<uint8_t*>(arr.Data()) + v.ByteOffset();
+                using T = std::remove_cv_t<std::remove_reference_t<decltype(v)>>;
+                if constexpr (std::is_same_v<T, interop::DataView>) {
+                    auto arr = v.ArrayBuffer();
+                    out.data = static_cast<uint8_t*>(arr.Data()) + v.ByteOffset();
+                } else {
+                    // The data pointer of typed arrays is queried when they are converted from
+                    // JavaScript, so this doesn't call into the JavaScript engine.
+                    out.data = v.Data();
+                }
                 out.size = v.ByteLength();
                 out.bytesPerElement = v.ElementSize();
             },
@@ -104,6 +104,14 @@ GPU::GPU(Flags flags) : flags_(std::move(flags)) {
     if (auto dir = flags_.Get("dlldir")) {
         SetDllDir(dir->c_str());
     }
+
+    // Creating pipelines on worker threads, for the backends that compile them on the calling
+    // thread, requires thread-safe devices, which have a locking overhead on every call, so it is
+    // opt-in.
+    if (auto workers = flags_.Get("pipeline-workers"); workers == "1" || workers == "true") {
+        dawn::platform::Platform platform;
+        worker_pool_ = platform.CreateWorkerTaskPool();
+    }
     instance_.DiscoverDefaultAdapters();
 }
 
@@ -220,7 +228,7 @@ interop::Promise<std::optional<interop::Interface<interop::GPUAdapter>>> GPU::re
         printf("using GPU adapter: %s\n", props.name);
     }
 
-    auto gpuAdapter = GPUAdapter::Create<GPUAdapter>(env, *adapter, flags_);
+    auto gpuAdapter = GPUAdapter::Create<GPUAdapter>(env, *adapter, flags_, worker_pool_);
     promise.Resolve(std::optional<interop::Interface<interop::GPUAdapter>>(gpuAdapter));
     return promise;
 }
@@ -15,7 +15,10 @@
 #ifndef SRC_DAWN_NODE_BINDING_GPU_H_
 #define SRC_DAWN_NODE_BINDING_GPU_H_
 
+#include <memory>
+
 #include "dawn/native/DawnNative.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "dawn/webgpu_cpp.h"
 
 #include "src/dawn/node/binding/Flags.h"
@@ -37,6 +40,9 @@ class GPU final : public interop::GPU {
   private:
     const Flags flags_;
     dawn::native::Instance instance_;
+    // The pool that the devices create pipelines on, shared by all of them. Null unless the
+    // "pipeline-workers" flag is set.
+    std::shared_ptr<dawn::platform::WorkerTaskPool> worker_pool_;
 };
 
 }  // namespace wgpu::binding
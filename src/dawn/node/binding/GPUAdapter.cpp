@@ -14,6 +14,7 @@
 
 #include "src/dawn/node/binding/GPUAdapter.h"
 
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -94,7 +95,10 @@ namespace wgpu::binding {
 // wgpu::bindings::GPUAdapter
 // TODO(crbug.com/dawn/1133): This is a stub implementation. Properly implement.
 ////////////////////////////////////////////////////////////////////////////////
-GPUAdapter::GPUAdapter(dawn::native::Adapter a, const Flags& flags) : adapter_(a), flags_(flags) {}
+GPUAdapter::GPUAdapter(dawn::native::Adapter a,
+                       const Flags& flags,
+                       std::shared_ptr<dawn::platform::WorkerTaskPool> workerPool)
+    : adapter_(a), flags_(flags), worker_pool_(std::move(workerPool)) {}
 
 // TODO(dawn:1133): Avoid the extra copy by making the generator make a virtual method with const
 // std::string&
@@ -147,6 +151,26 @@ interop::Promise<interop::Interface<interop::GPUDevice>> GPUAdapter::requestDevi
         requiredFeatures.emplace_back(feature);
     }
 
+    // The D3D12, Metal and Vulkan backends already initialize the pipelines of
+    // Create*PipelineAsync() on the Dawn worker threads. The other backends initialize them on the
+    // calling thread, so they are created on worker threads here instead, which requires the
+    // device to be thread-safe. Otherwise the device only gets the features that were asked for.
+    std::shared_ptr<dawn::platform::WorkerTaskPool> workerPool;
+    wgpu::Adapter adapter(adapter_.Get());
+    wgpu::AdapterProperties props;
+    adapter.GetProperties(&props);
+    bool hasAsyncPipelineCreation = props.backendType == wgpu::BackendType::D3D12 ||
+                                    props.backendType == wgpu::BackendType::Metal ||
+                                    props.backendType == wgpu::BackendType::Vulkan;
+    if (worker_pool_ && !hasAsyncPipelineCreation &&
+        adapter.HasFeature(wgpu::FeatureName::ImplicitDeviceSynchronization)) {
+        if (std::find(requiredFeatures.begin(), requiredFeatures.end(),
+                      wgpu::FeatureName::ImplicitDeviceSynchronization) == requiredFeatures.end()) {
+            requiredFeatures.emplace_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+        }
+        workerPool = worker_pool_;
+    }
+
     wgpu::RequiredLimits limits;
 #define COPY_LIMIT(LIMIT)                                        \
     if (descriptor.requiredLimits.count(#LIMIT)) {               \
@@ -195,7 +219,8 @@ interop::Promise<interop::Interface<interop::GPUDevice>> GPUAdapter::requestDevi
 
     auto wgpu_device = adapter_.CreateDevice(&desc);
     if (wgpu_device) {
-        promise.Resolve(interop::GPUDevice::Create<GPUDevice>(env, env, wgpu_device));
+        promise.Resolve(
+            interop::GPUDevice::Create<GPUDevice>(env, env, wgpu_device, std::move(workerPool)));
     } else {
         promise.Reject(binding::Errors::OperationError(env, "failed to create device"));
     }
@@ -15,10 +15,12 @@
 #ifndef SRC_DAWN_NODE_BINDING_GPUADAPTER_H_
 #define SRC_DAWN_NODE_BINDING_GPUADAPTER_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "dawn/native/DawnNative.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "dawn/webgpu_cpp.h"
 #include "src/dawn/node/interop/Napi.h"
 #include "src/dawn/node/interop/WebGPU.h"
@@ -29,7 +31,9 @@ class Flags;
 // GPUAdapter is an implementation of interop::GPUAdapter that wraps a dawn::native::Adapter.
 class GPUAdapter final : public interop::GPUAdapter {
   public:
-    GPUAdapter(dawn::native::Adapter a, const Flags& flags);
+    GPUAdapter(dawn::native::Adapter a,
+               const Flags& flags,
+               std::shared_ptr<dawn::platform::WorkerTaskPool> workerPool);
 
     // interop::GPUAdapter interface compliance
     interop::Promise<interop::Interface<interop::GPUDevice>> requestDevice(
@@ -45,6 +49,7 @@ class GPUAdapter final : public interop::GPUAdapter {
   private:
     dawn::native::Adapter adapter_;
     const Flags& flags_;
+    std::shared_ptr<dawn::platform::WorkerTaskPool> const worker_pool_;
 };
 
 }  // namespace wgpu::binding
@@ -129,10 +129,12 @@ class ValidationError : public interop::GPUValidationError {
 ////////////////////////////////////////////////////////////////////////////////
 // wgpu::bindings::GPUDevice
 ////////////////////////////////////////////////////////////////////////////////
-GPUDevice::GPUDevice(Napi::Env env, wgpu::Device device)
+GPUDevice::GPUDevice(Napi::Env env,
+                     wgpu::Device device,
+                     std::shared_ptr<dawn::platform::WorkerTaskPool> worker_pool)
     : env_(env),
       device_(device),
-      async_(std::make_shared<AsyncRunner>(env, device)),
+      async_(std::make_shared<AsyncRunner>(env, device, std::move(worker_pool))),
       lost_promise_(env, PROMISE_INFO) {
     device_.SetLoggingCallback(
         [](WGPULoggingType type, char const* message, void* userdata) {
@@ -365,40 +367,59 @@ GPUDevice::createComputePipelineAsync(Napi::Env env,
                                       interop::GPUComputePipelineDescriptor descriptor) {
     using Promise = interop::Promise<interop::Interface<interop::GPUComputePipeline>>;
 
-    Converter conv(env);
-
-    wgpu::ComputePipelineDescriptor desc{};
-    if (!conv(desc, descriptor)) {
-        Promise promise(env, PROMISE_INFO);
-        promise.Reject(Errors::OperationError(env));
-        return promise;
-    }
-
     struct Context {
         Napi::Env env;
         Promise promise;
         AsyncTask task;
+        // The descriptor and the Converter that owns its allocations are kept alive until the
+        // pipeline is created, since the creation can happen on a worker thread.
+        Converter conv;
+        wgpu::ComputePipelineDescriptor desc{};
+        // The JavaScript objects of the descriptor may be garbage collected before the pipeline
+        // is created, so the descriptor's objects are referenced until the callback is called.
+        wgpu::PipelineLayout layout;
+        wgpu::ShaderModule module;
     };
-    auto ctx = new Context{env, Promise(env, PROMISE_INFO), AsyncTask(async_)};
+    auto ctx = std::unique_ptr<Context>(
+        new Context{env, Promise(env, PROMISE_INFO), AsyncTask(async_), Converter(env)});
     auto promise = ctx->promise;
 
-    device_.CreateComputePipelineAsync(
-        &desc,
-        [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline pipeline, char const* message,
-           void* userdata) {
-            auto c = std::unique_ptr<Context>(static_cast<Context*>(userdata));
+    if (!ctx->conv(ctx->desc, descriptor)) {
+        promise.Reject(Errors::OperationError(env));
+        return promise;
+    }
+    ctx->layout = ctx->desc.layout;
+    ctx->module = ctx->desc.compute.module;
+
+    auto callback = [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline pipeline,
+                       char const* message, void* userdata) {
+        auto c = std::unique_ptr<Context>(static_cast<Context*>(userdata));
+
+        switch (status) {
+            case WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success:
+                c->promise.Resolve(
+                    interop::GPUComputePipeline::Create<GPUComputePipeline>(c->env, pipeline));
+                break;
+            default:
+                c->promise.Reject(Errors::OperationError(c->env));
+                break;
+        }
+    };
 
-            switch (status) {
-                case WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success:
-                    c->promise.Resolve(
-                        interop::GPUComputePipeline::Create<GPUComputePipeline>(c->env, pipeline));
-                    break;
-                default:
-                    c->promise.Reject(Errors::OperationError(c->env));
-                    break;
-            }
-        },
-        ctx);
+    if (async_->HasWorkerPool()) {
+        // The backend of the device compiles the pipeline on the calling thread, so the creation
+        // is posted to a worker thread to not block the JavaScript thread. The callback is still
+        // called on the JavaScript thread when the device is ticked, and the AsyncRunner keeps the
+        // device alive until then.
+        async_->PostWorkerTask([device = device_.Get(), c = ctx.release(), callback] {
+            wgpuDeviceCreateComputePipelineAsync(
+                device, reinterpret_cast<const WGPUComputePipelineDescriptor*>(&c->desc), callback,
+                c);
+        });
+    } else {
+        Context* c = ctx.release();
+        device_.CreateComputePipelineAsync(&c->desc, callback, c);
+    }
 
     return promise;
 }
@@ -408,40 +429,63 @@ GPUDevice::createRenderPipelineAsync(Napi::Env env,
                                      interop::GPURenderPipelineDescriptor descriptor) {
     using Promise = interop::Promise<interop::Interface<interop::GPURenderPipeline>>;
 
-    Converter conv(env, device_);
-
-    wgpu::RenderPipelineDescriptor desc{};
-    if (!conv(desc, descriptor)) {
-        Promise promise(env, PROMISE_INFO);
-        promise.Reject(Errors::OperationError(env));
-        return promise;
-    }
-
     struct Context {
         Napi::Env env;
         Promise promise;
         AsyncTask task;
+        // The descriptor and the Converter that owns its allocations are kept alive until the
+        // pipeline is created, since the creation can happen on a worker thread.
+        Converter conv;
+        wgpu::RenderPipelineDescriptor desc{};
+        // The JavaScript objects of the descriptor may be garbage collected before the pipeline
+        // is created, so the descriptor's objects are referenced until the callback is called.
+        wgpu::PipelineLayout layout;
+        wgpu::ShaderModule vertexModule;
+        wgpu::ShaderModule fragmentModule;
     };
-    auto ctx = new Context{env, Promise(env, PROMISE_INFO), AsyncTask(async_)};
+    auto ctx = std::unique_ptr<Context>(
+        new Context{env, Promise(env, PROMISE_INFO), AsyncTask(async_), Converter(env, device_)});
     auto promise = ctx->promise;
 
-    device_.CreateRenderPipelineAsync(
-        &desc,
-        [](WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline pipeline, char const* message,
-           void* userdata) {
-            auto c = std::unique_ptr<Context>(static_cast<Context*>(userdata));
+    if (!ctx->conv(ctx->desc, descriptor)) {
+        promise.Reject(Errors::OperationError(env));
+        return promise;
+    }
+    ctx->layout = ctx->desc.layout;
+    ctx->vertexModule = ctx->desc.vertex.module;
+    if (ctx->desc.fragment != nullptr) {
+        ctx->fragmentModule = ctx->desc.fragment->module;
+    }
 
-            switch (status) {
-                case WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success:
-                    c->promise.Resolve(
-                        interop::GPURenderPipeline::Create<GPURenderPipeline>(c->env, pipeline));
-                    break;
-                default:
-                    c->promise.Reject(Errors::OperationError(c->env));
-                    break;
-            }
-        },
-        ctx);
+    auto callback = [](WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline pipeline,
+                       char const* message, void* userdata) {
+        auto c = std::unique_ptr<Context>(static_cast<Context*>(userdata));
+
+        switch (status) {
+            case WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success:
+                c->promise.Resolve(
+                    interop::GPURenderPipeline::Create<GPURenderPipeline>(c->env, pipeline));
+                break;
+            default:
+                c->promise.Reject(Errors::OperationError(c->env));
+                break;
+        }
+    };
+
+    if (async_->HasWorkerPool()) {
+        // The backend of the device compiles the pipeline on the calling thread, so the creation
+        // is posted to a worker thread to not block the JavaScript thread. The callback is still
+        // called on the JavaScript thread when the device is ticked, and the AsyncRunner keeps the
+        // device alive until then.
+        async_->PostWorkerTask([device = device_.Get(), c = ctx.release(), callback] {
+            wgpuDeviceCreateRenderPipelineAsync(
+                device, reinterpret_cast<const WGPURenderPipelineDescriptor*>(&c->desc), callback,
+                c);
+        });
+    } else {
+        Context* c = ctx.release();
+        device_.CreateRenderPipelineAsync(&c->desc, callback, c);
+    }
 
     return promise;
 }
@@ -27,7 +27,11 @@ namespace wgpu::binding {
 // GPUDevice is an implementation of interop::GPUDevice that wraps a wgpu::Device.
 class GPUDevice final : public interop::GPUDevice {
   public:
-    GPUDevice(Napi::Env env, wgpu::Device device);
+    // Pipelines are created on |worker_pool| if it isn't null, which requires |device| to have
+    // the ImplicitDeviceSynchronization feature.
+    GPUDevice(Napi::Env env,
+              wgpu::Device device,
+              std::shared_ptr<dawn::platform::WorkerTaskPool> worker_pool = nullptr);
     ~GPUDevice();
 
     // interop::GPUDevice interface compliance
@@ -360,6 +360,70 @@ class Converter<Napi::TypedArrayOf<T>> {
     static inline Napi::Value ToJS(Napi::Env, ArrayBuffer value) { return value; }
 };
 
+// Specialization of the std::variant converter below for the IDL ArrayBufferView typedef, which is
+// the type of most of the data passed to WebGPU. The type of the array is queried once and used to
+// pick the alternative, instead of trying to convert the value to each of them in turn.
+template <>
+class Converter<std::variant<Int8Array,
+                             Int16Array,
+                             Int32Array,
+                             Uint8Array,
+                             Uint16Array,
+                             Uint32Array,
+                             Float32Array,
+                             Float64Array,
+                             DataView>> {
+    using ArrayBufferView = std::variant<Int8Array,
+                                         Int16Array,
+                                         Int32Array,
+                                         Uint8Array,
+                                         Uint16Array,
+                                         Uint32Array,
+                                         Float32Array,
+                                         Float64Array,
+                                         DataView>;
+
+  public:
+    static inline Result FromJS(Napi::Env, Napi::Value value, ArrayBufferView& out) {
+        if (!value.IsTypedArray()) {
+            return Error("value is not a TypedArray");
+        }
+        switch (value.As<Napi::TypedArray>().TypedArrayType()) {
+            case napi_int8_array:
+                out = value.As<Int8Array>();
+                return Success;
+            case napi_int16_array:
+                out = value.As<Int16Array>();
+                return Success;
+            case napi_int32_array:
+                out = value.As<Int32Array>();
+                return Success;
+            case napi_uint8_array:
+                out = value.As<Uint8Array>();
+                return Success;
+            case napi_uint16_array:
+                out = value.As<Uint16Array>();
+                return Success;
+            case napi_uint32_array:
+                out = value.As<Uint32Array>();
+                return Success;
+            case napi_float32_array:
+                out = value.As<Float32Array>();
+                return Success;
+            case napi_float64_array:
+                out = value.As<Float64Array>();
+                return Success;
+            default:
+                // Like the generic converter, other typed arrays are converted to DataView.
+                out = value.As<DataView>();
+                return Success;
+        }
+    }
+    static inline Napi::Value ToJS(Napi::Env, ArrayBufferView value) {
+        return std::visit([](auto&& v) -> Napi::Value { return v; }, value);
+    }
+};
+
 template <>
 class Converter<std::string> {
   public:
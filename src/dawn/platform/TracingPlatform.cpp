@@ -0,0 +1,413 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/platform/TracingPlatform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::platform {
+
+namespace {
+
+constexpr size_t kCategoryCount = 4;
+static_assert(static_cast<size_t>(TraceCategory::GPUWork) == kCategoryCount - 1);
+
+// The TRACE_EVENT macros cache the pointers to the category flags in statics, so the flags are
+// shared by all the TracingPlatforms and are enabled while any of them is recording. Like in
+// Chrome, the flags are read without synchronization since they are only an early out.
+unsigned char gCategoryEnabled[kCategoryCount] = {};
+std::mutex gCategoryEnabledMutex;
+uint32_t gRecordingPlatformCount = 0;
+
+std::atomic<uint64_t> gNextPlatformId{1};
+
+// TRACE_EVENT macros take at most two arguments.
+constexpr size_t kMaxArgs = 2;
+// String arguments are copied in the events since they may not outlive the call, and truncated.
+constexpr size_t kMaxStringArgLength = 64;
+
+struct Event {
+    double timestamp;
+    uint64_t id;
+    const char* name;
+    const char* argNames[kMaxArgs];
+    uint64_t argValues[kMaxArgs];
+    unsigned char argTypes[kMaxArgs];
+    uint8_t numArgs;
+    uint8_t category;
+    unsigned char flags;
+    char phase;
+    char stringArgs[kMaxArgs][kMaxStringArgLength];
+};
+
+const char* GetCategoryName(uint8_t category) {
+    switch (static_cast<TraceCategory>(category)) {
+        case TraceCategory::General:
+            return "general";
+        case TraceCategory::Validation:
+            return "validation";
+        case TraceCategory::Recording:
+            return "recording";
+        case TraceCategory::GPUWork:
+            return "gpu";
+    }
+    UNREACHABLE();
+}
+
+void AppendEscaped(std::string* out, const char* str) {
+    out->push_back('"');
+    for (const char* c = str; *c != '\0'; ++c) {
+        switch (*c) {
+            case '"':
+                out->append("\\\"");
+                break;
+            case '\\':
+                out->append("\\\\");
+                break;
+            case '\n':
+                out->append("\\n");
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                    out->append(escaped);
+                } else {
+                    out->push_back(*c);
+                }
+                break;
+        }
+    }
+    out->push_back('"');
+}
+
+void AppendArgValue(std::string* out, const Event& event, size_t arg) {
+    TraceEvent::TraceValueUnion value;
+    value.m_uint = event.argValues[arg];
+
+    char buffer[32];
+    switch (event.argTypes[arg]) {
+        case TRACE_VALUE_TYPE_BOOL:
+            out->append(value.m_bool ? "true" : "false");
+            return;
+        case TRACE_VALUE_TYPE_UINT:
+            snprintf(buffer, sizeof(buffer), "%" PRIu64, value.m_uint);
+            break;
+        case TRACE_VALUE_TYPE_INT:
+            snprintf(buffer, sizeof(buffer), "%" PRId64, value.m_int);
+            break;
+        case TRACE_VALUE_TYPE_DOUBLE:
+            snprintf(buffer, sizeof(buffer), "%.17g", value.m_double);
+            break;
+        case TRACE_VALUE_TYPE_POINTER:
+            snprintf(buffer, sizeof(buffer), "\"0x%" PRIx64 "\"", value.m_uint);
+            break;
+        case TRACE_VALUE_TYPE_STRING:
+        case TRACE_VALUE_TYPE_COPY_STRING:
+            AppendEscaped(out, event.stringArgs[arg]);
+            return;
+        default:
+            out->append("null");
+            return;
+    }
+    out->append(buffer);
+}
+
+void AppendEvent(std::string* out, const Event& event, uint32_t threadId) {
+    char buffer[64];
+
+    out->append(",\n{\"name\":");
+    AppendEscaped(out, event.name);
+    out->append(",\"cat\":\"");
+    out->append(GetCategoryName(event.category));
+    out->append("\",\"ph\":\"");
+    out->push_back(event.phase);
+    snprintf(buffer, sizeof(buffer), "\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+             event.timestamp * 1000.0 * 1000.0, threadId);
+    out->append(buffer);
+    if (event.flags & TRACE_EVENT_FLAG_HAS_ID) {
+        snprintf(buffer, sizeof(buffer), ",\"id\":\"0x%" PRIx64 "\"", event.id);
+        out->append(buffer);
+    }
+    if (event.phase == TRACE_EVENT_PHASE_INSTANT) {
+        out->append(",\"s\":\"t\"");
+    }
+    if (event.numArgs > 0) {
+        out->append(",\"args\":{");
+        for (size_t i = 0; i < event.numArgs; ++i) {
+            if (i > 0) {
+                out->push_back(',');
+            }
+            AppendEscaped(out, event.argNames[i]);
+            out->push_back(':');
+            AppendArgValue(out, event, i);
+        }
+        out->push_back('}');
+    }
+    out->push_back('}');
+}
+
+}  // anonymous namespace
+
+class TracingPlatform::Recorder {
+  public:
+    // The events of a thread, which is the only one writing to them. The slot of an event is
+    // claimed before it is written and the event is published after, so that exports running
+    // concurrently can skip the events that were overwritten while they were read, like with a
+    // seqlock.
+    struct ThreadBuffer {
+        ThreadBuffer(size_t capacity, std::thread::id owner, uint32_t threadId)
+            : events(capacity), owner(owner), threadId(threadId) {}
+
+        std::vector<Event> events;
+        std::atomic<uint64_t> claimedCount{0};
+        std::atomic<uint64_t> publishedCount{0};
+        const std::thread::id owner;
+        const uint32_t threadId;
+    };
+
+    explicit Recorder(size_t eventsPerThread)
+        : mEventsPerThread(std::max(eventsPerThread, size_t(1))),
+          mPlatformId(gNextPlatformId.fetch_add(1)),
+          mOrigin(std::chrono::steady_clock::now()) {}
+
+    ~Recorder() { EnableRecording(false); }
+
+    void EnableRecording(bool enable) {
+        if (mRecording.exchange(enable) == enable) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(gCategoryEnabledMutex);
+        if (enable) {
+            gRecordingPlatformCount++;
+        } else {
+            ASSERT(gRecordingPlatformCount > 0);
+            gRecordingPlatformCount--;
+        }
+        memset(gCategoryEnabled, gRecordingPlatformCount > 0 ? 1 : 0, sizeof(gCategoryEnabled));
+    }
+
+    bool IsRecording() const { return mRecording.load(std::memory_order_relaxed); }
+
+    double GetTime() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - mOrigin).count();
+    }
+
+    void AddEvent(char phase,
+                  const unsigned char* categoryGroupEnabled,
+                  const char* name,
+                  uint64_t id,
+                  double timestamp,
+                  int numArgs,
+                  const char** argNames,
+                  const unsigned char* argTypes,
+                  const uint64_t* argValues,
+                  unsigned char flags) {
+        // The category flags are shared, so another TracingPlatform may be recording.
+        if (!IsRecording()) {
+            return;
+        }
+
+        ThreadBuffer* buffer = GetThreadBuffer();
+        uint64_t index = buffer->publishedCount.load(std::memory_order_relaxed);
+        buffer->claimedCount.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Event& event = buffer->events[index % buffer->events.size()];
+        event.timestamp = timestamp;
+        event.id = id;
+        event.name = name;
+        event.phase = phase;
+        event.flags = flags;
+        ptrdiff_t category = categoryGroupEnabled - gCategoryEnabled;
+        event.category = category >= 0 && category < ptrdiff_t(kCategoryCount)
+                             ? static_cast<uint8_t>(category)
+                             : static_cast<uint8_t>(TraceCategory::General);
+        event.numArgs = static_cast<uint8_t>(std::min(size_t(std::max(numArgs, 0)), kMaxArgs));
+        for (size_t i = 0; i < event.numArgs; ++i) {
+            event.argNames[i] = argNames[i];
+            event.argTypes[i] = argTypes[i];
+            event.argValues[i] = argValues[i];
+            if (argTypes[i] == TRACE_VALUE_TYPE_STRING ||
+                argTypes[i] == TRACE_VALUE_TYPE_COPY_STRING) {
+                TraceEvent::TraceValueUnion value;
+                value.m_uint = argValues[i];
+                const char* str = value.m_string != nullptr ? value.m_string : "";
+                size_t length = strnlen(str, kMaxStringArgLength - 1);
+                memcpy(event.stringArgs[i], str, length);
+                event.stringArgs[i][length] = '\0';
+            }
+        }
+
+        buffer->publishedCount.store(index + 1, std::memory_order_release);
+    }
+
+    std::string ExportJSON() const {
+        std::string json = "{\"traceEvents\":[\n";
+        json.append(
+            "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Dawn\"}}");
+
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        std::vector<Event> events;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : mThreadBuffers) {
+            const size_t capacity = buffer->events.size();
+            uint64_t end = buffer->publishedCount.load(std::memory_order_acquire);
+            uint64_t begin = end > capacity ? end - capacity : 0;
+            events.clear();
+            for (uint64_t i = begin; i < end; ++i) {
+                events.push_back(buffer->events[i % capacity]);
+            }
+
+            // Skip the events whose slots were claimed again while they were copied.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t claimed = buffer->claimedCount.load(std::memory_order_relaxed);
+            uint64_t firstValid = claimed > capacity ? claimed - capacity : 0;
+            size_t skipped = static_cast<size_t>(std::min(
+                end - begin, firstValid > begin ? firstValid - begin : uint64_t(0)));
+
+            char name[96];
+            snprintf(name, sizeof(name),
+                     ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                     "\"args\":{\"name\":\"Thread %u\"}}",
+                     buffer->threadId, buffer->threadId);
+            json.append(name);
+            for (size_t i = skipped; i < events.size(); ++i) {
+                AppendEvent(&json, events[i], buffer->threadId);
+            }
+        }
+
+        json.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+        return json;
+    }
+
+    void ClearEvents() {
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : mThreadBuffers) {
+            buffer->claimedCount.store(0, std::memory_order_relaxed);
+            buffer->publishedCount.store(0, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    ThreadBuffer* GetThreadBuffer() {
+        // Cache the buffer of the thread for the last TracingPlatform it recorded events for.
+        struct Cache {
+            uint64_t platformId = 0;
+            ThreadBuffer* buffer = nullptr;
+        };
+        thread_local Cache cache;
+        if (cache.platformId == mPlatformId) {
+            return cache.buffer;
+        }
+
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        std::thread::id owner = std::this_thread::get_id();
+        ThreadBuffer* buffer = nullptr;
+        for (const std::unique_ptr<ThreadBuffer>& b : mThreadBuffers) {
+            if (b->owner == owner) {
+                buffer = b.get();
+                break;
+            }
+        }
+        if (buffer == nullptr) {
+            mThreadBuffers.push_back(std::make_unique<ThreadBuffer>(
+                mEventsPerThread, owner, static_cast<uint32_t>(mThreadBuffers.size() + 1)));
+            buffer = mThreadBuffers.back().get();
+        }
+
+        cache.platformId = mPlatformId;
+        cache.buffer = buffer;
+        return buffer;
+    }
+
+    const size_t mEventsPerThread;
+    const uint64_t mPlatformId;
+    const std::chrono::steady_clock::time_point mOrigin;
+    std::atomic<bool> mRecording{false};
+
+    // The buffers of the threads that recorded events. They are kept after the threads exit so
+    // that their events can be exported.
+    mutable std::mutex mThreadBuffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+};
+
+TracingPlatform::TracingPlatform(size_t eventsPerThread)
+    : mRecorder(std::make_unique<Recorder>(eventsPerThread)) {}
+
+TracingPlatform::~TracingPlatform() = default;
+
+void TracingPlatform::EnableRecording(bool enable) {
+    mRecorder->EnableRecording(enable);
+}
+
+bool TracingPlatform::IsRecording() const {
+    return mRecorder->IsRecording();
+}
+
+std::string TracingPlatform::ExportTraceJSON() const {
+    return mRecorder->ExportJSON();
+}
+
+bool TracingPlatform::WriteTraceJSON(const char* path) const {
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    std::string json = ExportTraceJSON();
+    file.write(json.data(), json.size());
+    return static_cast<bool>(file);
+}
+
+void TracingPlatform::ClearEvents() {
+    mRecorder->ClearEvents();
+}
+
+const unsigned char* TracingPlatform::GetTraceCategoryEnabledFlag(TraceCategory category) {
+    size_t index = static_cast<size_t>(category);
+    ASSERT(index < kCategoryCount);
+    return &gCategoryEnabled[index];
+}
+
+double TracingPlatform::MonotonicallyIncreasingTime() {
+    return mRecorder->GetTime();
+}
+
+uint64_t TracingPlatform::AddTraceEvent(char phase,
+                                        const unsigned char* categoryGroupEnabled,
+                                        const char* name,
+                                        uint64_t id,
+                                        double timestamp,
+                                        int numArgs,
+                                        const char** argNames,
+                                        const unsigned char* argTypes,
+                                        const uint64_t* argValues,
+                                        unsigned char flags) {
+    mRecorder->AddEvent(phase, categoryGroupEnabled, name, id, timestamp, numArgs, argNames,
+                        argTypes, argValues, flags);
+    return 0;
+}
+
+}  // namespace dawn::platform
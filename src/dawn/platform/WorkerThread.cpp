@@ -14,18 +14,60 @@
 
 #include "dawn/platform/WorkerThread.h"
 
-#include <condition_variable>
-#include <functional>
+#include <algorithm>
+#include <deque>
 #include <thread>
+#include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+#include "dawn/common/windows_with_undefs.h"
+#elif DAWN_PLATFORM_IS(APPLE)
+#include <pthread.h>
+#elif DAWN_PLATFORM_IS(LINUX)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::platform {
 
 namespace {
 
-class AsyncWaitableEventImpl {
-  public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
+// The worker pool and index of the current thread, if it is a worker thread. Used to queue tasks
+// posted from a worker on its own deque.
+thread_local const void* tCurrentPool = nullptr;
+thread_local uint32_t tCurrentWorkerIndex = 0;
+
+uint32_t GetDefaultMaxThreadCount() {
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::max(hardwareThreads, 2u) - 1u;
+}
+
+void SetCurrentThreadPriority(WorkerThreadPriority priority) {
+    if (priority == WorkerThreadPriority::Normal) {
+        return;
+    }
+#if DAWN_PLATFORM_IS(WINDOWS)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif DAWN_PLATFORM_IS(APPLE)
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif DAWN_PLATFORM_IS(LINUX)
+    // On Linux the nice value is per-thread when using the thread ID. Failing to lower the priority
+    // is harmless so the result is ignored.
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+}
+
+}  // anonymous namespace
 
+// The implementation of the events returned by PostWorkerTask. They are shared between the
+// WaitableEvent given to the caller and the task, and go back to the EventPool when both are done
+// with them.
+class AsyncWorkerThreadPool::WaitableEventImpl {
+  public:
     void Wait() {
         std::unique_lock<std::mutex> lock(mMutex);
         mCondition.wait(lock, [this] { return mIsComplete; });
@@ -44,47 +86,251 @@ class AsyncWaitableEventImpl {
         mCondition.notify_all();
     }
 
+    void Release();
+
   private:
+    friend class EventPool;
+
     std::mutex mMutex;
     std::condition_variable mCondition;
-    bool mIsComplete;
+    bool mIsComplete = false;
+
+    std::atomic<uint32_t> mRefCount{0};
+    // Only set while the event is in use so that events in the free list don't keep the pool
+    // alive.
+    std::shared_ptr<EventPool> mPool;
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+class AsyncWorkerThreadPool::EventPool : public std::enable_shared_from_this<EventPool> {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+    ~EventPool() {
+        for (WaitableEventImpl* event : mFreeEvents) {
+            delete event;
+        }
+    }
+
+    // Returns an event with two references: one for the caller and one for the task.
+    WaitableEventImpl* Acquire() {
+        WaitableEventImpl* event = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mFreeEvents.empty()) {
+                event = mFreeEvents.back();
+                mFreeEvents.pop_back();
+            }
+        }
+        if (event == nullptr) {
+            event = new WaitableEventImpl();
+        }
 
-    void Wait() override { mWaitableEventImpl->Wait(); }
+        event->mIsComplete = false;
+        event->mRefCount.store(2, std::memory_order_relaxed);
+        event->mPool = shared_from_this();
+        return event;
+    }
+
+    void Recycle(WaitableEventImpl* event) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFreeEvents.push_back(event);
+    }
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
+  private:
+    std::mutex mMutex;
+    std::vector<WaitableEventImpl*> mFreeEvents;
+};
 
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
+void AsyncWorkerThreadPool::WaitableEventImpl::Release() {
+    if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
     }
+    // Keep the pool alive while recycling the event, it might be the last reference to it.
+    std::shared_ptr<EventPool> pool = std::move(mPool);
+    pool->Recycle(this);
+}
+
+class AsyncWorkerThreadPool::AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+  public:
+    explicit AsyncWaitableEvent(WaitableEventImpl* impl) : mImpl(impl) {}
+    ~AsyncWaitableEvent() override { mImpl->Release(); }
+
+    void Wait() override { mImpl->Wait(); }
+
+    bool IsComplete() override { return mImpl->IsComplete(); }
 
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    WaitableEventImpl* mImpl;
 };
 
-}  // anonymous namespace
+struct AsyncWorkerThreadPool::Task {
+    dawn::platform::PostWorkerTaskCallback callback = nullptr;
+    void* userdata = nullptr;
+    WaitableEventImpl* event = nullptr;
+};
 
-namespace dawn::platform {
+struct AsyncWorkerThreadPool::Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::thread thread;
+};
+
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(const WorkerThreadPoolOptions& options)
+    : mMaxThreadCount(options.maxThreadCount != 0 ? options.maxThreadCount
+                                                  : GetDefaultMaxThreadCount()),
+      mPriority(options.priority),
+      mEventPool(std::make_shared<EventPool>()) {
+    mWorkers.reserve(mMaxThreadCount);
+    for (uint32_t i = 0; i < mMaxThreadCount; ++i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+
+    // Workers drain all the queued tasks before exiting.
+    uint32_t startedThreadCount = mStartedThreadCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < startedThreadCount; ++i) {
+        mWorkers[i]->thread.join();
+    }
+}
 
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+    StartWorkerIfNeeded();
+
+    Task task;
+    task.callback = callback;
+    task.userdata = userdata;
+    task.event = mEventPool->Acquire();
+    auto waitableEvent = std::make_unique<AsyncWaitableEvent>(task.event);
+
+    // Tasks posted from a worker go on its own deque, where they run next, since they likely use
+    // data that is hot in its cache. Other tasks are distributed round-robin over the workers.
+    uint32_t workerIndex;
+    if (tCurrentPool == this) {
+        workerIndex = tCurrentWorkerIndex;
+    } else {
+        workerIndex = mNextWorkerIndex.fetch_add(1, std::memory_order_relaxed) %
+                      mStartedThreadCount.load(std::memory_order_acquire);
+    }
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->tasks.push_back(task);
+    }
+    mPostedTaskCount.fetch_add(1, std::memory_order_relaxed);
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()]() {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    int64_t queued = mQueuedTaskCount.fetch_add(1) + 1;
+    uint64_t maxQueueDepth = mMaxQueueDepth.load(std::memory_order_relaxed);
+    while (queued > 0 && static_cast<uint64_t>(queued) > maxQueueDepth &&
+           !mMaxQueueDepth.compare_exchange_weak(maxQueueDepth, static_cast<uint64_t>(queued),
+                                                 std::memory_order_relaxed)) {
+    }
 
-    std::thread thread(doTask);
-    thread.detach();
+    // Workers count themselves as idle before checking mQueuedTaskCount a last time under mMutex,
+    // so either they see the new task or we see them and wake them up. Taking mMutex makes sure
+    // the notification doesn't arrive before they wait.
+    if (mIdleThreadCount.load() != 0) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCondition.notify_one();
+    }
 
     return waitableEvent;
 }
 
+WorkerThreadPoolStats AsyncWorkerThreadPool::GetStats() const {
+    WorkerThreadPoolStats stats;
+    stats.threadCount = mStartedThreadCount.load();
+    stats.queueDepth = static_cast<uint64_t>(std::max<int64_t>(mQueuedTaskCount.load(), 0));
+    stats.maxQueueDepth = mMaxQueueDepth.load();
+    stats.postedTaskCount = mPostedTaskCount.load();
+    stats.completedTaskCount = mCompletedTaskCount.load();
+    stats.stolenTaskCount = mStolenTaskCount.load();
+    return stats;
+}
+
+void AsyncWorkerThreadPool::StartWorkerIfNeeded() {
+    if (mStartedThreadCount.load(std::memory_order_acquire) == mMaxThreadCount) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    uint32_t startedThreadCount = mStartedThreadCount.load(std::memory_order_relaxed);
+    // Only start a new thread if no worker is waiting for work, or if there is none at all.
+    if (startedThreadCount == mMaxThreadCount ||
+        (startedThreadCount != 0 && mIdleThreadCount != 0)) {
+        return;
+    }
+
+    mWorkers[startedThreadCount]->thread =
+        std::thread([this, startedThreadCount] { WorkerLoop(startedThreadCount); });
+    mStartedThreadCount.store(startedThreadCount + 1, std::memory_order_release);
+}
+
+bool AsyncWorkerThreadPool::TryGetTask(uint32_t workerIndex, Task* task) {
+    // Pop the most recent task from our own deque first.
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->tasks.empty()) {
+            *task = worker->tasks.back();
+            worker->tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of the other workers.
+    uint32_t startedThreadCount = mStartedThreadCount.load(std::memory_order_acquire);
+    for (uint32_t i = 1; i < startedThreadCount; ++i) {
+        Worker* victim = mWorkers[(workerIndex + i) % startedThreadCount].get();
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->tasks.empty()) {
+            *task = victim->tasks.front();
+            victim->tasks.pop_front();
+            mStolenTaskCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void AsyncWorkerThreadPool::RunTask(const Task& task) {
+    task.callback(task.userdata);
+    task.event->MarkAsComplete();
+    task.event->Release();
+    mCompletedTaskCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncWorkerThreadPool::WorkerLoop(uint32_t workerIndex) {
+    tCurrentPool = this;
+    tCurrentWorkerIndex = workerIndex;
+    SetCurrentThreadPriority(mPriority);
+
+    while (true) {
+        Task task;
+        if (TryGetTask(workerIndex, &task)) {
+            mQueuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+            RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (mQueuedTaskCount.load(std::memory_order_relaxed) > 0) {
+            // A task was posted (or is being taken by another worker) since we looked.
+            continue;
+        }
+        if (mStopping) {
+            return;
+        }
+        mIdleThreadCount++;
+        mCondition.wait(lock, [this] { return mStopping || mQueuedTaskCount.load() > 0; });
+        mIdleThreadCount--;
+    }
+}
+
 }  // namespace dawn::platform
@@ -15,18 +15,95 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "dawn/common/NonCopyable.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
-class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
+enum class WorkerThreadPriority {
+    Normal,
+    // Lower than the threads of the application, for work that isn't latency sensitive.
+    Background,
+};
+
+struct WorkerThreadPoolOptions {
+    // The maximum number of worker threads. Threads are started lazily when tasks are posted and
+    // no worker is idle. Zero means one less than the number of hardware threads (at least one).
+    uint32_t maxThreadCount = 0;
+    WorkerThreadPriority priority = WorkerThreadPriority::Normal;
+};
+
+struct WorkerThreadPoolStats {
+    uint32_t threadCount = 0;
+    // Number of tasks posted but not started yet.
+    uint64_t queueDepth = 0;
+    uint64_t maxQueueDepth = 0;
+    uint64_t postedTaskCount = 0;
+    uint64_t completedTaskCount = 0;
+    // Number of tasks that were run by a worker other than the one they were queued on.
+    uint64_t stolenTaskCount = 0;
+};
+
+// A fixed-size pool of worker threads. Each worker has its own task deque: workers pop tasks from
+// the back of their deque and steal from the front of the other workers' deques when theirs is
+// empty. Tasks posted from a worker thread are queued on that worker's deque, other tasks are
+// distributed round-robin. The events returned by PostWorkerTask() are recycled by the pool.
+//
+// The destructor runs all the tasks that are still queued before joining the worker threads.
+class DAWN_PLATFORM_EXPORT AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool,
+                                                 public NonCopyable {
   public:
+    explicit AsyncWorkerThreadPool(const WorkerThreadPoolOptions& options = {});
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+    WorkerThreadPoolStats GetStats() const;
+
+  private:
+    class AsyncWaitableEvent;
+    class EventPool;
+    class WaitableEventImpl;
+    struct Task;
+    struct Worker;
+
+    void StartWorkerIfNeeded();
+    void WorkerLoop(uint32_t workerIndex);
+    bool TryGetTask(uint32_t workerIndex, Task* task);
+    void RunTask(const Task& task);
+
+    const uint32_t mMaxThreadCount;
+    const WorkerThreadPriority mPriority;
+
+    std::shared_ptr<EventPool> mEventPool;
+
+    // Allocated up front for all the workers but the threads are started lazily.
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::atomic<uint32_t> mStartedThreadCount{0};
+    std::atomic<uint32_t> mNextWorkerIndex{0};
+
+    // Protects starting workers and putting idle workers to sleep. Posting a task only takes it to
+    // wake up a worker when some are idle.
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::atomic<uint32_t> mIdleThreadCount{0};
+    bool mStopping = false;
+
+    // Signed since a task can be taken by a worker before the poster accounts for it.
+    std::atomic<int64_t> mQueuedTaskCount{0};
+    std::atomic<uint64_t> mMaxQueueDepth{0};
+    std::atomic<uint64_t> mPostedTaskCount{0};
+    std::atomic<uint64_t> mCompletedTaskCount{0};
+    std::atomic<uint64_t> mStolenTaskCount{0};
 };
 
 }  // namespace dawn::platform
@@ -166,6 +166,7 @@ class DawnTestEnvironment : public testing::Environment {
     void TearDown() override;
 
     bool UsesWire() const;
+    bool UsesWireCompactEncoding() const;
     bool IsImplicitDeviceSyncEnabled() const;
     dawn::native::BackendValidationLevel GetBackendValidationLevel() const;
     dawn::native::Instance* GetInstance() const;
@@ -194,6 +195,7 @@ class DawnTestEnvironment : public testing::Environment {
     bool ValidateToggles(dawn::native::Instance* instance) const;
 
     bool mUseWire = false;
+    bool mUseWireCompactEncoding = false;
     bool mEnableImplicitDeviceSync = false;
     dawn::native::BackendValidationLevel mBackendValidationLevel =
         dawn::native::BackendValidationLevel::Disabled;
@@ -618,6 +618,127 @@ TEST_P(CreatePipelineAsyncTest, CreateSameRenderPipelineTwiceAtSameTime) {
     }
 }
 
+// Verify that a synchronous creation of a compute pipeline that is still being created
+// asynchronously gets the same pipeline object as the asynchronous creation.
+TEST_P(CreatePipelineAsyncTest, CreateSameComputePipelineAsyncThenSync) {
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        struct SSBO {
+            value : u32
+        }
+        @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+        @compute @workgroup_size(1) fn main() {
+            ssbo.value = 1u;
+        })");
+    csDesc.compute.entryPoint = "main";
+
+    device.CreateComputePipelineAsync(
+        &csDesc,
+        [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline returnPipeline,
+           const char* message, void* userdata) {
+            EXPECT_EQ(WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success,
+                      status);
+
+            CreatePipelineAsyncTask* task = static_cast<CreatePipelineAsyncTask*>(userdata);
+            task->computePipeline = wgpu::ComputePipeline::Acquire(returnPipeline);
+            task->isCompleted = true;
+            task->message = message;
+        },
+        &task);
+    wgpu::ComputePipeline syncPipeline = device.CreateComputePipeline(&csDesc);
+
+    ValidateCreateComputePipelineAsync();
+
+    if (!UsesWire()) {
+        EXPECT_EQ(syncPipeline.Get(), task.computePipeline.Get());
+    }
+}
+
+// Verify that an asynchronous creation of a compute pipeline that was already created
+// synchronously gets the cached pipeline object.
+TEST_P(CreatePipelineAsyncTest, CreateSameComputePipelineSyncThenAsync) {
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        struct SSBO {
+            value : u32
+        }
+        @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+        @compute @workgroup_size(1) fn main() {
+            ssbo.value = 1u;
+        })");
+    csDesc.compute.entryPoint = "main";
+
+    wgpu::ComputePipeline syncPipeline = device.CreateComputePipeline(&csDesc);
+    device.CreateComputePipelineAsync(
+        &csDesc,
+        [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline returnPipeline,
+           const char* message, void* userdata) {
+            EXPECT_EQ(WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success,
+                      status);
+
+            CreatePipelineAsyncTask* task = static_cast<CreatePipelineAsyncTask*>(userdata);
+            task->computePipeline = wgpu::ComputePipeline::Acquire(returnPipeline);
+            task->isCompleted = true;
+            task->message = message;
+        },
+        &task);
+
+    ValidateCreateComputePipelineAsync();
+
+    if (!UsesWire()) {
+        EXPECT_EQ(syncPipeline.Get(), task.computePipeline.Get());
+    }
+}
+
+// Verify that a synchronous creation of a render pipeline that is still being created
+// asynchronously gets the same pipeline object as the asynchronous creation, and the other way
+// around.
+TEST_P(CreatePipelineAsyncTest, CreateSameRenderPipelineAsyncAndSync) {
+    utils::ComboRenderPipelineDescriptor renderPipelineDescriptor;
+    renderPipelineDescriptor.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f(0.0, 0.0, 0.0, 1.0);
+        })");
+    renderPipelineDescriptor.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    renderPipelineDescriptor.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    renderPipelineDescriptor.primitive.topology = wgpu::PrimitiveTopology::PointList;
+
+    DoCreateRenderPipelineAsync(renderPipelineDescriptor);
+    wgpu::RenderPipeline syncPipeline = device.CreateRenderPipeline(&renderPipelineDescriptor);
+
+    ValidateCreateRenderPipelineAsync();
+
+    if (!UsesWire()) {
+        EXPECT_EQ(syncPipeline.Get(), task.renderPipeline.Get());
+    }
+
+    // The pipeline is now in the cache, so creating it asynchronously again returns it too.
+    CreatePipelineAsyncTask anotherTask;
+    device.CreateRenderPipelineAsync(
+        &renderPipelineDescriptor,
+        [](WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline returnPipeline,
+           const char* message, void* userdata) {
+            EXPECT_EQ(WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success,
+                      status);
+
+            CreatePipelineAsyncTask* task = static_cast<CreatePipelineAsyncTask*>(userdata);
+            task->renderPipeline = wgpu::RenderPipeline::Acquire(returnPipeline);
+            task->isCompleted = true;
+            task->message = message;
+        },
+        &anotherTask);
+    ValidateCreateRenderPipelineAsync(&anotherTask);
+
+    if (!UsesWire()) {
+        EXPECT_EQ(syncPipeline.Get(), anotherTask.renderPipeline.Get());
+    }
+}
+
 // Verify calling CreateRenderPipelineAsync() with valid VertexBufferLayouts works on all backends.
 TEST_P(CreatePipelineAsyncTest, CreateRenderPipelineAsyncWithVertexBufferLayouts) {
     wgpu::TextureDescriptor textureDescriptor;
@@ -171,6 +171,90 @@ TEST_P(QueueWriteBufferTests, SuperLargeWriteBuffer) {
     EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), buffer, 0, kElements);
 }
 
+// Test that the staging buffers of writes larger than the dynamic uploader's ring buffers are
+// correctly reused once their writes are completed.
+TEST_P(QueueWriteBufferTests, ReuseLargeStagingBuffers) {
+    constexpr uint64_t kElements = 9000 * 1000;
+    constexpr uint64_t kSize = kElements * sizeof(uint32_t);
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = kSize;
+    descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    std::vector<uint32_t> expectedData(kElements);
+    for (uint32_t iteration = 0; iteration < 3; ++iteration) {
+        for (uint32_t i = 0; i < kElements; ++i) {
+            expectedData[i] = i + iteration;
+        }
+
+        queue.WriteBuffer(buffer, 0, expectedData.data(), kSize);
+        EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), buffer, 0, kElements);
+        WaitForAllOperations();
+    }
+}
+
+// Test WriteBuffer to mappable buffers, that some backends write to directly when they aren't used
+// by the GPU.
+TEST_P(QueueWriteBufferTests, WriteToMappableBuffer) {
+    constexpr uint32_t kElements = 16;
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = kElements * sizeof(uint32_t);
+    descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    auto MapAndCheck = [&](const std::vector<uint32_t>& expectedData) {
+        bool done = false;
+        buffer.MapAsync(
+            wgpu::MapMode::Read, 0, descriptor.size,
+            [](WGPUBufferMapAsyncStatus status, void* userdata) {
+                ASSERT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+                *static_cast<bool*>(userdata) = true;
+            },
+            &done);
+        while (!done) {
+            WaitABit();
+        }
+
+        const uint32_t* mapped =
+            static_cast<const uint32_t*>(buffer.GetConstMappedRange(0, descriptor.size));
+        for (uint32_t i = 0; i < kElements; ++i) {
+            EXPECT_EQ(mapped[i], expectedData[i]) << "at index " << i;
+        }
+        buffer.Unmap();
+    };
+
+    // A partial write to the uninitialized buffer leaves the rest of the buffer zeroed.
+    std::vector<uint32_t> expectedData(kElements, 0);
+    expectedData[4] = 0x01020304;
+    queue.WriteBuffer(buffer, 4 * sizeof(uint32_t), &expectedData[4], sizeof(uint32_t));
+    MapAndCheck(expectedData);
+
+    // Interleave writes with GPU copies to the buffer.
+    wgpu::Buffer source = utils::CreateBufferFromData(device, wgpu::BufferUsage::CopySrc,
+                                                      {0xAAAAAAAAu, 0xBBBBBBBBu});
+    for (uint32_t i = 0; i < kElements; ++i) {
+        expectedData[i] = i;
+    }
+    queue.WriteBuffer(buffer, 0, expectedData.data(), descriptor.size);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    encoder.CopyBufferToBuffer(source, 0, buffer, 0, 2 * sizeof(uint32_t));
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+    expectedData[0] = 0xAAAAAAAA;
+    expectedData[1] = 0xBBBBBBBB;
+
+    // This write is ordered after the copy even though the copy may still be executing.
+    expectedData[1] = 0xCCCCCCCC;
+    queue.WriteBuffer(buffer, sizeof(uint32_t), &expectedData[1], sizeof(uint32_t));
+    MapAndCheck(expectedData);
+
+    // The buffer is idle after being mapped, so this write can be done directly.
+    expectedData[2] = 0xDDDDDDDD;
+    queue.WriteBuffer(buffer, 2 * sizeof(uint32_t), &expectedData[2], sizeof(uint32_t));
+    MapAndCheck(expectedData);
+}
+
 // Test a special code path: writing when dynamic uploader already contatins some unaligned
 // data, it might be necessary to use a ring buffer with properly aligned offset.
 TEST_P(QueueWriteBufferTests, UnalignedDynamicUploader) {
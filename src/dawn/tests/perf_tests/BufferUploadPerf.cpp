@@ -23,6 +23,9 @@ constexpr unsigned int kNumIterations = 50;
 
 enum class UploadMethod {
     WriteBuffer,
+    // WriteBuffer to a MapRead buffer, which backends can write to directly instead of using a
+    // staging buffer.
+    WriteBufferToMappableBuffer,
     MappedAtCreation,
 };
 
@@ -35,6 +38,10 @@ enum class UploadSize {
 
     BufferSize_4MB = 4 * 1024 * 1024,
     BufferSize_16MB = 16 * 1024 * 1024,
+
+    // Sizes at and above the largest ring buffer of the DynamicUploader.
+    BufferSize_32MB = 32 * 1024 * 1024,
+    BufferSize_64MB = 64 * 1024 * 1024,
 };
 
 struct BufferUploadParams : AdapterTestParam {
@@ -54,6 +61,9 @@ std::ostream& operator<<(std::ostream& ostream, const BufferUploadParams& param)
         case UploadMethod::WriteBuffer:
             ostream << "_WriteBuffer";
             break;
+        case UploadMethod::WriteBufferToMappableBuffer:
+            ostream << "_WriteBufferToMappableBuffer";
+            break;
         case UploadMethod::MappedAtCreation:
             ostream << "_MappedAtCreation";
             break;
@@ -75,6 +85,12 @@ std::ostream& operator<<(std::ostream& ostream, const BufferUploadParams& param)
         case UploadSize::BufferSize_16MB:
             ostream << "_BufferSize_16MB";
             break;
+        case UploadSize::BufferSize_32MB:
+            ostream << "_BufferSize_32MB";
+            break;
+        case UploadSize::BufferSize_64MB:
+            ostream << "_BufferSize_64MB";
+            break;
     }
 
     return ostream;
@@ -105,13 +121,17 @@ void BufferUploadPerf::SetUp() {
     wgpu::BufferDescriptor desc = {};
     desc.size = data.size();
     desc.usage = wgpu::BufferUsage::CopyDst;
+    if (GetParam().uploadMethod == UploadMethod::WriteBufferToMappableBuffer) {
+        desc.usage |= wgpu::BufferUsage::MapRead;
+    }
 
     dst = device.CreateBuffer(&desc);
 }
 
 void BufferUploadPerf::Step() {
     switch (GetParam().uploadMethod) {
-        case UploadMethod::WriteBuffer: {
+        case UploadMethod::WriteBuffer:
+        case UploadMethod::WriteBufferToMappableBuffer: {
             for (unsigned int i = 0; i < kNumIterations; ++i) {
                 queue.WriteBuffer(dst, 0, data.data(), data.size());
             }
@@ -149,7 +169,9 @@ TEST_P(BufferUploadPerf, Run) {
 DAWN_INSTANTIATE_TEST_P(BufferUploadPerf,
                         {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
                          VulkanBackend()},
-                        {UploadMethod::WriteBuffer, UploadMethod::MappedAtCreation},
+                        {UploadMethod::WriteBuffer, UploadMethod::WriteBufferToMappableBuffer,
+                         UploadMethod::MappedAtCreation},
                         {UploadSize::BufferSize_1KB, UploadSize::BufferSize_64KB,
                          UploadSize::BufferSize_1MB, UploadSize::BufferSize_4MB,
-                         UploadSize::BufferSize_16MB});
+                         UploadSize::BufferSize_16MB, UploadSize::BufferSize_32MB,
+                         UploadSize::BufferSize_64MB});
@@ -615,6 +615,11 @@ DAWN_INSTANTIATE_TEST_P(
         // Redundantly set pipeline / bind groups
         MakeParam(Pipeline::Redundant, BindGroup::Redundant),
 
+        // Switch the bind group and the vertex buffer every draw, or redundantly set the pipeline
+        // while switching bind groups, to measure the incremental validation of draw state.
+        MakeParam(BindGroup::Multiple, VertexBuffer::Multiple),
+        MakeParam(Pipeline::Redundant, BindGroup::Multiple),
+
         // Switch the pipeline every draw to test state tracking and updates to binding points
         MakeParam(Pipeline::Dynamic,
                   BindGroup::Multiple),  // Multiple bind groups w/ dynamic pipeline
@@ -650,3 +655,15 @@ DAWN_INSTANTIATE_TEST_P(
         MakeParam(BindGroup::Dynamic,
                   UniformData::Dynamic),  // Update per-draw data: Dynamic bind groups
     });
+
+// Runs the baseline parameters without the device-level pool of command allocator blocks, to
+// compare against the baseline of DrawCallPerf.
+class DrawCallPerfNoCommandBlockPool : public DrawCallPerf {};
+
+TEST_P(DrawCallPerfNoCommandBlockPool, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(DrawCallPerfNoCommandBlockPool,
+                        {VulkanBackend({"disable_command_block_pool"})},
+                        {MakeParam()});
@@ -0,0 +1,145 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kNumIterations = 50;
+
+// Number of objects created by each thread in each step.
+constexpr uint32_t kObjectsPerThread = 200;
+// Number of distinct descriptors used, so that most creations hit the device caches.
+constexpr uint32_t kDistinctObjects = 16;
+
+enum class CachedObjectType {
+    Sampler,
+    BindGroupLayout,
+};
+
+struct ObjectCacheParams : AdapterTestParam {
+    ObjectCacheParams(const AdapterTestParam& param,
+                      CachedObjectType objectType,
+                      uint32_t threadCount)
+        : AdapterTestParam(param), objectType(objectType), threadCount(threadCount) {}
+
+    CachedObjectType objectType;
+    uint32_t threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ObjectCacheParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.objectType) {
+        case CachedObjectType::Sampler:
+            ostream << "_Sampler";
+            break;
+        case CachedObjectType::BindGroupLayout:
+            ostream << "_BindGroupLayout";
+            break;
+    }
+
+    ostream << "_" << param.threadCount << "Threads";
+    return ostream;
+}
+
+}  // namespace
+
+// Test the contention on the device object caches when several threads create deduplicated
+// objects at the same time. Each thread creates objects from a small set of descriptors so that
+// nearly all creations are cache lookups.
+class ObjectCachePerf : public DawnPerfTestWithParams<ObjectCacheParams> {
+  public:
+    ObjectCachePerf()
+        : DawnPerfTestWithParams(kNumIterations * kObjectsPerThread * GetParam().threadCount, 1) {}
+    ~ObjectCachePerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    std::vector<wgpu::FeatureName> GetRequiredFeatures() override {
+        if (SupportsFeatures({wgpu::FeatureName::ImplicitDeviceSynchronization})) {
+            return {wgpu::FeatureName::ImplicitDeviceSynchronization};
+        }
+        return {};
+    }
+
+  private:
+    void Step() override;
+    void CreateObjects(uint32_t threadIndex);
+};
+
+void ObjectCachePerf::SetUp() {
+    DawnPerfTestWithParams<ObjectCacheParams>::SetUp();
+
+    // Using the device from multiple threads requires the implicit device synchronization and
+    // isn't supported through the wire.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+    DAWN_TEST_UNSUPPORTED_IF(
+        GetParam().threadCount > 1 &&
+        !SupportsFeatures({wgpu::FeatureName::ImplicitDeviceSynchronization}));
+}
+
+void ObjectCachePerf::CreateObjects(uint32_t threadIndex) {
+    for (unsigned int iteration = 0; iteration < kNumIterations; ++iteration) {
+        for (uint32_t i = 0; i < kObjectsPerThread; ++i) {
+            uint32_t variant = (threadIndex + i) % kDistinctObjects;
+            switch (GetParam().objectType) {
+                case CachedObjectType::Sampler: {
+                    wgpu::SamplerDescriptor desc;
+                    desc.lodMaxClamp = static_cast<float>(variant + 1);
+                    wgpu::Sampler sampler = device.CreateSampler(&desc);
+                    break;
+                }
+                case CachedObjectType::BindGroupLayout: {
+                    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+                        device, {{variant, wgpu::ShaderStage::Compute,
+                                  wgpu::BufferBindingType::Uniform}});
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void ObjectCachePerf::Step() {
+    uint32_t threadCount = GetParam().threadCount;
+    if (threadCount == 1) {
+        CreateObjects(0);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (uint32_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t] { CreateObjects(t); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_P(ObjectCachePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ObjectCachePerf,
+                        {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {CachedObjectType::Sampler, CachedObjectType::BindGroupLayout},
+                        {1, 4, 8});
@@ -0,0 +1,146 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr uint32_t kNumDraws = 100000;
+constexpr uint32_t kTextureSize = 64;
+
+constexpr char kVertexShader[] = R"(
+        @vertex fn main(@builtin(vertex_index) vertexIndex : u32) -> @builtin(position) vec4f {
+            var pos = array(vec2f(-1.0, -1.0), vec2f(1.0, -1.0), vec2f(-1.0, 1.0));
+            return vec4f(pos[vertexIndex] * 0.01, 0.0, 1.0);
+        })";
+
+constexpr char kFragmentShader[] = R"(
+        @group(0) @binding(0) var<uniform> color : vec4f;
+        @fragment fn main() -> @location(0) vec4f {
+            return color;
+        })";
+
+struct ParallelEncodingParams : AdapterTestParam {
+    ParallelEncodingParams(const AdapterTestParam& param, uint32_t threadCount)
+        : AdapterTestParam(param), threadCount(threadCount) {}
+
+    uint32_t threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ParallelEncodingParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.threadCount << "Threads";
+    return ostream;
+}
+
+}  // namespace
+
+// Test encoding a render pass with many draws split between secondary render pass encoders
+// recorded on several threads. With a single thread, the draws are recorded directly in the
+// render pass encoder.
+class ParallelEncodingPerf : public DawnPerfTestWithParams<ParallelEncodingParams> {
+  public:
+    ParallelEncodingPerf() : DawnPerfTestWithParams(kNumDraws, 3) {}
+    ~ParallelEncodingPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+    void RecordDraws(wgpu::RenderPassEncoder pass, uint32_t drawCount);
+
+    wgpu::TextureView mColorAttachment;
+    wgpu::RenderPipeline mPipeline;
+    wgpu::BindGroup mBindGroup;
+};
+
+void ParallelEncodingPerf::SetUp() {
+    DawnPerfTestWithParams<ParallelEncodingParams>::SetUp();
+
+    // The wire client isn't thread-safe.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+    wgpu::TextureDescriptor descriptor;
+    descriptor.size = {kTextureSize, kTextureSize};
+    descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    descriptor.usage = wgpu::TextureUsage::RenderAttachment;
+    mColorAttachment = device.CreateTexture(&descriptor).CreateView();
+
+    utils::ComboRenderPipelineDescriptor pipelineDescriptor;
+    pipelineDescriptor.vertex.module = utils::CreateShaderModule(device, kVertexShader);
+    pipelineDescriptor.cFragment.module = utils::CreateShaderModule(device, kFragmentShader);
+    mPipeline = device.CreateRenderPipeline(&pipelineDescriptor);
+
+    float color[4] = {0.0, 1.0, 0.0, 1.0};
+    wgpu::Buffer uniformBuffer = utils::CreateBufferFromData(device, color, sizeof(color),
+                                                             wgpu::BufferUsage::Uniform);
+    mBindGroup =
+        utils::MakeBindGroup(device, mPipeline.GetBindGroupLayout(0), {{0, uniformBuffer}});
+}
+
+void ParallelEncodingPerf::RecordDraws(wgpu::RenderPassEncoder pass, uint32_t drawCount) {
+    pass.SetPipeline(mPipeline);
+    pass.SetBindGroup(0, mBindGroup);
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        pass.Draw(3);
+    }
+}
+
+void ParallelEncodingPerf::Step() {
+    uint32_t threadCount = GetParam().threadCount;
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+
+    if (threadCount == 1) {
+        RecordDraws(pass, kNumDraws);
+    } else {
+        std::vector<wgpu::RenderPassEncoder> secondaries(threadCount);
+        for (wgpu::RenderPassEncoder& secondary : secondaries) {
+            secondary = pass.CreateSecondaryEncoder();
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (uint32_t t = 0; t < threadCount; ++t) {
+            uint32_t drawCount = kNumDraws / threadCount + (t < kNumDraws % threadCount ? 1 : 0);
+            threads.emplace_back([this, &secondaries, t, drawCount] {
+                RecordDraws(secondaries[t], drawCount);
+                secondaries[t].End();
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+    queue.Submit(1, &commandBuffer);
+}
+
+TEST_P(ParallelEncodingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ParallelEncodingPerf,
+                        {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {1, 2, 4, 8});
@@ -0,0 +1,280 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace {
+
+enum class MemoryTransfer {
+    Inline,
+    SharedMemory,
+};
+
+enum class Direction {
+    Upload,
+    Readback,
+};
+
+enum class BufferSize {
+    BufferSize_1MB = 1024 * 1024,
+    BufferSize_16MB = 16 * 1024 * 1024,
+    BufferSize_256MB = 256 * 1024 * 1024,
+};
+
+struct WireMemoryTransferParams : AdapterTestParam {
+    WireMemoryTransferParams(const AdapterTestParam& param,
+                             MemoryTransfer memoryTransfer,
+                             Direction direction,
+                             BufferSize bufferSize)
+        : AdapterTestParam(param),
+          memoryTransfer(memoryTransfer),
+          direction(direction),
+          bufferSize(bufferSize) {}
+
+    MemoryTransfer memoryTransfer;
+    Direction direction;
+    BufferSize bufferSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireMemoryTransferParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.memoryTransfer) {
+        case MemoryTransfer::Inline:
+            ostream << "_Inline";
+            break;
+        case MemoryTransfer::SharedMemory:
+            ostream << "_SharedMemory";
+            break;
+    }
+
+    switch (param.direction) {
+        case Direction::Upload:
+            ostream << "_Upload";
+            break;
+        case Direction::Readback:
+            ostream << "_Readback";
+            break;
+    }
+
+    switch (param.bufferSize) {
+        case BufferSize::BufferSize_1MB:
+            ostream << "_BufferSize_1MB";
+            break;
+        case BufferSize::BufferSize_16MB:
+            ostream << "_BufferSize_16MB";
+            break;
+        case BufferSize::BufferSize_256MB:
+            ostream << "_BufferSize_256MB";
+            break;
+    }
+
+    return ostream;
+}
+
+}  // namespace
+
+// Test the throughput of mapping buffers through the wire with the inline MemoryTransferService,
+// which sends the content of the buffers in the commands, and with the shared memory one. Each
+// step maps the whole buffer, fills or reads it on the client and unmaps it. The client and the
+// server are in the same process and the commands are sent with TerribleCommandBuffers. The
+// client objects are created through the procs of the client since the procs of the test are the
+// native ones.
+class WireMemoryTransferPerf : public DawnPerfTestWithParams<WireMemoryTransferParams> {
+  public:
+    WireMemoryTransferPerf() : DawnPerfTestWithParams(1, 1), mTimer(utils::CreateTimer()) {}
+    ~WireMemoryTransferPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    void PrintThroughput();
+
+  private:
+    void Step() override;
+
+    // Maps the buffer and waits for the callback of the client.
+    bool MapBuffer(WGPUMapMode mode);
+
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    std::unique_ptr<dawn::wire::client::MemoryTransferService> mClientMemoryTransferService;
+    std::unique_ptr<dawn::wire::server::MemoryTransferService> mServerMemoryTransferService;
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuf;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuf;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    WGPUDevice mClientDevice = nullptr;
+    WGPUBuffer mBuffer = nullptr;
+
+    uint64_t mBytesTransferred = 0;
+    double mElapsedTime = 0;
+    std::unique_ptr<utils::Timer> mTimer;
+};
+
+void WireMemoryTransferPerf::SetUp() {
+    DawnPerfTestWithParams<WireMemoryTransferParams>::SetUp();
+
+    // The server forwards the commands to the device of the test, which must be a native device.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+    if (GetParam().memoryTransfer == MemoryTransfer::SharedMemory) {
+        // Shared memory names are limited to 31 characters on macOS.
+        uint64_t timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::string prefix = "/dawn-perf-" + std::to_string(timestamp % 1'000'000'000'000ull);
+        mClientMemoryTransferService =
+            dawn::wire::client::CreateSharedMemoryTransferService(prefix.c_str());
+        DAWN_TEST_UNSUPPORTED_IF(mClientMemoryTransferService == nullptr);
+        mServerMemoryTransferService =
+            dawn::wire::server::CreateSharedMemoryTransferService(prefix.c_str());
+        ASSERT_NE(mServerMemoryTransferService, nullptr);
+    }
+
+    mC2sBuf = std::make_unique<utils::TerribleCommandBuffer>();
+    mS2cBuf = std::make_unique<utils::TerribleCommandBuffer>();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &dawn::native::GetProcs();
+    serverDesc.serializer = mS2cBuf.get();
+    serverDesc.memoryTransferService = mServerMemoryTransferService.get();
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+    mC2sBuf->SetHandler(mWireServer.get());
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = mC2sBuf.get();
+    clientDesc.memoryTransferService = mClientMemoryTransferService.get();
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+    mS2cBuf->SetHandler(mWireClient.get());
+
+    dawn::wire::ReservedDevice reservation = mWireClient->ReserveDevice();
+    ASSERT_TRUE(mWireServer->InjectDevice(device.Get(), reservation.id, reservation.generation));
+    mClientDevice = reservation.device;
+
+    WGPUBufferDescriptor bufferDesc = {};
+    bufferDesc.size = static_cast<uint64_t>(GetParam().bufferSize);
+    bufferDesc.usage = GetParam().direction == Direction::Upload
+                           ? WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc
+                           : WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst;
+    mBuffer = mClientProcs.deviceCreateBuffer(mClientDevice, &bufferDesc);
+    ASSERT_TRUE(mC2sBuf->Flush());
+}
+
+void WireMemoryTransferPerf::TearDown() {
+    if (mWireClient != nullptr) {
+        if (mClientDevice != nullptr) {
+            mClientProcs.bufferRelease(mBuffer);
+            mClientProcs.deviceRelease(mClientDevice);
+            mC2sBuf->Flush();
+        }
+        mWireClient = nullptr;
+        mWireServer = nullptr;
+    }
+    DawnPerfTestWithParams<WireMemoryTransferParams>::TearDown();
+}
+
+bool WireMemoryTransferPerf::MapBuffer(WGPUMapMode mode) {
+    bool done = false;
+    WGPUBufferMapAsyncStatus status = WGPUBufferMapAsyncStatus_Unknown;
+    struct Userdata {
+        bool* done;
+        WGPUBufferMapAsyncStatus* status;
+    } userdata = {&done, &status};
+
+    mClientProcs.bufferMapAsync(
+        mBuffer, mode, 0, static_cast<size_t>(GetParam().bufferSize),
+        [](WGPUBufferMapAsyncStatus status, void* userdata) {
+            Userdata* data = static_cast<Userdata*>(userdata);
+            *data->status = status;
+            *data->done = true;
+        },
+        &userdata);
+
+    if (!mC2sBuf->Flush()) {
+        return false;
+    }
+    while (!done) {
+        device.Tick();
+        if (!mS2cBuf->Flush()) {
+            return false;
+        }
+    }
+    return status == WGPUBufferMapAsyncStatus_Success;
+}
+
+void WireMemoryTransferPerf::Step() {
+    const size_t size = static_cast<size_t>(GetParam().bufferSize);
+
+    mTimer->Start();
+    if (GetParam().direction == Direction::Upload) {
+        if (!MapBuffer(WGPUMapMode_Write)) {
+            AbortTest();
+            return;
+        }
+        void* data = mClientProcs.bufferGetMappedRange(mBuffer, 0, size);
+        memset(data, static_cast<int>(mBytesTransferred / size), size);
+    } else {
+        if (!MapBuffer(WGPUMapMode_Read)) {
+            AbortTest();
+            return;
+        }
+        // Only touch the data since reading it would be the same cost for both services.
+        const volatile uint8_t* data = static_cast<const volatile uint8_t*>(
+            mClientProcs.bufferGetConstMappedRange(mBuffer, 0, size));
+        (void)data[size - 1];
+    }
+    mClientProcs.bufferUnmap(mBuffer);
+    bool success = mC2sBuf->Flush();
+    mTimer->Stop();
+
+    if (!success) {
+        AbortTest();
+        return;
+    }
+    mElapsedTime += mTimer->GetElapsedTime();
+    mBytesTransferred += size;
+}
+
+void WireMemoryTransferPerf::PrintThroughput() {
+    if (mElapsedTime == 0) {
+        return;
+    }
+    PrintResult("throughput",
+                static_cast<double>(mBytesTransferred) / (1024 * 1024) / mElapsedTime, "MB/s",
+                true);
+}
+
+TEST_P(WireMemoryTransferPerf, Run) {
+    RunTest();
+    PrintThroughput();
+}
+
+DAWN_INSTANTIATE_TEST_P(WireMemoryTransferPerf,
+                        {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {MemoryTransfer::Inline, MemoryTransfer::SharedMemory},
+                        {Direction::Upload, Direction::Readback},
+                        {BufferSize::BufferSize_1MB, BufferSize::BufferSize_16MB,
+                         BufferSize::BufferSize_256MB});
@@ -0,0 +1,333 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace {
+
+constexpr uint32_t kNumDraws = 10000;
+constexpr uint32_t kTextureSize = 64;
+
+constexpr char kShader[] = R"(
+        @group(0) @binding(0) var<uniform> color : vec4f;
+
+        @vertex fn vs_main(@location(0) pos : vec4f) -> @builtin(position) vec4f {
+            return pos;
+        }
+
+        @fragment fn fs_main() -> @location(0) vec4f {
+            return color;
+        })";
+
+enum class Encoding {
+    Regular,
+    Compact,
+};
+
+struct WireServerParams : AdapterTestParam {
+    WireServerParams(const AdapterTestParam& param, Encoding encoding)
+        : AdapterTestParam(param), encoding(encoding) {}
+
+    Encoding encoding;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireServerParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.encoding) {
+        case Encoding::Regular:
+            ostream << "_RegularEncoding";
+            break;
+        case Encoding::Compact:
+            ostream << "_CompactEncoding";
+            break;
+    }
+
+    return ostream;
+}
+
+// Records the commands of the client so that they can be handled by the server later, any number
+// of times.
+class RecordingCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    size_t GetMaximumAllocationSize() const override { return 16 * 1024 * 1024; }
+
+    void* GetCmdSpace(size_t size) override {
+        size_t offset = mCommands.size();
+        mCommands.resize(offset + size);
+        return mCommands.data() + offset;
+    }
+
+    bool Flush() override { return true; }
+
+    std::vector<char> TakeCommands() { return std::move(mCommands); }
+
+  private:
+    std::vector<char> mCommands;
+};
+
+}  // namespace
+
+// Test the time the wire server takes to handle the commands of a render pass with many draws,
+// each changing the pipeline, the bind group and the vertex buffer. The commands are recorded by
+// a wire client once, and only handling them on the server is measured, which includes encoding
+// them in dawn::native. The client objects are created through the procs of the client since the
+// procs of the test are the native ones.
+class WireServerPerf : public DawnPerfTestWithParams<WireServerParams> {
+  public:
+    WireServerPerf() : DawnPerfTestWithParams(kNumDraws, 1), mTimer(utils::CreateTimer()) {}
+    ~WireServerPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    void PrintServerResults();
+
+  private:
+    void Step() override;
+
+    // Sends the commands recorded since the last call to the server.
+    bool FlushClient();
+    void BeginRenderPass();
+    void EndRenderPass();
+
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    RecordingCommandSerializer mC2sBuf;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuf;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    WGPUDevice mClientDevice = nullptr;
+    WGPUTextureView mColorAttachment = nullptr;
+    WGPURenderPipeline mPipeline = nullptr;
+    WGPUBindGroup mBindGroup = nullptr;
+    WGPUBuffer mVertexBuffer = nullptr;
+    WGPUCommandEncoder mEncoder = nullptr;
+    WGPURenderPassEncoder mPass = nullptr;
+
+    // The draws of a render pass and its RenderPassEncoderEnd, recorded once.
+    std::vector<char> mDrawCommands;
+
+    double mServerTime = 0;
+    uint64_t mDrawsHandled = 0;
+    std::unique_ptr<utils::Timer> mTimer;
+};
+
+void WireServerPerf::SetUp() {
+    DawnPerfTestWithParams<WireServerParams>::SetUp();
+
+    // The server forwards the commands to the device of the test, which must be a native device.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+    bool useCompactEncoding = GetParam().encoding == Encoding::Compact;
+
+    mS2cBuf = std::make_unique<utils::TerribleCommandBuffer>();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &dawn::native::GetProcs();
+    serverDesc.serializer = mS2cBuf.get();
+    serverDesc.acceptCompactEncoding = useCompactEncoding;
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = &mC2sBuf;
+    clientDesc.useCompactEncoding = useCompactEncoding;
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+    mS2cBuf->SetHandler(mWireClient.get());
+
+    dawn::wire::ReservedDevice reservation = mWireClient->ReserveDevice();
+    ASSERT_TRUE(mWireServer->InjectDevice(device.Get(), reservation.id, reservation.generation));
+    mClientDevice = reservation.device;
+
+    WGPUTextureDescriptor textureDesc = {};
+    textureDesc.dimension = WGPUTextureDimension_2D;
+    textureDesc.size = {kTextureSize, kTextureSize, 1};
+    textureDesc.format = WGPUTextureFormat_RGBA8Unorm;
+    textureDesc.usage = WGPUTextureUsage_RenderAttachment;
+    textureDesc.mipLevelCount = 1;
+    textureDesc.sampleCount = 1;
+    WGPUTexture texture = mClientProcs.deviceCreateTexture(mClientDevice, &textureDesc);
+    mColorAttachment = mClientProcs.textureCreateView(texture, nullptr);
+    mClientProcs.textureRelease(texture);
+
+    WGPUShaderModuleWGSLDescriptor wgslDesc = {};
+    wgslDesc.chain.sType = WGPUSType_ShaderModuleWGSLDescriptor;
+    wgslDesc.source = kShader;
+    WGPUShaderModuleDescriptor moduleDesc = {};
+    moduleDesc.nextInChain = &wgslDesc.chain;
+    WGPUShaderModule module = mClientProcs.deviceCreateShaderModule(mClientDevice, &moduleDesc);
+
+    WGPUVertexAttribute attribute = {};
+    attribute.format = WGPUVertexFormat_Float32x4;
+    attribute.shaderLocation = 0;
+    WGPUVertexBufferLayout vertexBufferLayout = {};
+    vertexBufferLayout.arrayStride = 4 * sizeof(float);
+    vertexBufferLayout.stepMode = WGPUVertexStepMode_Vertex;
+    vertexBufferLayout.attributeCount = 1;
+    vertexBufferLayout.attributes = &attribute;
+
+    WGPUColorTargetState colorTarget = {};
+    colorTarget.format = WGPUTextureFormat_RGBA8Unorm;
+    colorTarget.writeMask = WGPUColorWriteMask_All;
+    WGPUFragmentState fragment = {};
+    fragment.module = module;
+    fragment.entryPoint = "fs_main";
+    fragment.targetCount = 1;
+    fragment.targets = &colorTarget;
+
+    WGPURenderPipelineDescriptor pipelineDesc = {};
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs_main";
+    pipelineDesc.vertex.bufferCount = 1;
+    pipelineDesc.vertex.buffers = &vertexBufferLayout;
+    pipelineDesc.primitive.topology = WGPUPrimitiveTopology_TriangleList;
+    pipelineDesc.multisample.count = 1;
+    pipelineDesc.multisample.mask = 0xFFFFFFFF;
+    pipelineDesc.fragment = &fragment;
+    mPipeline = mClientProcs.deviceCreateRenderPipeline(mClientDevice, &pipelineDesc);
+    mClientProcs.shaderModuleRelease(module);
+
+    WGPUBufferDescriptor bufferDesc = {};
+    bufferDesc.size = 4 * sizeof(float);
+    bufferDesc.usage = WGPUBufferUsage_Uniform;
+    WGPUBuffer uniformBuffer = mClientProcs.deviceCreateBuffer(mClientDevice, &bufferDesc);
+    bufferDesc.size = 3 * 4 * sizeof(float);
+    bufferDesc.usage = WGPUBufferUsage_Vertex;
+    mVertexBuffer = mClientProcs.deviceCreateBuffer(mClientDevice, &bufferDesc);
+
+    WGPUBindGroupEntry entry = {};
+    entry.binding = 0;
+    entry.buffer = uniformBuffer;
+    entry.size = WGPU_WHOLE_SIZE;
+    WGPUBindGroupDescriptor bindGroupDesc = {};
+    bindGroupDesc.layout = mClientProcs.renderPipelineGetBindGroupLayout(mPipeline, 0);
+    bindGroupDesc.entryCount = 1;
+    bindGroupDesc.entries = &entry;
+    mBindGroup = mClientProcs.deviceCreateBindGroup(mClientDevice, &bindGroupDesc);
+    mClientProcs.bindGroupLayoutRelease(bindGroupDesc.layout);
+    mClientProcs.bufferRelease(uniformBuffer);
+    ASSERT_TRUE(FlushClient());
+
+    // Record the draws of a render pass once. Ending the render pass sends the packed commands,
+    // if any. The IDs of the render pass encoders of the client are recycled, so the render pass
+    // of each step has the same ID as this one.
+    BeginRenderPass();
+    ASSERT_TRUE(FlushClient());
+    for (uint32_t i = 0; i < kNumDraws; ++i) {
+        mClientProcs.renderPassEncoderSetPipeline(mPass, mPipeline);
+        mClientProcs.renderPassEncoderSetBindGroup(mPass, 0, mBindGroup, 0, nullptr);
+        mClientProcs.renderPassEncoderSetVertexBuffer(mPass, 0, mVertexBuffer, 0, WGPU_WHOLE_SIZE);
+        mClientProcs.renderPassEncoderDraw(mPass, 3, 1, 0, 0);
+    }
+    mClientProcs.renderPassEncoderEnd(mPass);
+    mDrawCommands = mC2sBuf.TakeCommands();
+    ASSERT_TRUE(mWireServer->HandleCommands(mDrawCommands.data(), mDrawCommands.size()) !=
+                nullptr);
+    EndRenderPass();
+    ASSERT_TRUE(FlushClient());
+}
+
+void WireServerPerf::TearDown() {
+    if (mWireClient != nullptr) {
+        if (mClientDevice != nullptr) {
+            mClientProcs.textureViewRelease(mColorAttachment);
+            mClientProcs.renderPipelineRelease(mPipeline);
+            mClientProcs.bindGroupRelease(mBindGroup);
+            mClientProcs.bufferRelease(mVertexBuffer);
+            mClientProcs.deviceRelease(mClientDevice);
+            FlushClient();
+        }
+        mWireClient = nullptr;
+        mWireServer = nullptr;
+    }
+    DawnPerfTestWithParams<WireServerParams>::TearDown();
+}
+
+bool WireServerPerf::FlushClient() {
+    std::vector<char> commands = mC2sBuf.TakeCommands();
+    return commands.empty() ||
+           mWireServer->HandleCommands(commands.data(), commands.size()) != nullptr;
+}
+
+void WireServerPerf::BeginRenderPass() {
+    WGPURenderPassColorAttachment colorAttachment = {};
+    colorAttachment.view = mColorAttachment;
+    colorAttachment.loadOp = WGPULoadOp_Clear;
+    colorAttachment.storeOp = WGPUStoreOp_Store;
+    WGPURenderPassDescriptor renderPassDesc = {};
+    renderPassDesc.colorAttachmentCount = 1;
+    renderPassDesc.colorAttachments = &colorAttachment;
+
+    mEncoder = mClientProcs.deviceCreateCommandEncoder(mClientDevice, nullptr);
+    mPass = mClientProcs.commandEncoderBeginRenderPass(mEncoder, &renderPassDesc);
+}
+
+void WireServerPerf::EndRenderPass() {
+    WGPUCommandBuffer commandBuffer = mClientProcs.commandEncoderFinish(mEncoder, nullptr);
+    mClientProcs.commandBufferRelease(commandBuffer);
+    mClientProcs.renderPassEncoderRelease(mPass);
+    mClientProcs.commandEncoderRelease(mEncoder);
+    mPass = nullptr;
+    mEncoder = nullptr;
+}
+
+void WireServerPerf::Step() {
+    BeginRenderPass();
+    if (!FlushClient()) {
+        AbortTest();
+        return;
+    }
+
+    mTimer->Start();
+    bool success =
+        mWireServer->HandleCommands(mDrawCommands.data(), mDrawCommands.size()) != nullptr;
+    mTimer->Stop();
+    mServerTime += mTimer->GetElapsedTime();
+    mDrawsHandled += kNumDraws;
+
+    EndRenderPass();
+    if (!success || !FlushClient()) {
+        AbortTest();
+    }
+}
+
+void WireServerPerf::PrintServerResults() {
+    if (mDrawsHandled == 0) {
+        return;
+    }
+    PrintResult("server_time_per_draw", mServerTime * 1e9 / static_cast<double>(mDrawsHandled),
+                "ns", true);
+    PrintResult("bytes_per_draw", static_cast<double>(mDrawCommands.size()) / kNumDraws, "bytes",
+                true);
+}
+
+TEST_P(WireServerPerf, Run) {
+    RunTest();
+    PrintServerResults();
+}
+
+DAWN_INSTANTIATE_TEST_P(WireServerPerf,
+                        {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {Encoding::Regular, Encoding::Compact});
@@ -0,0 +1,220 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/SharedMemoryTransport.h"
+
+namespace {
+
+// The number of bytes of commands sent in each step.
+constexpr size_t kBytesPerStep = 16 * 1024 * 1024;
+constexpr size_t kSharedMemoryCapacity = 4 * 1024 * 1024;
+
+enum class Transport {
+    TerribleCommandBuffer,
+    SharedMemory,
+};
+
+enum class CommandSize {
+    CommandSize_64B = 64,
+    CommandSize_4KB = 4 * 1024,
+    CommandSize_256KB = 256 * 1024,
+};
+
+struct WireTransportParams : AdapterTestParam {
+    WireTransportParams(const AdapterTestParam& param, Transport transport, CommandSize commandSize)
+        : AdapterTestParam(param), transport(transport), commandSize(commandSize) {}
+
+    Transport transport;
+    CommandSize commandSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireTransportParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.transport) {
+        case Transport::TerribleCommandBuffer:
+            ostream << "_TerribleCommandBuffer";
+            break;
+        case Transport::SharedMemory:
+            ostream << "_SharedMemory";
+            break;
+    }
+
+    switch (param.commandSize) {
+        case CommandSize::CommandSize_64B:
+            ostream << "_CommandSize_64B";
+            break;
+        case CommandSize::CommandSize_4KB:
+            ostream << "_CommandSize_4KB";
+            break;
+        case CommandSize::CommandSize_256KB:
+            ostream << "_CommandSize_256KB";
+            break;
+    }
+
+    return ostream;
+}
+
+// Walks the commands, which start with their size like the commands of the wire, without copying
+// them.
+class CountingCommandHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        const volatile char* end = commands + size;
+        uint64_t commandCount = 0;
+        while (commands < end) {
+            uint64_t commandSize = *reinterpret_cast<const volatile uint64_t*>(commands);
+            if (commandSize < sizeof(uint64_t) || commandSize > size_t(end - commands)) {
+                return nullptr;
+            }
+            commands += commandSize;
+            commandCount++;
+        }
+        mCommandCount.fetch_add(commandCount, std::memory_order_release);
+        return commands;
+    }
+
+    std::atomic<uint64_t> mCommandCount{0};
+};
+
+}  // namespace
+
+// Test the throughput of the transports of the wire: the commands are serialized on the test
+// thread and handled in place, on the same thread for TerribleCommandBuffer and on another
+// thread for the shared memory ring. The GPU isn't used.
+class WireTransportPerf : public DawnPerfTestWithParams<WireTransportParams> {
+  public:
+    WireTransportPerf()
+        : DawnPerfTestWithParams(kBytesPerStep / static_cast<size_t>(GetParam().commandSize), 1),
+          mTimer(utils::CreateTimer()) {}
+    ~WireTransportPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    void PrintThroughput();
+
+  private:
+    void Step() override;
+
+    CountingCommandHandler mHandler;
+    std::unique_ptr<utils::TerribleCommandBuffer> mTerribleCommandBuffer;
+    std::unique_ptr<dawn::wire::SharedMemoryCommandSerializer> mSharedMemorySerializer;
+    std::unique_ptr<dawn::wire::SharedMemoryCommandReceiver> mSharedMemoryReceiver;
+    std::thread mReceiverThread;
+    dawn::wire::CommandSerializer* mSerializer = nullptr;
+
+    uint64_t mCommandsSent = 0;
+    double mElapsedTime = 0;
+    std::unique_ptr<utils::Timer> mTimer;
+};
+
+void WireTransportPerf::SetUp() {
+    DawnPerfTestWithParams<WireTransportParams>::SetUp();
+
+    switch (GetParam().transport) {
+        case Transport::TerribleCommandBuffer:
+            mTerribleCommandBuffer = std::make_unique<utils::TerribleCommandBuffer>(&mHandler);
+            mSerializer = mTerribleCommandBuffer.get();
+            break;
+
+        case Transport::SharedMemory: {
+            uint64_t timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+            std::string name = "/dawn-perf-" + std::to_string(timestamp % 1'000'000'000'000ull);
+            mSharedMemorySerializer = dawn::wire::SharedMemoryCommandSerializer::Create(
+                name.c_str(), kSharedMemoryCapacity);
+            DAWN_TEST_UNSUPPORTED_IF(mSharedMemorySerializer == nullptr);
+            mSharedMemoryReceiver = dawn::wire::SharedMemoryCommandReceiver::Open(name.c_str());
+            ASSERT_NE(mSharedMemoryReceiver, nullptr);
+            mSerializer = mSharedMemorySerializer.get();
+
+            mReceiverThread = std::thread([this] {
+                while (mSharedMemoryReceiver->WaitForCommands()) {
+                    if (!mSharedMemoryReceiver->HandleCommands(&mHandler)) {
+                        break;
+                    }
+                }
+            });
+            break;
+        }
+    }
+}
+
+void WireTransportPerf::TearDown() {
+    if (mReceiverThread.joinable()) {
+        mSharedMemorySerializer->Close();
+        mReceiverThread.join();
+    }
+    DawnPerfTestWithParams<WireTransportParams>::TearDown();
+}
+
+void WireTransportPerf::Step() {
+    const size_t commandSize = static_cast<size_t>(GetParam().commandSize);
+    const size_t commandCount = kBytesPerStep / commandSize;
+
+    mTimer->Start();
+    for (size_t i = 0; i < commandCount; ++i) {
+        char* command = static_cast<char*>(mSerializer->GetCmdSpace(commandSize));
+        if (command == nullptr) {
+            AbortTest();
+            return;
+        }
+        uint64_t size = commandSize;
+        memcpy(command, &size, sizeof(size));
+        memset(command + sizeof(size), 0, commandSize - sizeof(size));
+    }
+    mSerializer->Flush();
+    mCommandsSent += commandCount;
+
+    // Wait for all the commands to be handled so the step measures the whole transport.
+    while (mHandler.mCommandCount.load(std::memory_order_acquire) < mCommandsSent) {
+        std::this_thread::yield();
+    }
+    mTimer->Stop();
+    mElapsedTime += mTimer->GetElapsedTime();
+}
+
+void WireTransportPerf::PrintThroughput() {
+    if (mElapsedTime == 0) {
+        return;
+    }
+    double megabytesSent = static_cast<double>(mCommandsSent) *
+                           static_cast<double>(GetParam().commandSize) / (1024 * 1024);
+    PrintResult("throughput", megabytesSent / mElapsedTime, "MB/s", true);
+    PrintResult("command_rate", static_cast<double>(mCommandsSent) / mElapsedTime, "commands/s",
+                true);
+}
+
+TEST_P(WireTransportPerf, Run) {
+    RunTest();
+    PrintThroughput();
+}
+
+// The transports don't use the GPU, so the test only runs once, on the null backend.
+DAWN_INSTANTIATE_TEST_P(WireTransportPerf,
+                        {NullBackend()},
+                        {Transport::TerribleCommandBuffer, Transport::SharedMemory},
+                        {CommandSize::CommandSize_64B, CommandSize::CommandSize_4KB,
+                         CommandSize::CommandSize_256KB});
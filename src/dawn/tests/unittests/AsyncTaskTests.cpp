@@ -61,6 +61,35 @@ void DoTask(ConcurrentTaskResultQueue* resultQueue, uint32_t id) {
     resultQueue->AddResult(std::move(result));
 }
 
+// A worker task pool that only runs the posted tasks when asked to, so that tests can control
+// whether a task has started or not.
+class ManualWorkerTaskPool : public dawn::platform::WorkerTaskPool {
+  public:
+    class Event : public dawn::platform::WaitableEvent {
+      public:
+        void Wait() override {}
+        bool IsComplete() override { return true; }
+    };
+
+    std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata) override {
+        mTasks.emplace_back(callback, userdata);
+        return std::make_unique<Event>();
+    }
+
+    void RunAll() {
+        std::vector<std::pair<dawn::platform::PostWorkerTaskCallback, void*>> tasks;
+        tasks.swap(mTasks);
+        for (auto [callback, userdata] : tasks) {
+            callback(userdata);
+        }
+    }
+
+  private:
+    std::vector<std::pair<dawn::platform::PostWorkerTaskCallback, void*>> mTasks;
+};
+
 }  // anonymous namespace
 
 class AsyncTaskTest : public testing::Test {};
@@ -90,3 +119,76 @@ TEST_F(AsyncTaskTest, Basic) {
     }
     ASSERT_TRUE(idset.empty());
 }
+
+// Test that a task cancelled before it starts never runs and calls its cancellation task instead.
+TEST_F(AsyncTaskTest, CancelPendingTask) {
+    ManualWorkerTaskPool pool;
+    dawn::native::AsyncTaskManager taskManager(&pool);
+
+    bool ran = false;
+    bool cancelled = false;
+    Ref<dawn::native::AsyncTaskHandle> handle =
+        taskManager.PostTask([&ran] { ran = true; }, [&cancelled] { cancelled = true; });
+    EXPECT_TRUE(taskManager.HasPendingTasks());
+    EXPECT_FALSE(handle->IsDone());
+
+    EXPECT_TRUE(handle->Cancel());
+    EXPECT_TRUE(cancelled);
+    EXPECT_TRUE(handle->IsDone());
+    EXPECT_FALSE(taskManager.HasPendingTasks());
+
+    // The worker skips the cancelled task, and it can't be cancelled twice.
+    pool.RunAll();
+    EXPECT_FALSE(ran);
+    EXPECT_FALSE(handle->Cancel());
+}
+
+// Test that RunNow() runs a pending task on the calling thread and that the worker skips it.
+TEST_F(AsyncTaskTest, RunNowStealsPendingTask) {
+    ManualWorkerTaskPool pool;
+    dawn::native::AsyncTaskManager taskManager(&pool);
+
+    uint32_t runCount = 0;
+    bool cancelled = false;
+    Ref<dawn::native::AsyncTaskHandle> handle =
+        taskManager.PostTask([&runCount] { runCount++; }, [&cancelled] { cancelled = true; });
+
+    handle->RunNow();
+    EXPECT_EQ(runCount, 1u);
+    EXPECT_TRUE(handle->IsDone());
+    EXPECT_FALSE(taskManager.HasPendingTasks());
+
+    // A completed task can't be cancelled and isn't run again.
+    EXPECT_FALSE(handle->Cancel());
+    EXPECT_FALSE(cancelled);
+    pool.RunAll();
+    EXPECT_EQ(runCount, 1u);
+}
+
+// Test that WaitAllPendingTasks() runs the tasks that haven't started on the calling thread and
+// that CancelAllPendingTasks() cancels them.
+TEST_F(AsyncTaskTest, WaitOrCancelAllPendingTasks) {
+    ManualWorkerTaskPool pool;
+    dawn::native::AsyncTaskManager taskManager(&pool);
+
+    uint32_t runCount = 0;
+    uint32_t cancelCount = 0;
+    constexpr uint32_t kTaskCount = 4u;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        taskManager.PostTask([&runCount] { runCount++; }, [&cancelCount] { cancelCount++; });
+    }
+    taskManager.WaitAllPendingTasks();
+    EXPECT_EQ(runCount, kTaskCount);
+    EXPECT_EQ(cancelCount, 0u);
+
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        taskManager.PostTask([&runCount] { runCount++; }, [&cancelCount] { cancelCount++; });
+    }
+    taskManager.CancelAllPendingTasks();
+    EXPECT_EQ(runCount, kTaskCount);
+    EXPECT_EQ(cancelCount, kTaskCount);
+    EXPECT_FALSE(taskManager.HasPendingTasks());
+
+    pool.RunAll();
+    EXPECT_EQ(runCount, kTaskCount);
+}
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "dawn/native/CommandAllocator.h"
+#include "dawn/native/CommandBlockPool.h"
 #include "gtest/gtest.h"
 
 namespace dawn::native {
@@ -500,4 +501,121 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that the blocks of an allocator using a CommandBlockPool are given back to the pool and
+// reused by the next allocators.
+TEST(CommandAllocator, BlockPoolReusesBlocks) {
+    CommandBlockPool pool;
+    constexpr size_t kNumCommands = 2000;
+
+    for (size_t iteration = 0; iteration < 3; ++iteration) {
+        CommandAllocator allocator(&pool);
+        for (size_t i = 0; i < kNumCommands; ++i) {
+            CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+            draw->first = i;
+            draw->count = iteration;
+        }
+        EXPECT_GT(pool.GetStats().inUseBytes, 0u);
+
+        CommandIterator iterator(std::move(allocator));
+        for (size_t i = 0; i < kNumCommands; ++i) {
+            CommandType type;
+            ASSERT_TRUE(iterator.NextCommandId(&type));
+            ASSERT_EQ(type, CommandType::Draw);
+            CommandDraw* draw = iterator.NextCommand<CommandDraw>();
+            ASSERT_EQ(draw->first, i);
+            ASSERT_EQ(draw->count, iteration);
+        }
+        iterator.MakeEmptyAsDataWasDestroyed();
+        EXPECT_EQ(pool.GetStats().inUseBytes, 0u);
+    }
+
+    // Only the first iteration had to allocate blocks.
+    CommandBlockPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.reusedBlockCount, 2 * stats.allocatedBlockCount);
+    EXPECT_EQ(stats.cachedBytes, stats.inUseHighWaterMarkBytes);
+}
+
+// Test that allocators moved from keep their pool and that Reset() gives the blocks back to it.
+TEST(CommandAllocator, BlockPoolMoveAndReset) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+    CommandAllocator other = std::move(allocator);
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+    EXPECT_EQ(pool.GetStats().allocatedBlockCount, 2u);
+
+    allocator.Reset();
+    other.Reset();
+    CommandBlockPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.inUseBytes, 0u);
+    EXPECT_EQ(stats.cachedBytes, 2 * CommandBlockPool::kMinBlockSize);
+}
+
+// Test that commands bigger than the largest size class get blocks that aren't pooled.
+TEST(CommandAllocator, BlockPoolLargeCommands) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandBig>(CommandType::Big);
+    EXPECT_GT(pool.GetStats().inUseBytes, CommandBlockPool::kMaxPooledBlockSize);
+
+    CommandIterator iterator(std::move(allocator));
+    iterator.MakeEmptyAsDataWasDestroyed();
+    CommandBlockPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.inUseBytes, 0u);
+    EXPECT_EQ(stats.cachedBytes, 0u);
+}
+
+// Test that Trim() keeps the blocks needed to reach the recent peak usage and progressively frees
+// the others.
+TEST(CommandBlockPool, Trim) {
+    CommandBlockPool pool;
+    constexpr size_t kBlockCount = 8;
+
+    std::vector<uint8_t*> blocks;
+    for (size_t i = 0; i < kBlockCount; ++i) {
+        size_t size;
+        blocks.push_back(pool.Acquire(CommandBlockPool::kMinBlockSize, &size));
+        ASSERT_EQ(size, CommandBlockPool::kMinBlockSize);
+    }
+    for (uint8_t* block : blocks) {
+        pool.Release(block, CommandBlockPool::kMinBlockSize);
+    }
+
+    // All the blocks were in use since the last trim so they are all kept.
+    pool.Trim();
+    EXPECT_EQ(pool.GetStats().cachedBytes, kBlockCount * CommandBlockPool::kMinBlockSize);
+
+    // No block was used since, so half of them are freed at each trim.
+    pool.Trim();
+    EXPECT_EQ(pool.GetStats().cachedBytes, kBlockCount / 2 * CommandBlockPool::kMinBlockSize);
+    pool.Trim();
+    EXPECT_EQ(pool.GetStats().cachedBytes, kBlockCount / 4 * CommandBlockPool::kMinBlockSize);
+    for (size_t i = 0; i < 3; ++i) {
+        pool.Trim();
+    }
+    EXPECT_EQ(pool.GetStats().cachedBytes, 0u);
+    EXPECT_EQ(pool.GetStats().cachedHighWaterMarkBytes,
+              kBlockCount * CommandBlockPool::kMinBlockSize);
+}
+
+// Test that sizes are rounded up to the size classes.
+TEST(CommandBlockPool, SizeClasses) {
+    CommandBlockPool pool;
+
+    size_t size;
+    uint8_t* block = pool.Acquire(CommandBlockPool::kMinBlockSize + 1, &size);
+    EXPECT_EQ(size, 2 * CommandBlockPool::kMinBlockSize);
+    pool.Release(block, size);
+
+    block = pool.Acquire(1, &size);
+    EXPECT_EQ(size, CommandBlockPool::kMinBlockSize);
+    pool.Release(block, size);
+
+    block = pool.Acquire(CommandBlockPool::kMaxPooledBlockSize, &size);
+    EXPECT_EQ(size, CommandBlockPool::kMaxPooledBlockSize);
+    pool.Release(block, size);
+}
+
 }  // namespace dawn::native
@@ -0,0 +1,169 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/ContentLessObjectCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn {
+namespace {
+
+class CacheableT : public RefCounted {
+  public:
+    CacheableT(size_t value, ContentLessObjectCache<CacheableT>* cache)
+        : mValue(value), mCache(cache) {}
+
+    size_t GetValue() const { return mValue; }
+
+    struct EqualityFunc {
+        bool operator()(const CacheableT* a, const CacheableT* b) const {
+            return a->mValue == b->mValue;
+        }
+    };
+
+    struct HashFunc {
+        size_t operator()(const CacheableT* obj) const { return obj->mValue; }
+    };
+
+  protected:
+    // Uncache on destruction like the cached objects of the device do.
+    void DeleteThis() override {
+        if (mCache != nullptr) {
+            mCache->Erase(this);
+        }
+        RefCounted::DeleteThis();
+    }
+
+  private:
+    size_t mValue;
+    ContentLessObjectCache<CacheableT>* mCache;
+};
+
+// Test that finding an object that isn't in the cache returns nullptr.
+TEST(ContentLessObjectCacheTest, FindMissing) {
+    ContentLessObjectCache<CacheableT> cache;
+    CacheableT blueprint(1, nullptr);
+    EXPECT_EQ(cache.Find(&blueprint), nullptr);
+    EXPECT_TRUE(cache.Empty());
+}
+
+// Test that inserted objects can be found by content and that objects remove themselves when
+// destroyed.
+TEST(ContentLessObjectCacheTest, InsertFindErase) {
+    ContentLessObjectCache<CacheableT> cache;
+    {
+        Ref<CacheableT> object = AcquireRef(new CacheableT(1, &cache));
+        auto [cached, inserted] = cache.Insert(object.Get());
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(cached.Get(), object.Get());
+
+        CacheableT blueprint(1, nullptr);
+        EXPECT_EQ(cache.Find(&blueprint).Get(), object.Get());
+
+        CacheableT otherBlueprint(2, nullptr);
+        EXPECT_EQ(cache.Find(&otherBlueprint), nullptr);
+        EXPECT_FALSE(cache.Empty());
+    }
+    EXPECT_TRUE(cache.Empty());
+}
+
+// Test that inserting an object equal to a live cached one returns the cached one.
+TEST(ContentLessObjectCacheTest, InsertDuplicate) {
+    ContentLessObjectCache<CacheableT> cache;
+    Ref<CacheableT> object = AcquireRef(new CacheableT(1, &cache));
+    EXPECT_TRUE(cache.Insert(object.Get()).second);
+
+    Ref<CacheableT> duplicate = AcquireRef(new CacheableT(1, &cache));
+    auto [cached, inserted] = cache.Insert(duplicate.Get());
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(cached.Get(), object.Get());
+
+    // Destroying the duplicate must not remove the cached object.
+    duplicate = nullptr;
+    CacheableT blueprint(1, nullptr);
+    EXPECT_EQ(cache.Find(&blueprint).Get(), object.Get());
+}
+
+// Test that an object whose refcount reached zero is never returned, and is replaced on insertion.
+TEST(ContentLessObjectCacheTest, DyingObjectIsNotResurrected) {
+    class DelayedUncache : public CacheableT {
+      public:
+        using CacheableT::CacheableT;
+
+        std::function<void()> onDelete;
+
+      protected:
+        void DeleteThis() override {
+            onDelete();
+            CacheableT::DeleteThis();
+        }
+    };
+
+    ContentLessObjectCache<CacheableT> cache;
+    CacheableT blueprint(1, nullptr);
+
+    DelayedUncache* dying = new DelayedUncache(1, &cache);
+    EXPECT_TRUE(cache.Insert(dying).second);
+
+    Ref<CacheableT> replacement = AcquireRef(new CacheableT(1, &cache));
+    dying->onDelete = [&] {
+        // The object is still in the cache but must not be found anymore.
+        EXPECT_EQ(cache.Find(&blueprint), nullptr);
+
+        // Inserting an equal object replaces the dying one.
+        auto [cached, inserted] = cache.Insert(replacement.Get());
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(cached.Get(), replacement.Get());
+    };
+    dying->Release();
+
+    // The Erase() of the dying object didn't remove the replacement.
+    EXPECT_EQ(cache.Find(&blueprint).Get(), replacement.Get());
+}
+
+// Test that many threads creating and dropping equal objects concurrently always agree on a single
+// live object per value, and that the cache ends up empty.
+TEST(ContentLessObjectCacheTest, ConcurrentGetOrCreate) {
+    ContentLessObjectCache<CacheableT> cache;
+    constexpr size_t kThreadCount = 8;
+    constexpr size_t kIterations = 10000;
+    constexpr size_t kValueCount = 37;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; t++) {
+        threads.emplace_back([&cache] {
+            for (size_t i = 0; i < kIterations; i++) {
+                CacheableT blueprint(i % kValueCount, nullptr);
+                Ref<CacheableT> object = cache.Find(&blueprint);
+                if (object == nullptr) {
+                    Ref<CacheableT> created = AcquireRef(new CacheableT(i % kValueCount, &cache));
+                    object = cache.Insert(created.Get()).first;
+                }
+                EXPECT_EQ(object->GetValue(), i % kValueCount);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(cache.Empty());
+}
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -97,6 +97,41 @@ TEST(RefCounted, RaceOnReferenceRelease) {
     EXPECT_TRUE(deleted);
 }
 
+// Test that TryReference adds a reference on live objects.
+TEST(RefCounted, TryReferenceOnLiveObject) {
+    bool deleted = false;
+    auto* test = new RCTest(&deleted);
+
+    EXPECT_TRUE(test->TryReference());
+    EXPECT_EQ(test->GetRefCountForTesting(), 2u);
+
+    test->Release();
+    test->Release();
+    EXPECT_TRUE(deleted);
+}
+
+// Test that TryReference fails once the refcount reached zero and the object is being destroyed.
+TEST(RefCounted, TryReferenceFailsDuringDestruction) {
+    class CheckedDelete : public RefCounted {
+      public:
+        explicit CheckedDelete(bool* result) : mResult(result) {}
+
+      protected:
+        void DeleteThis() override {
+            *mResult = TryReference();
+            RefCounted::DeleteThis();
+        }
+
+      private:
+        bool* mResult;
+    };
+
+    bool tryReferenceResult = true;
+    auto* test = new CheckedDelete(&tryReferenceResult);
+    test->Release();
+    EXPECT_FALSE(tryReferenceResult);
+}
+
 // Test Ref remove reference when going out of scope
 TEST(Ref, EndOfScopeRemovesRef) {
     bool deleted = false;
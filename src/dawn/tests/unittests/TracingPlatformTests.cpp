@@ -0,0 +1,129 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <thread>
+
+#include "dawn/platform/TracingPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "gtest/gtest.h"
+
+namespace dawn::platform {
+namespace {
+
+size_t CountOccurrences(const std::string& str, const std::string& substr) {
+    size_t count = 0;
+    for (size_t pos = str.find(substr); pos != std::string::npos;
+         pos = str.find(substr, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+void TraceScope(Platform* platform) {
+    TRACE_EVENT0(platform, General, "TracingPlatformTest::Scope");
+}
+
+void TraceInstant(Platform* platform, uint32_t value) {
+    TRACE_EVENT_INSTANT1(platform, Validation, "TracingPlatformTest::Instant", "value", value);
+}
+
+// Test that events are only recorded while recording is enabled.
+TEST(TracingPlatformTest, RecordsOnlyWhenEnabled) {
+    TracingPlatform platform;
+    EXPECT_FALSE(platform.IsRecording());
+    TraceScope(&platform);
+    EXPECT_EQ(platform.ExportTraceJSON().find("TracingPlatformTest::Scope"), std::string::npos);
+
+    platform.EnableRecording(true);
+    EXPECT_TRUE(platform.IsRecording());
+    TraceScope(&platform);
+    platform.EnableRecording(false);
+    TraceScope(&platform);
+
+    std::string json = platform.ExportTraceJSON();
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"TracingPlatformTest::Scope\""), 2u);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), 1u);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), 1u);
+    EXPECT_NE(json.find("\"cat\":\"general\""), std::string::npos);
+
+    platform.ClearEvents();
+    EXPECT_EQ(platform.ExportTraceJSON().find("TracingPlatformTest::Scope"), std::string::npos);
+}
+
+// Test that the arguments of the events are exported.
+TEST(TracingPlatformTest, ExportsArguments) {
+    TracingPlatform platform;
+    platform.EnableRecording(true);
+    TraceInstant(&platform, 42);
+    {
+        // String arguments are copied since they may not outlive the call.
+        std::string label = "my \"label\"";
+        TRACE_EVENT_INSTANT1(&platform, General, "TracingPlatformTest::String", "label", label);
+        label = "overwritten";
+    }
+
+    std::string json = platform.ExportTraceJSON();
+    EXPECT_NE(json.find("\"cat\":\"validation\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"value\":42}"), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"label\":\"my \\\"label\\\"\"}"), std::string::npos);
+}
+
+// Test that the oldest events of a thread are overwritten when its buffer is full.
+TEST(TracingPlatformTest, RingBufferWrapsAround) {
+    TracingPlatform platform(4);
+    platform.EnableRecording(true);
+    for (uint32_t i = 0; i < 10; ++i) {
+        TraceInstant(&platform, i);
+    }
+
+    std::string json = platform.ExportTraceJSON();
+    EXPECT_EQ(CountOccurrences(json, "TracingPlatformTest::Instant"), 4u);
+    for (uint32_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(json.find("\"value\":" + std::to_string(i) + "}"), std::string::npos);
+    }
+    for (uint32_t i = 6; i < 10; ++i) {
+        EXPECT_NE(json.find("\"value\":" + std::to_string(i) + "}"), std::string::npos);
+    }
+}
+
+// Test that each thread records its events in its own buffer, and that they are exported while
+// other threads record events.
+TEST(TracingPlatformTest, MultipleThreads) {
+    TracingPlatform platform(64);
+    platform.EnableRecording(true);
+
+    std::thread threads[4];
+    for (std::thread& thread : threads) {
+        thread = std::thread([&] {
+            for (uint32_t i = 0; i < 1000; ++i) {
+                TraceInstant(&platform, i);
+            }
+        });
+    }
+    for (uint32_t i = 0; i < 10; ++i) {
+        std::string json = platform.ExportTraceJSON();
+        EXPECT_EQ(json.back(), '\n');
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::string json = platform.ExportTraceJSON();
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"thread_name\""), 4u);
+    EXPECT_EQ(CountOccurrences(json, "TracingPlatformTest::Instant"), 4u * 64u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::platform
@@ -0,0 +1,127 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dawn/platform/WorkerThread.h"
+#include "gtest/gtest.h"
+
+namespace dawn::platform {
+namespace {
+
+void IncrementCounter(void* userdata) {
+    static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1);
+}
+
+// Test that all the posted tasks run and their events are completed.
+TEST(WorkerThreadPoolTest, RunsAllTasks) {
+    WorkerThreadPoolOptions options;
+    options.maxThreadCount = 4;
+    AsyncWorkerThreadPool pool(options);
+
+    constexpr uint32_t kTaskCount = 1000;
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool.PostWorkerTask(IncrementCounter, &counter));
+    }
+    for (std::unique_ptr<WaitableEvent>& event : events) {
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+    }
+    EXPECT_EQ(counter.load(), kTaskCount);
+
+    WorkerThreadPoolStats stats = pool.GetStats();
+    EXPECT_LE(stats.threadCount, options.maxThreadCount);
+    EXPECT_GE(stats.threadCount, 1u);
+    EXPECT_EQ(stats.postedTaskCount, kTaskCount);
+    EXPECT_EQ(stats.completedTaskCount, kTaskCount);
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_GE(stats.maxQueueDepth, 1u);
+}
+
+// Test that the number of threads never exceeds the maximum.
+TEST(WorkerThreadPoolTest, SingleThread) {
+    WorkerThreadPoolOptions options;
+    options.maxThreadCount = 1;
+    AsyncWorkerThreadPool pool(options);
+
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<WaitableEvent>> events;
+    for (uint32_t i = 0; i < 100; ++i) {
+        events.push_back(pool.PostWorkerTask(IncrementCounter, &counter));
+    }
+    for (std::unique_ptr<WaitableEvent>& event : events) {
+        event->Wait();
+    }
+    EXPECT_EQ(counter.load(), 100u);
+    EXPECT_EQ(pool.GetStats().threadCount, 1u);
+    EXPECT_EQ(pool.GetStats().stolenTaskCount, 0u);
+}
+
+// Test that tasks posted from a worker thread run.
+TEST(WorkerThreadPoolTest, PostFromWorker) {
+    struct Context {
+        AsyncWorkerThreadPool* pool;
+        std::atomic<uint32_t> counter{0};
+        std::unique_ptr<WaitableEvent> innerEvent;
+    };
+
+    AsyncWorkerThreadPool pool;
+    Context context;
+    context.pool = &pool;
+
+    std::unique_ptr<WaitableEvent> outerEvent = pool.PostWorkerTask(
+        [](void* userdata) {
+            Context* context = static_cast<Context*>(userdata);
+            context->innerEvent = context->pool->PostWorkerTask(IncrementCounter, &context->counter);
+        },
+        &context);
+    outerEvent->Wait();
+    context.innerEvent->Wait();
+    EXPECT_EQ(context.counter.load(), 1u);
+}
+
+// Test that destroying the pool runs the queued tasks and that events can outlive the pool.
+TEST(WorkerThreadPoolTest, EventsOutlivePool) {
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<WaitableEvent>> events;
+    {
+        AsyncWorkerThreadPool pool;
+        for (uint32_t i = 0; i < 100; ++i) {
+            events.push_back(pool.PostWorkerTask(IncrementCounter, &counter));
+        }
+    }
+    EXPECT_EQ(counter.load(), 100u);
+    for (std::unique_ptr<WaitableEvent>& event : events) {
+        EXPECT_TRUE(event->IsComplete());
+    }
+}
+
+// Test that lowering the priority of the workers doesn't prevent tasks from running.
+TEST(WorkerThreadPoolTest, BackgroundPriority) {
+    WorkerThreadPoolOptions options;
+    options.priority = WorkerThreadPriority::Background;
+    AsyncWorkerThreadPool pool(options);
+
+    std::atomic<uint32_t> counter(0);
+    pool.PostWorkerTask(IncrementCounter, &counter)->Wait();
+    EXPECT_EQ(counter.load(), 1u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::platform
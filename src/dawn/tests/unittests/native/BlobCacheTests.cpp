@@ -0,0 +1,120 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <future>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/BlobCache.h"
+#include "dawn/native/CacheKey.h"
+#include "dawn/tests/mocks/platform/CachingInterfaceMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class BlobCacheTests : public testing::Test {
+  protected:
+    CacheKey MakeKey(std::string_view name) {
+        CacheKey key;
+        StreamIn(&key, kDawnVersion, name);
+        return key;
+    }
+
+    std::string LoadString(BlobCache* cache, const CacheKey& key) {
+        Blob blob = cache->Load(key);
+        return std::string(reinterpret_cast<const char*>(blob.Data()), blob.Size());
+    }
+
+    NiceMock<CachingInterfaceMock> mMockCache;
+};
+
+// Test that asynchronous stores are written to the caching interface.
+TEST_F(BlobCacheTests, AsyncStores) {
+    BlobCache cache(&mMockCache, nullptr, /* asyncStores */ true);
+
+    CacheKey key = MakeKey("key");
+    cache.Store(key, 5, "value");
+    cache.Flush();
+
+    EXPECT_EQ(mMockCache.GetNumEntries(), 1u);
+    EXPECT_EQ(cache.GetQueuedStoreCount(), 0u);
+    EXPECT_EQ(cache.GetBytesWritten(), 5u);
+    EXPECT_EQ(LoadString(&cache, key), "value");
+}
+
+// Test that the queued stores are returned by Load, and that only the latest value of a key is
+// written.
+TEST_F(BlobCacheTests, AsyncStoresQueue) {
+    BlobCache cache(&mMockCache, nullptr, /* asyncStores */ true);
+
+    std::promise<void> writerBlocked;
+    std::promise<void> unblockWriter;
+    std::shared_future<void> writerUnblocked = unblockWriter.get_future().share();
+
+    // Block the writer thread in the first store.
+    std::vector<std::string> storedValues;
+    EXPECT_CALL(mMockCache, StoreData)
+        .WillRepeatedly(Invoke([&](const void*, size_t, const void* value, size_t valueSize) {
+            if (storedValues.empty()) {
+                writerBlocked.set_value();
+                writerUnblocked.wait();
+            }
+            storedValues.emplace_back(static_cast<const char*>(value), valueSize);
+        }));
+    EXPECT_CALL(mMockCache, LoadData).Times(0);
+
+    CacheKey key0 = MakeKey("key0");
+    CacheKey key1 = MakeKey("key1");
+
+    cache.Store(key0, 4, "val0");
+    writerBlocked.get_future().wait();
+
+    // key0 is being written while key1 is queued twice.
+    cache.Store(key1, 4, "old1");
+    cache.Store(key1, 4, "new1");
+    EXPECT_EQ(cache.GetQueuedStoreCount(), 2u);
+    EXPECT_EQ(LoadString(&cache, key0), "val0");
+    EXPECT_EQ(LoadString(&cache, key1), "new1");
+
+    unblockWriter.set_value();
+    cache.Flush();
+
+    EXPECT_THAT(storedValues, ElementsAre("val0", "new1"));
+    EXPECT_EQ(cache.GetQueuedStoreCount(), 0u);
+    EXPECT_EQ(cache.GetBytesWritten(), 8u);
+}
+
+// Test that the queued stores are written when the cache is destroyed.
+TEST_F(BlobCacheTests, AsyncStoresWrittenOnDestruction) {
+    {
+        BlobCache cache(&mMockCache, nullptr, /* asyncStores */ true);
+        cache.Store(MakeKey("key0"), 4, "val0");
+        cache.Store(MakeKey("key1"), 4, "val1");
+    }
+    EXPECT_EQ(mMockCache.GetNumEntries(), 2u);
+}
+
+}  // anonymous namespace
+
+}  // namespace dawn::native
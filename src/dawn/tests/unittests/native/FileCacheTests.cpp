@@ -0,0 +1,170 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawn/native/FileCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+
+namespace {
+
+class FileCacheTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        const testing::TestInfo* testInfo = testing::UnitTest::GetInstance()->current_test_info();
+        mDirectory = testing::TempDir() + "dawn_file_cache_" + testInfo->name();
+    }
+
+    void TearDown() override {
+        std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+        for (const std::string& key : mStoredKeys) {
+            std::remove(cache->GetEntryPath(key.data(), key.size()).c_str());
+        }
+    }
+
+    void Store(FileCache* cache, const std::string& key, const std::string& value) {
+        mStoredKeys.push_back(key);
+        cache->StoreData(key.data(), key.size(), value.data(), value.size());
+    }
+
+    // Loads the value of |key| the same way BlobCache does. Returns an empty string on misses.
+    std::string Load(FileCache* cache, const std::string& key) {
+        size_t size = cache->LoadData(key.data(), key.size(), nullptr, 0);
+        if (size == 0) {
+            return "";
+        }
+        std::string value(size, '\0');
+        EXPECT_EQ(cache->LoadData(key.data(), key.size(), value.data(), size), size);
+        return value;
+    }
+
+    std::string mDirectory;
+    std::vector<std::string> mStoredKeys;
+};
+
+// Test that stored values can be loaded back, and that unknown keys aren't found.
+TEST_F(FileCacheTests, StoreAndLoad) {
+    std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+    ASSERT_NE(cache, nullptr);
+
+    EXPECT_EQ(Load(cache.get(), "key0"), "");
+
+    Store(cache.get(), "key0", "value0");
+    Store(cache.get(), "key1", "a longer value1");
+    EXPECT_EQ(Load(cache.get(), "key0"), "value0");
+    EXPECT_EQ(Load(cache.get(), "key1"), "a longer value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "");
+
+    // Storing a key again replaces its value.
+    Store(cache.get(), "key0", "new value0");
+    EXPECT_EQ(Load(cache.get(), "key0"), "new value0");
+}
+
+// Test that the entries persist after the cache is destroyed.
+TEST_F(FileCacheTests, Persistence) {
+    {
+        std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+        ASSERT_NE(cache, nullptr);
+        Store(cache.get(), "key", "value");
+    }
+
+    std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(Load(cache.get(), "key"), "value");
+}
+
+// Test that corrupted and truncated entries are ignored and replaced by the next store.
+TEST_F(FileCacheTests, CorruptedEntries) {
+    std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+    ASSERT_NE(cache, nullptr);
+
+    const std::string key = "key";
+    const std::string path = cache->GetEntryPath(key.data(), key.size());
+
+    // Flip the last byte of the value.
+    Store(cache.get(), key, "value");
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('E');
+    }
+    EXPECT_EQ(Load(cache.get(), key), "");
+    // The entry isn't deleted by the load, in case another process replaced it in the meantime.
+    EXPECT_TRUE(std::ifstream(path).good());
+
+    // Truncate the entry.
+    Store(cache.get(), key, "value");
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write("DAWC", 4);
+    }
+    EXPECT_EQ(Load(cache.get(), key), "");
+
+    // The entry can be stored again.
+    Store(cache.get(), key, "value");
+    EXPECT_EQ(Load(cache.get(), key), "value");
+}
+
+// Test that replacing an entry doesn't count its previous size in the total size of the cache.
+TEST_F(FileCacheTests, ReplacedEntrySize) {
+    std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory);
+    ASSERT_NE(cache, nullptr);
+
+    const std::string value(1000, 'v');
+    Store(cache.get(), "key", value);
+    uint64_t totalSize = cache->GetTotalSizeForTesting();
+    for (uint32_t i = 0; i < 4; ++i) {
+        Store(cache.get(), "key", value);
+        EXPECT_EQ(cache->GetTotalSizeForTesting(), totalSize);
+    }
+}
+
+// Test that entries are evicted to keep the cache below its maximum size.
+TEST_F(FileCacheTests, Eviction) {
+    constexpr uint64_t kMaxSize = 4096;
+    std::unique_ptr<FileCache> cache = FileCache::Create(mDirectory, kMaxSize);
+    ASSERT_NE(cache, nullptr);
+
+    const std::string value(1000, 'v');
+    for (uint32_t i = 0; i < 16; ++i) {
+        Store(cache.get(), "key" + std::to_string(i), value);
+        EXPECT_LE(cache->GetTotalSizeForTesting(), kMaxSize);
+    }
+
+    // Entries are either evicted or intact.
+    uint32_t loadedCount = 0;
+    for (uint32_t i = 0; i < 16; ++i) {
+        std::string loaded = Load(cache.get(), "key" + std::to_string(i));
+        if (!loaded.empty()) {
+            EXPECT_EQ(loaded, value);
+            loadedCount++;
+        }
+    }
+    EXPECT_GT(loadedCount, 0u);
+    EXPECT_LT(loadedCount, 16u);
+
+    // Entries larger than the cache aren't stored.
+    Store(cache.get(), "large", std::string(kMaxSize, 'v'));
+    EXPECT_EQ(Load(cache.get(), "large"), "");
+}
+
+}  // anonymous namespace
+
+}  // namespace dawn::native
@@ -0,0 +1,147 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/native/TintProgramCache.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "gtest/gtest.h"
+#include "tint/tint.h"
+
+namespace dawn::native {
+namespace {
+
+constexpr char kShaderA[] = R"(
+    @compute @workgroup_size(1) fn main() {
+    })";
+
+constexpr char kShaderB[] = R"(
+    @group(0) @binding(0) var<storage, read_write> data : array<u32>;
+    @compute @workgroup_size(1) fn main() {
+        data[0] = 1u;
+    })";
+
+// Test that programs parsed from the same source are shared.
+TEST(TintProgramCacheTests, SameSourceIsShared) {
+    TintProgramCache cache;
+    Ref<TintProgram> a = cache.GetOrCreate(kShaderA);
+    Ref<TintProgram> b = cache.GetOrCreate(std::string(kShaderA));
+    Ref<TintProgram> c = cache.GetOrCreate(kShaderB);
+    ASSERT_TRUE(a->IsValid());
+    ASSERT_TRUE(c->IsValid());
+    EXPECT_EQ(a.Get(), b.Get());
+    EXPECT_NE(a.Get(), c.Get());
+
+    TintProgramCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_EQ(stats.missCount, 2u);
+    EXPECT_EQ(stats.programCount, 2u);
+    EXPECT_EQ(stats.estimatedSize, a->GetEstimatedSize() + c->GetEstimatedSize());
+}
+
+// Test that invalid programs are returned with their errors but not cached.
+TEST(TintProgramCacheTests, InvalidProgramsAreNotCached) {
+    TintProgramCache cache;
+    Ref<TintProgram> a = cache.GetOrCreate("fn main( {}");
+    EXPECT_FALSE(a->IsValid());
+    EXPECT_TRUE(a->GetDiagnostics().contains_errors());
+    Ref<TintProgram> b = cache.GetOrCreate("fn main( {}");
+    EXPECT_NE(a.Get(), b.Get());
+
+    TintProgramCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 0u);
+    EXPECT_EQ(stats.missCount, 2u);
+    EXPECT_EQ(stats.programCount, 0u);
+}
+
+// Test that the least recently used programs are evicted when the cache is full, and that they
+// stay alive while they are used.
+TEST(TintProgramCacheTests, EvictsLeastRecentlyUsed) {
+    size_t sizeA = TintProgram::CreateFromWGSL(kShaderA)->GetEstimatedSize();
+    size_t sizeB = TintProgram::CreateFromWGSL(kShaderB)->GetEstimatedSize();
+    TintProgramCache cache(sizeA + sizeB);
+
+    Ref<TintProgram> a = cache.GetOrCreate(kShaderA);
+    cache.GetOrCreate(kShaderB);
+    // Use A so that B is the least recently used program.
+    cache.GetOrCreate(kShaderA);
+    cache.SetMaxSize(sizeA + sizeB - 1);
+
+    TintProgramCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.evictionCount, 1u);
+    EXPECT_EQ(stats.programCount, 1u);
+    EXPECT_EQ(stats.estimatedSize, sizeA);
+    EXPECT_EQ(a.Get(), cache.GetOrCreate(kShaderA).Get());
+
+    // Evict A while it is still referenced.
+    cache.GetOrCreate(kShaderB);
+    EXPECT_EQ(cache.GetStats().evictionCount, 2u);
+    EXPECT_TRUE(a->IsValid());
+    EXPECT_EQ(a->GetSource(), kShaderA);
+    EXPECT_NE(a.Get(), cache.GetOrCreate(kShaderA).Get());
+}
+
+// Test that a maximum size of 0 disables the cache.
+TEST(TintProgramCacheTests, Disabled) {
+    TintProgramCache cache(0);
+    EXPECT_NE(cache.GetOrCreate(kShaderA).Get(), cache.GetOrCreate(kShaderA).Get());
+
+    TintProgramCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 0u);
+    EXPECT_EQ(stats.missCount, 0u);
+    EXPECT_EQ(stats.programCount, 0u);
+}
+
+// Test that the devices of an instance share the programs of their shader modules.
+TEST(TintProgramCacheTests, SharedBetweenDevices) {
+    dawnProcSetProcs(&GetProcs());
+    {
+        auto instance = std::make_unique<Instance>();
+        instance->DiscoverDefaultAdapters();
+        wgpu::Adapter adapter;
+        for (Adapter& nativeAdapter : instance->GetAdapters()) {
+            wgpu::AdapterProperties properties;
+            nativeAdapter.GetProperties(&properties);
+            if (properties.backendType == wgpu::BackendType::Null) {
+                adapter = wgpu::Adapter(nativeAdapter.Get());
+                break;
+            }
+        }
+        ASSERT_NE(adapter, nullptr);
+
+        for (uint32_t i = 0; i < 3; ++i) {
+            wgpu::Device device = adapter.CreateDevice();
+            ASSERT_NE(device, nullptr);
+            wgpu::ShaderModule module = utils::CreateShaderModule(device, kShaderB);
+            EXPECT_NE(module, nullptr);
+        }
+
+        TintProgramCacheStats stats = instance->GetTintProgramCacheStats();
+        EXPECT_EQ(stats.hitCount, 2u);
+        EXPECT_EQ(stats.missCount, 1u);
+        EXPECT_EQ(stats.programCount, 1u);
+
+        instance->SetTintProgramCacheMaxSize(0);
+        stats = instance->GetTintProgramCacheStats();
+        EXPECT_EQ(stats.programCount, 0u);
+        EXPECT_EQ(stats.estimatedSize, 0u);
+    }
+    dawnProcSetProcs(nullptr);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -365,6 +365,46 @@ TEST_F(DrawVertexAndIndexBufferOOBValidationTests, DrawBasic) {
     }
 }
 
+// Verify that changing the vertex buffer between draws of the same render pass revalidates the
+// vertex buffer range.
+TEST_F(DrawVertexAndIndexBufferOOBValidationTests, DrawAfterVertexBufferChange) {
+    wgpu::RenderPipeline pipeline = CreateBasicRenderPipeline();
+
+    wgpu::Buffer vertexBuffer3 = CreateBuffer(3 * kFloat32x4Stride);
+    wgpu::Buffer vertexBuffer2 = CreateBuffer(2 * kFloat32x4Stride);
+
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder =
+            encoder.BeginRenderPass(GetBasicRenderPassDescriptor());
+        renderPassEncoder.SetPipeline(pipeline);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+
+        // Expect success
+        encoder.Finish();
+    }
+
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder =
+            encoder.BeginRenderPass(GetBasicRenderPassDescriptor());
+        renderPassEncoder.SetPipeline(pipeline);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        // The new vertex buffer is too small for 3 vertices
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer2);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+
+        // Expect failure
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
 // Verify vertex buffer OOB for non-instanced Draw are caught in command encoder
 TEST_F(DrawVertexAndIndexBufferOOBValidationTests, DrawVertexBufferOutOfBoundWithoutInstance) {
     for (VertexBufferParams params : kVertexParamsList) {
@@ -498,6 +498,54 @@ TEST_F(MinBufferSizeDrawTimeValidationTests, MultipleGroups) {
     });
 }
 
+// Draw time validation checks the bind groups again when the pipeline changes, even if they were
+// valid for the previous pipeline.
+TEST_F(MinBufferSizeDrawTimeValidationTests, PipelineChange) {
+    std::vector<BindingDescriptor> smallBindings = {{0, 0, "a : f32, b : f32", "f32", "a", 8}};
+    std::vector<BindingDescriptor> largeBindings = {
+        {0, 0, "a : f32, b : f32, c : f32", "f32", "a", 12}};
+
+    std::string vertexShader = CreateVertexShaderWithBindings({});
+    std::string smallFragShader = CreateFragmentShaderWithBindings(smallBindings);
+    std::string largeFragShader = CreateFragmentShaderWithBindings(largeBindings);
+
+    wgpu::BindGroupLayout layout = CreateBindGroupLayout(smallBindings, {0});
+    wgpu::RenderPipeline smallPipeline =
+        CreateRenderPipeline({layout}, vertexShader, smallFragShader);
+    wgpu::RenderPipeline largePipeline =
+        CreateRenderPipeline({layout}, vertexShader, largeFragShader);
+
+    wgpu::BindGroup bindGroup = CreateBindGroup(layout, smallBindings, {8});
+
+    PlaceholderRenderPass renderPass(device);
+
+    // Control case: the bind group can be used with the pipeline with the smaller binding.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetPipeline(smallPipeline);
+        renderPassEncoder.SetBindGroup(0, bindGroup);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetPipeline(smallPipeline);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+        commandEncoder.Finish();
+    }
+
+    // The bind group is too small for the second pipeline.
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetPipeline(smallPipeline);
+        renderPassEncoder.SetBindGroup(0, bindGroup);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetPipeline(largePipeline);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+        ASSERT_DEVICE_ERROR(commandEncoder.Finish());
+    }
+}
+
 // The correctness of minimum buffer size for the defaulted layout for a pipeline
 class MinBufferSizeDefaultLayoutTests : public MinBufferSizeTestsBase {
   public:
@@ -0,0 +1,321 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include "dawn/tests/unittests/validation/ValidationTest.h"
+
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+class SecondaryRenderPassEncoderValidationTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+
+        wgpu::ShaderModule vsModule = utils::CreateShaderModule(device, R"(
+            @vertex fn main() -> @builtin(position) vec4f {
+                return vec4f(0.0, 0.0, 0.0, 1.0);
+            })");
+
+        wgpu::ShaderModule fsModule = utils::CreateShaderModule(device, R"(
+            @fragment fn main() -> @location(0) vec4f {
+                return vec4f(0.0, 1.0, 0.0, 1.0);
+            })");
+
+        utils::ComboRenderPipelineDescriptor pipelineDescriptor;
+        pipelineDescriptor.vertex.module = vsModule;
+        pipelineDescriptor.cFragment.module = fsModule;
+        pipeline = device.CreateRenderPipeline(&pipelineDescriptor);
+
+        renderPass = utils::CreateBasicRenderPass(device, 4, 4);
+    }
+
+    wgpu::RenderPipeline pipeline;
+    utils::BasicRenderPass renderPass;
+};
+
+// Test that draws can be recorded in several secondary encoders of a render pass.
+TEST_F(SecondaryRenderPassEncoderValidationTest, Success) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(pipeline);
+    pass.Draw(3);
+
+    wgpu::RenderPassEncoder secondary0 = pass.CreateSecondaryEncoder();
+    wgpu::RenderPassEncoder secondary1 = pass.CreateSecondaryEncoder();
+
+    secondary1.SetPipeline(pipeline);
+    secondary1.SetViewport(0, 0, 2, 2, 0, 1);
+    secondary1.Draw(3);
+    secondary1.End();
+
+    secondary0.SetPipeline(pipeline);
+    secondary0.Draw(3);
+    secondary0.End();
+
+    pass.End();
+    encoder.Finish();
+}
+
+// Test that the pipeline set in the primary encoder isn't inherited by the secondary encoders.
+TEST_F(SecondaryRenderPassEncoderValidationTest, StateIsNotInherited) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(pipeline);
+
+    wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+    secondary.Draw(3);
+    secondary.End();
+
+    pass.End();
+    ASSERT_DEVICE_ERROR(encoder.Finish());
+}
+
+// Test that all the secondary encoders must be ended before the primary encoder.
+TEST_F(SecondaryRenderPassEncoderValidationTest, SecondaryNotEnded) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+
+    wgpu::RenderPassEncoder secondary0 = pass.CreateSecondaryEncoder();
+    wgpu::RenderPassEncoder secondary1 = pass.CreateSecondaryEncoder();
+    secondary0.End();
+
+    pass.End();
+    ASSERT_DEVICE_ERROR(encoder.Finish());
+}
+
+// Test that a secondary encoder cannot be ended twice.
+TEST_F(SecondaryRenderPassEncoderValidationTest, SecondaryEndedTwice) {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+
+    wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+    secondary.End();
+    ASSERT_DEVICE_ERROR(secondary.End());
+
+    pass.End();
+    encoder.Finish();
+}
+
+// Test that secondary encoders can only be created from the primary encoder while it is open.
+TEST_F(SecondaryRenderPassEncoderValidationTest, CreateSecondaryEncoder) {
+    // Secondary encoders cannot be nested.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        wgpu::RenderPassEncoder nested = secondary.CreateSecondaryEncoder();
+        nested.End();
+        secondary.End();
+
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+
+    // Secondary encoders cannot be created after the primary encoder is ended.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.End();
+
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
+// Test that commands recorded in an error secondary encoder are reported when the command
+// encoder is finished.
+TEST_F(SecondaryRenderPassEncoderValidationTest, ErrorSecondaryEncoder) {
+    // The error encoder is created from a secondary encoder.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        wgpu::RenderPassEncoder nested = secondary.CreateSecondaryEncoder();
+        nested.SetPipeline(pipeline);
+        nested.Draw(3);
+        nested.End();
+        ASSERT_DEVICE_ERROR(nested.End());
+        secondary.End();
+
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+
+    // The error encoder is created from an ended primary encoder.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.End();
+
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.SetPipeline(pipeline);
+        secondary.Draw(3);
+        secondary.End();
+        ASSERT_DEVICE_ERROR(secondary.End());
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
+// Test that queries cannot be used in secondary encoders.
+TEST_F(SecondaryRenderPassEncoderValidationTest, Queries) {
+    wgpu::QuerySetDescriptor querySetDescriptor;
+    querySetDescriptor.type = wgpu::QueryType::Occlusion;
+    querySetDescriptor.count = 1;
+    wgpu::QuerySet occlusionQuerySet = device.CreateQuerySet(&querySetDescriptor);
+
+    utils::ComboRenderPassDescriptor passDescriptor({renderPass.color.CreateView()});
+    passDescriptor.occlusionQuerySet = occlusionQuerySet;
+
+    // Control case: the occlusion query is used in the primary encoder.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&passDescriptor);
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.End();
+        pass.BeginOcclusionQuery(0);
+        pass.EndOcclusionQuery();
+        pass.End();
+        encoder.Finish();
+    }
+
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&passDescriptor);
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.BeginOcclusionQuery(0);
+        secondary.EndOcclusionQuery();
+        secondary.End();
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
+// Test that the resource usages of the secondary encoders are validated with the ones of the
+// render pass.
+TEST_F(SecondaryRenderPassEncoderValidationTest, ResourceUsages) {
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::TextureSampleType::Float}});
+
+    wgpu::TextureDescriptor descriptor;
+    descriptor.size = {4, 4};
+    descriptor.format = renderPass.colorFormat;
+    descriptor.usage = wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::TextureBinding;
+    wgpu::Texture texture = device.CreateTexture(&descriptor);
+    wgpu::TextureView view = texture.CreateView();
+    wgpu::BindGroup bg = utils::MakeBindGroup(device, bgl, {{0, view}});
+
+    // Sampling a texture that isn't an attachment of the pass is valid.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.SetBindGroup(0, bg);
+        secondary.End();
+        pass.End();
+        encoder.Finish();
+    }
+
+    // Sampling the render attachment of the pass is invalid.
+    {
+        utils::ComboRenderPassDescriptor passDescriptor({view});
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&passDescriptor);
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.SetBindGroup(0, bg);
+        secondary.End();
+        pass.End();
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+}
+
+// Test that the draws of the secondary encoders count toward the maxDrawCount of the pass.
+TEST_F(SecondaryRenderPassEncoderValidationTest, MaxDrawCount) {
+    constexpr uint64_t kMaxDrawCount = 4;
+
+    wgpu::RenderPassDescriptorMaxDrawCount maxDrawCount;
+    maxDrawCount.maxDrawCount = kMaxDrawCount;
+    renderPass.renderPassInfo.nextInChain = &maxDrawCount;
+
+    auto TestDraws = [&](uint64_t primaryDraws, uint64_t secondaryDraws, bool success) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        for (uint64_t i = 0; i < primaryDraws; i++) {
+            pass.Draw(3);
+        }
+
+        wgpu::RenderPassEncoder secondary = pass.CreateSecondaryEncoder();
+        secondary.SetPipeline(pipeline);
+        for (uint64_t i = 0; i < secondaryDraws; i++) {
+            secondary.Draw(3);
+        }
+        secondary.End();
+
+        pass.End();
+        if (success) {
+            encoder.Finish();
+        } else {
+            ASSERT_DEVICE_ERROR(encoder.Finish());
+        }
+    };
+
+    TestDraws(2, 2, true);
+    TestDraws(2, 3, false);
+    TestDraws(0, kMaxDrawCount + 1, false);
+}
+
+// Test that secondary encoders can be recorded on several threads at the same time.
+TEST_F(SecondaryRenderPassEncoderValidationTest, MultipleThreads) {
+    // The wire client isn't thread-safe.
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    constexpr uint32_t kThreadCount = 4;
+    constexpr uint32_t kDrawsPerThread = 100;
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+
+    std::vector<wgpu::RenderPassEncoder> secondaries;
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        secondaries.push_back(pass.CreateSecondaryEncoder());
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([&, i] {
+            wgpu::RenderPassEncoder secondary = secondaries[i];
+            secondary.SetPipeline(pipeline);
+            for (uint32_t draw = 0; draw < kDrawsPerThread; ++draw) {
+                secondary.Draw(3);
+            }
+            secondary.End();
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    pass.End();
+    encoder.Finish();
+}
+
+}  // anonymous namespace
@@ -12,7 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
+#include <vector>
+
 #include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
 
 namespace dawn::wire {
 
@@ -22,6 +26,16 @@ class WireBasicTests : public WireTest {
   public:
     WireBasicTests() {}
     ~WireBasicTests() override = default;
+
+    size_t GetLiveObjectCount(const char* type) {
+        for (const LiveObjectCount& count : GetWireClient()->GetLiveObjectCounts()) {
+            if (strcmp(count.type, type) == 0) {
+                return count.count;
+            }
+        }
+        ADD_FAILURE() << "Unknown object type " << type;
+        return 0;
+    }
 };
 
 // One call gets forwarded correctly.
@@ -79,4 +93,33 @@ TEST_F(WireBasicTests, ReleaseCalledOnRefCount0) {
     FlushClient();
 }
 
+// Test that the live objects of the client are counted, and that the objects freed by the client
+// aren't.
+TEST_F(WireBasicTests, LiveObjectCounts) {
+    EXPECT_EQ(1u, GetLiveObjectCount("Device"));
+    EXPECT_EQ(0u, GetLiveObjectCount("CommandEncoder"));
+
+    std::vector<WGPUCommandEncoder> encoders;
+    for (uint32_t i = 0; i < 100; ++i) {
+        encoders.push_back(wgpuDeviceCreateCommandEncoder(device, nullptr));
+    }
+    EXPECT_EQ(100u, GetLiveObjectCount("CommandEncoder"));
+
+    // The IDs of the released objects are reused by the next ones.
+    for (uint32_t i = 0; i < 50; ++i) {
+        wgpuCommandEncoderRelease(encoders[i]);
+    }
+    for (uint32_t i = 0; i < 25; ++i) {
+        encoders[i] = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    }
+    EXPECT_EQ(75u, GetLiveObjectCount("CommandEncoder"));
+
+    WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+        .Times(125)
+        .WillRepeatedly(Return(apiEncoder));
+    EXPECT_CALL(api, CommandEncoderRelease(apiEncoder)).Times(50);
+    FlushClient();
+}
+
 }  // namespace dawn::wire
@@ -0,0 +1,219 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+using testing::Mock;
+using testing::Return;
+using testing::StrictMock;
+
+// Mock class to add expectations on the wire calling callbacks
+class MockBufferMapCallback {
+  public:
+    MOCK_METHOD(void, Call, (WGPUBufferMapAsyncStatus status, void* userdata));
+};
+
+std::unique_ptr<StrictMock<MockBufferMapCallback>> mockBufferMapCallback;
+void ToMockBufferMapCallback(WGPUBufferMapAsyncStatus status, void* userdata) {
+    mockBufferMapCallback->Call(status, userdata);
+}
+
+class WireBufferReadAheadTests : public WireTest {
+  public:
+    void SetUp() override {
+        WireTest::SetUp();
+
+        mockBufferMapCallback = std::make_unique<StrictMock<MockBufferMapCallback>>();
+
+        WGPUBufferDescriptor descriptor = {};
+        descriptor.size = kBufferSize;
+        descriptor.usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst;
+        buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+        apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        FlushClient();
+
+        ASSERT_TRUE(GetWireClient()->EnableBufferReadAhead(buffer, 0, WGPU_WHOLE_MAP_SIZE));
+        FlushClient();
+    }
+
+    void TearDown() override {
+        WireTest::TearDown();
+
+        // Delete mock so that expectations are checked
+        mockBufferMapCallback = nullptr;
+    }
+
+    void FlushClient() {
+        WireTest::FlushClient();
+        Mock::VerifyAndClearExpectations(&mockBufferMapCallback);
+    }
+
+    void FlushServer() {
+        WireTest::FlushServer();
+        Mock::VerifyAndClearExpectations(&mockBufferMapCallback);
+    }
+
+    // Submits and expects the server to map the buffer for the read-ahead. The mapping completes
+    // right away unless |completeMapping| is false.
+    void SubmitAndExpectReadAhead(bool completeMapping = true) {
+        wgpuQueueSubmit(queue, 0, nullptr);
+
+        EXPECT_CALL(api, QueueSubmit(apiQueue, 0, _));
+        if (completeMapping) {
+            EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 0, kBufferSize, _, _))
+                .WillOnce(InvokeWithoutArgs([&]() {
+                    api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+                }));
+            EXPECT_CALL(api, BufferGetConstMappedRange(apiBuffer, 0, kBufferSize))
+                .WillOnce(Return(&serverContent));
+        } else {
+            EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 0, kBufferSize, _, _));
+        }
+        FlushClient();
+    }
+
+    uint32_t ReadMappedContent() {
+        return *static_cast<const uint32_t*>(
+            wgpuBufferGetConstMappedRange(buffer, 0, kBufferSize));
+    }
+
+  protected:
+    static constexpr uint64_t kBufferSize = sizeof(uint32_t);
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+    uint32_t serverContent = 31337;
+};
+
+// Check that a map of the read-ahead range after the content was pushed completes right away and
+// doesn't map the buffer again on the server.
+TEST_F(WireBufferReadAheadTests, MapAfterPushCompletesWithoutRoundTrip) {
+    SubmitAndExpectReadAhead();
+    FlushServer();
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    EXPECT_EQ(serverContent, ReadMappedContent());
+
+    // The server keeps the read-ahead mapping for the client.
+    FlushClient();
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    // The read-ahead maps the buffer again after the next submit.
+    serverContent = 42;
+    SubmitAndExpectReadAhead();
+    FlushServer();
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    EXPECT_EQ(42u, ReadMappedContent());
+}
+
+// Check that the read-ahead mapping is unmapped before the next submit, and that the content pushed
+// before that submit isn't used.
+TEST_F(WireBufferReadAheadTests, SubmitUnmapsReadAhead) {
+    SubmitAndExpectReadAhead();
+    FlushServer();
+
+    // The content is pushed again after the second submit, but the client maps the buffer before
+    // receiving it.
+    wgpuQueueSubmit(queue, 0, nullptr);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer));
+    EXPECT_CALL(api, QueueSubmit(apiQueue, 0, _));
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 0, kBufferSize, _, _));
+    FlushClient();
+
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    FlushClient();
+
+    // The pending read-ahead mapping is used for the map request.
+    serverContent = 42;
+    EXPECT_CALL(api, BufferGetConstMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(&serverContent));
+    api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+    EXPECT_EQ(42u, ReadMappedContent());
+}
+
+// Check that a map request sent while the read-ahead mapping is pending takes it over, and gets
+// an error if the mapping fails.
+TEST_F(WireBufferReadAheadTests, MapBeforePushAdoptsFailedReadAhead) {
+    SubmitAndExpectReadAhead(false);
+
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    FlushClient();
+
+    api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Error);
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Error, _)).Times(1);
+    FlushServer();
+}
+
+// Check that the content pushed by the read-ahead isn't used after the buffer is written.
+TEST_F(WireBufferReadAheadTests, WriteBufferDiscardsReadAhead) {
+    SubmitAndExpectReadAhead();
+
+    uint32_t data = 42;
+    wgpuQueueWriteBuffer(queue, buffer, 0, &data, sizeof(data));
+    EXPECT_CALL(api, BufferUnmap(apiBuffer));
+    EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 0, _, sizeof(data)));
+    FlushClient();
+
+    // The content is received after the write so it is discarded.
+    FlushServer();
+
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 0, kBufferSize, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetConstMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(&data));
+    FlushClient();
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+    EXPECT_EQ(42u, ReadMappedContent());
+}
+
+// Check that the read-ahead can only be enabled for buffers that can be mapped for reading.
+TEST_F(WireBufferReadAheadTests, EnableRequiresMapRead) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_MapWrite;
+    WGPUBuffer writeBuffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(api.GetNewBuffer()));
+    FlushClient();
+
+    EXPECT_FALSE(GetWireClient()->EnableBufferReadAhead(writeBuffer, 0, WGPU_WHOLE_MAP_SIZE));
+    EXPECT_FALSE(GetWireClient()->EnableBufferReadAhead(buffer, 2, 4));
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,197 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstdint>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+namespace dawn::wire {
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+
+class WirePackedCommandsTests : public WireTest {
+  public:
+    WirePackedCommandsTests() {}
+    ~WirePackedCommandsTests() override = default;
+
+  protected:
+    void SetUp() override {
+        WireTest::SetUp();
+
+        encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+    }
+
+    WGPURenderPassEncoder BeginRenderPass(WGPURenderPassEncoder* apiPass) {
+        WGPURenderPassDescriptor descriptor = {};
+        WGPURenderPassEncoder pass = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+        *apiPass = api.GetNewRenderPassEncoder();
+        EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _)).WillOnce(Return(*apiPass));
+        return pass;
+    }
+
+    WGPUBindGroup CreateBindGroup(WGPUBindGroup* apiBindGroup) {
+        WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+        WGPUBindGroupLayout bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+        WGPUBindGroupLayout apiBgl = api.GetNewBindGroupLayout();
+        EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBgl));
+
+        WGPUBindGroupDescriptor descriptor = {};
+        descriptor.layout = bgl;
+        WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &descriptor);
+        *apiBindGroup = api.GetNewBindGroup();
+        EXPECT_CALL(api, DeviceCreateBindGroup(apiDevice, _)).WillOnce(Return(*apiBindGroup));
+        return bindGroup;
+    }
+
+    WGPUCommandEncoder encoder;
+    WGPUCommandEncoder apiEncoder;
+
+  private:
+    bool UseClientCompactEncoding() override { return true; }
+    bool AcceptServerCompactEncoding() override { return true; }
+};
+
+// Test that draws are sent packed, including runs of identical draws, and executed in order.
+TEST_F(WirePackedCommandsTests, Draws) {
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 2, 1, -4, 0xFFFF'FFFFu);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 2, 1, -4, 0xFFFF'FFFFu);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 0xFFFF'FFFFu, 0, 0xFFFF'FFFFu, INT32_MIN, 0);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0)).Times(3);
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 2, 1, -4, 0xFFFF'FFFFu))
+            .Times(2);
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0)).Times(1);
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 0xFFFF'FFFFu, 0, 0xFFFF'FFFFu,
+                                                      INT32_MIN, 0))
+            .Times(1);
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass)).Times(1);
+    }
+
+    FlushClient();
+}
+
+// Test that the state changes of render passes are sent packed with their arguments intact.
+TEST_F(WirePackedCommandsTests, SetBindGroup) {
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    std::array<uint32_t, 3> testOffsets = {0, 0xDEAD'BEEFu, 0xFFFF'FFFFu};
+    wgpuRenderPassEncoderSetBindGroup(pass, 2, bindGroup, testOffsets.size(), testOffsets.data());
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroup, 0, nullptr);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(
+                             apiPass, 2, apiBindGroup, testOffsets.size(),
+                             MatchesLambda([testOffsets](const uint32_t* offsets) -> bool {
+                                 for (size_t i = 0; i < testOffsets.size(); i++) {
+                                     if (offsets[i] != testOffsets[i]) {
+                                         return false;
+                                     }
+                                 }
+                                 return true;
+                             })));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroup, 0, _));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass)).Times(1);
+    }
+
+    FlushClient();
+}
+
+// Test that the commands of interleaved render passes are executed on the right pass and in order.
+TEST_F(WirePackedCommandsTests, InterleavedRenderPasses) {
+    WGPURenderPassDescriptor descriptor = {};
+    WGPURenderPassEncoder pass1 = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+    WGPURenderPassEncoder pass2 = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+    WGPURenderPassEncoder apiPass1 = api.GetNewRenderPassEncoder();
+    WGPURenderPassEncoder apiPass2 = api.GetNewRenderPassEncoder();
+    EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _))
+        .WillOnce(Return(apiPass1))
+        .WillOnce(Return(apiPass2));
+
+    wgpuRenderPassEncoderDraw(pass1, 1, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass2, 2, 1, 0, 0);
+    wgpuRenderPassEncoderDraw(pass1, 1, 1, 0, 0);
+    wgpuRenderPassEncoderEnd(pass1);
+    wgpuRenderPassEncoderEnd(pass2);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass1, 1, 1, 0, 0)).Times(1);
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass2, 2, 1, 0, 0)).Times(1);
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass1, 1, 1, 0, 0)).Times(1);
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass1)).Times(1);
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass2)).Times(1);
+    }
+
+    FlushClient();
+}
+
+// Test that a null bind group falls back to the regular command, which is a fatal error.
+TEST_F(WirePackedCommandsTests, NullBindGroup) {
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, nullptr, 0, nullptr);
+
+    // The packed draw is sent before the regular command.
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0)).Times(1);
+
+    FlushClient(false);
+}
+
+class WirePackedCommandsNotAcceptedTests : public WireTest {
+  private:
+    bool UseClientCompactEncoding() override { return true; }
+};
+
+// Test that a server that doesn't accept the compact encoding rejects packed commands.
+TEST_F(WirePackedCommandsNotAcceptedTests, PackedCommandsAreRejected) {
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr)).WillOnce(Return(apiEncoder));
+
+    WGPURenderPassDescriptor descriptor = {};
+    WGPURenderPassEncoder pass = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+    WGPURenderPassEncoder apiPass = api.GetNewRenderPassEncoder();
+    EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _)).WillOnce(Return(apiPass));
+
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderEnd(pass);
+
+    FlushClient(false);
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,285 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+using testing::Mock;
+using testing::Return;
+using testing::StrictMock;
+
+// Mock class to add expectations on the wire calling callbacks
+class MockBufferMapCallback {
+  public:
+    MOCK_METHOD(void, Call, (WGPUBufferMapAsyncStatus status, void* userdata));
+};
+
+std::unique_ptr<StrictMock<MockBufferMapCallback>> mockBufferMapCallback;
+void ToMockBufferMapCallback(WGPUBufferMapAsyncStatus status, void* userdata) {
+    mockBufferMapCallback->Call(status, userdata);
+}
+
+class WireSharedMemoryTransferServiceTests : public WireTest {
+  public:
+    void SetUp() override {
+        // Shared memory names are limited to 31 characters on macOS.
+        uint64_t timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        mNamePrefix = "/dawn-mts-" + std::to_string(timestamp % 1'000'000'000'000ull);
+
+        mClientMemoryTransferService =
+            client::CreateSharedMemoryTransferService(mNamePrefix.c_str());
+        mServerMemoryTransferService =
+            server::CreateSharedMemoryTransferService(mNamePrefix.c_str());
+
+        WireTest::SetUp();
+
+        if (mClientMemoryTransferService == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on this platform";
+        }
+        ASSERT_NE(mServerMemoryTransferService, nullptr);
+
+        mockBufferMapCallback = std::make_unique<StrictMock<MockBufferMapCallback>>();
+    }
+
+    void TearDown() override {
+        WireTest::TearDown();
+
+        // Delete mock so that expectations are checked
+        mockBufferMapCallback = nullptr;
+    }
+
+    void FlushClient(bool success = true) {
+        WireTest::FlushClient(success);
+        Mock::VerifyAndClearExpectations(&mockBufferMapCallback);
+    }
+
+    void FlushServer(bool success = true) {
+        WireTest::FlushServer(success);
+        Mock::VerifyAndClearExpectations(&mockBufferMapCallback);
+    }
+
+    WGPUBuffer CreateBuffer(WGPUBufferUsage usage, WGPUBuffer* apiBuffer) {
+        WGPUBufferDescriptor descriptor = {};
+        descriptor.size = kBufferSize;
+        descriptor.usage = usage;
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+        *apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(*apiBuffer));
+        FlushClient();
+        return buffer;
+    }
+
+  protected:
+    static constexpr uint64_t kBufferSize = 4 * sizeof(uint32_t);
+
+    std::string mNamePrefix;
+    std::unique_ptr<client::MemoryTransferService> mClientMemoryTransferService;
+    std::unique_ptr<server::MemoryTransferService> mServerMemoryTransferService;
+
+  private:
+    client::MemoryTransferService* GetClientMemoryTransferService() override {
+        return mClientMemoryTransferService.get();
+    }
+    server::MemoryTransferService* GetServerMemoryTransferService() override {
+        return mServerMemoryTransferService.get();
+    }
+};
+
+// Check that the content written by the client in a buffer mapped for writing reaches the server
+// when it is unmapped.
+TEST_F(WireSharedMemoryTransferServiceTests, MapWrite) {
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(WGPUBufferUsage_MapWrite, &apiBuffer);
+
+    uint32_t serverContent[4] = {1, 2, 3, 4};
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Write, 4, 8, ToMockBufferMapCallback, nullptr);
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Write, 4, 8, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 4, 8)).WillOnce(Return(&serverContent[1]));
+    FlushClient();
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+
+    uint32_t* mapping = static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, 4, 8));
+    ASSERT_NE(mapping, nullptr);
+    mapping[0] = 42;
+    mapping[1] = 43;
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    // Only the mapped range is copied.
+    EXPECT_EQ(1u, serverContent[0]);
+    EXPECT_EQ(42u, serverContent[1]);
+    EXPECT_EQ(43u, serverContent[2]);
+    EXPECT_EQ(4u, serverContent[3]);
+}
+
+// Check that the content of a buffer mapped for reading on the server reaches the client.
+TEST_F(WireSharedMemoryTransferServiceTests, MapRead) {
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(WGPUBufferUsage_MapRead, &apiBuffer);
+
+    uint32_t serverContent[4] = {1, 2, 3, 4};
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, kBufferSize, ToMockBufferMapCallback, nullptr);
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 0, kBufferSize, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetConstMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(&serverContent));
+    FlushClient();
+
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+
+    const uint32_t* mapping =
+        static_cast<const uint32_t*>(wgpuBufferGetConstMappedRange(buffer, 0, kBufferSize));
+    ASSERT_NE(mapping, nullptr);
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(serverContent[i], mapping[i]);
+    }
+}
+
+// Check that a buffer mapped at creation can be unmapped before the command that creates it is
+// flushed. Its write handle is destroyed on unmap, before the server opened its shared memory.
+TEST_F(WireSharedMemoryTransferServiceTests, MappedAtCreationUnmapBeforeFlush) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_CopySrc;
+    descriptor.mappedAtCreation = true;
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+    uint32_t* mapping = static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, 0, kBufferSize));
+    ASSERT_NE(mapping, nullptr);
+    for (uint32_t i = 0; i < 4; ++i) {
+        mapping[i] = 42 + i;
+    }
+    wgpuBufferUnmap(buffer);
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    uint32_t serverContent[4] = {};
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(&serverContent));
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(42u + i, serverContent[i]);
+    }
+}
+
+// Check that a buffer mapped at creation can be destroyed and released before the command that
+// creates it is flushed.
+TEST_F(WireSharedMemoryTransferServiceTests, MappedAtCreationDestroyBeforeFlush) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_CopySrc;
+    descriptor.mappedAtCreation = true;
+
+    // Destroy the buffer.
+    {
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+        wgpuBufferDestroy(buffer);
+
+        WGPUBuffer apiBuffer = api.GetNewBuffer();
+        uint32_t serverContent[4] = {};
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, kBufferSize))
+            .WillOnce(Return(&serverContent));
+        EXPECT_CALL(api, BufferDestroy(apiBuffer)).Times(1);
+        FlushClient();
+
+        wgpuBufferRelease(buffer);
+        EXPECT_CALL(api, BufferRelease(apiBuffer)).Times(1);
+        FlushClient();
+    }
+
+    // Release the buffer.
+    {
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+        wgpuBufferRelease(buffer);
+
+        WGPUBuffer apiBuffer = api.GetNewBuffer();
+        uint32_t serverContent[4] = {};
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, kBufferSize))
+            .WillOnce(Return(&serverContent));
+        EXPECT_CALL(api, BufferRelease(apiBuffer)).Times(1);
+        FlushClient();
+    }
+}
+
+// Check that the data updates of the handles are empty, so that the content of buffers is never
+// sent in the commands.
+TEST_F(WireSharedMemoryTransferServiceTests, DataUpdatesAreEmpty) {
+    std::unique_ptr<client::MemoryTransferService::WriteHandle> writeHandle(
+        mClientMemoryTransferService->CreateWriteHandle(1024));
+    ASSERT_NE(writeHandle, nullptr);
+    EXPECT_EQ(0u, writeHandle->SizeOfSerializeDataUpdate(0, 1024));
+
+    std::vector<char> createInfo(writeHandle->SerializeCreateSize());
+    writeHandle->SerializeCreate(createInfo.data());
+    server::MemoryTransferService::ReadHandle* serverReadHandle = nullptr;
+    ASSERT_TRUE(mServerMemoryTransferService->DeserializeReadHandle(
+        createInfo.data(), createInfo.size(), &serverReadHandle));
+    EXPECT_EQ(0u, serverReadHandle->SizeOfSerializeDataUpdate(0, 1024));
+    delete serverReadHandle;
+}
+
+// Check that the server only opens the shared memory objects whose name has its prefix, and that
+// the create info is validated.
+TEST_F(WireSharedMemoryTransferServiceTests, DeserializeValidation) {
+    std::unique_ptr<client::MemoryTransferService::ReadHandle> readHandle(
+        mClientMemoryTransferService->CreateReadHandle(kBufferSize));
+    ASSERT_NE(readHandle, nullptr);
+    std::vector<char> createInfo(readHandle->SerializeCreateSize());
+    readHandle->SerializeCreate(createInfo.data());
+
+    server::MemoryTransferService::ReadHandle* serverReadHandle = nullptr;
+
+    // The create info is truncated.
+    EXPECT_FALSE(mServerMemoryTransferService->DeserializeReadHandle(
+        createInfo.data(), createInfo.size() - 1, &serverReadHandle));
+
+    // The name doesn't have the prefix of the server.
+    std::string otherPrefix = mNamePrefix + "-other";
+    std::unique_ptr<server::MemoryTransferService> otherServerService =
+        server::CreateSharedMemoryTransferService(otherPrefix.c_str());
+    EXPECT_FALSE(otherServerService->DeserializeReadHandle(createInfo.data(), createInfo.size(),
+                                                           &serverReadHandle));
+
+    ASSERT_TRUE(mServerMemoryTransferService->DeserializeReadHandle(
+        createInfo.data(), createInfo.size(), &serverReadHandle));
+    delete serverReadHandle;
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,178 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "dawn/wire/SharedMemoryTransport.h"
+#include "gtest/gtest.h"
+
+namespace dawn::wire {
+namespace {
+
+// A CommandHandler for records made of a uint32_t size followed by |size| bytes that are all equal
+// to the index of the record modulo 256.
+class RecordHandler : public CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        const volatile char* end = commands + size;
+        while (commands < end) {
+            uint32_t recordSize;
+            memcpy(&recordSize, const_cast<const char*>(commands), sizeof(recordSize));
+            EXPECT_LE(commands + sizeof(recordSize) + recordSize, end);
+            for (uint32_t i = 0; i < recordSize; ++i) {
+                if (commands[sizeof(recordSize) + i] != static_cast<char>(mRecordCount)) {
+                    mCorruptedRecordCount++;
+                    break;
+                }
+            }
+            commands += sizeof(recordSize) + recordSize;
+            mRecordCount++;
+        }
+        return commands;
+    }
+
+    uint32_t mRecordCount = 0;
+    uint32_t mCorruptedRecordCount = 0;
+};
+
+bool SerializeRecord(CommandSerializer* serializer, uint32_t recordIndex, uint32_t recordSize) {
+    char* space = static_cast<char*>(serializer->GetCmdSpace(sizeof(recordSize) + recordSize));
+    if (space == nullptr) {
+        return false;
+    }
+    memcpy(space, &recordSize, sizeof(recordSize));
+    memset(space + sizeof(recordSize), static_cast<char>(recordIndex), recordSize);
+    return true;
+}
+
+class WireSharedMemoryTransportTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        // Shared memory names are limited to 31 characters on macOS.
+        uint64_t timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        mName = "/dawn-wire-" + std::to_string(timestamp % 1'000'000'000'000ull);
+
+        mSerializer = SharedMemoryCommandSerializer::Create(mName.c_str(), kCapacity);
+        if (mSerializer == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on this platform";
+        }
+        mReceiver = SharedMemoryCommandReceiver::Open(mName.c_str());
+        ASSERT_NE(mReceiver, nullptr);
+    }
+
+    static constexpr size_t kCapacity = 64 * 1024;
+
+    std::string mName;
+    std::unique_ptr<SharedMemoryCommandSerializer> mSerializer;
+    std::unique_ptr<SharedMemoryCommandReceiver> mReceiver;
+};
+
+// Test that commands are only visible to the receiver after they are flushed.
+TEST_F(WireSharedMemoryTransportTests, CommandsVisibleAfterFlush) {
+    RecordHandler handler;
+    ASSERT_TRUE(SerializeRecord(mSerializer.get(), 0, 12));
+    ASSERT_TRUE(SerializeRecord(mSerializer.get(), 1, 100));
+
+    EXPECT_TRUE(mReceiver->HandleCommands(&handler));
+    EXPECT_EQ(handler.mRecordCount, 0u);
+
+    EXPECT_TRUE(mSerializer->Flush());
+    EXPECT_TRUE(mReceiver->HandleCommands(&handler));
+    EXPECT_EQ(handler.mRecordCount, 2u);
+    EXPECT_EQ(handler.mCorruptedRecordCount, 0u);
+    EXPECT_EQ(mReceiver->GetHandledSize(), 2 * sizeof(uint32_t) + 112);
+}
+
+// Test that commands of all sizes up to the capacity of the ring, including ones that wrap around
+// its end, are received intact while the serializer and the receiver run concurrently.
+TEST_F(WireSharedMemoryTransportTests, ConcurrentWrappingCommands) {
+    constexpr uint32_t kRecordCount = 2000;
+    const size_t maxRecordSize = mSerializer->GetMaximumAllocationSize() - sizeof(uint32_t);
+    ASSERT_GE(mSerializer->GetMaximumAllocationSize(), kCapacity);
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < kRecordCount; ++i) {
+            uint32_t recordSize = (i % 50 == 0) ? maxRecordSize : (i * 7919) % 3000;
+            if (!SerializeRecord(mSerializer.get(), i, recordSize)) {
+                ADD_FAILURE() << "Failed to serialize record " << i;
+                break;
+            }
+            if (i % 16 == 0) {
+                mSerializer->Flush();
+            }
+        }
+        mSerializer->Close();
+    });
+
+    RecordHandler handler;
+    while (mReceiver->WaitForCommands()) {
+        ASSERT_TRUE(mReceiver->HandleCommands(&handler));
+    }
+    producer.join();
+
+    EXPECT_EQ(handler.mRecordCount, kRecordCount);
+    EXPECT_EQ(handler.mCorruptedRecordCount, 0u);
+}
+
+// Test that the serializer stops waiting for space once the receiver is closed.
+TEST_F(WireSharedMemoryTransportTests, ReceiverClosed) {
+    const size_t recordSize = mSerializer->GetMaximumAllocationSize() / 2;
+    ASSERT_TRUE(SerializeRecord(mSerializer.get(), 0, recordSize));
+    mReceiver->Close();
+
+    EXPECT_EQ(mSerializer->GetCmdSpace(recordSize), nullptr);
+    EXPECT_FALSE(mSerializer->Flush());
+}
+
+// Test that a command larger than the ring fails and closes the serializer.
+TEST_F(WireSharedMemoryTransportTests, CommandLargerThanRing) {
+    ASSERT_TRUE(SerializeRecord(mSerializer.get(), 0, 12));
+    EXPECT_EQ(mSerializer->GetCmdSpace(mSerializer->GetMaximumAllocationSize() + 1), nullptr);
+    EXPECT_EQ(mSerializer->GetCmdSpace(12), nullptr);
+
+    // The commands serialized before are still received.
+    RecordHandler handler;
+    while (mReceiver->WaitForCommands()) {
+        ASSERT_TRUE(mReceiver->HandleCommands(&handler));
+    }
+    EXPECT_EQ(handler.mRecordCount, 1u);
+}
+
+// Test that a failure of the command handler is returned.
+TEST_F(WireSharedMemoryTransportTests, HandlerError) {
+    class FailingHandler : public CommandHandler {
+      public:
+        const volatile char* HandleCommands(const volatile char*, size_t) override {
+            return nullptr;
+        }
+    } handler;
+
+    ASSERT_TRUE(SerializeRecord(mSerializer.get(), 0, 12));
+    mSerializer->Flush();
+    EXPECT_FALSE(mReceiver->HandleCommands(&handler));
+}
+
+// Test that opening a ring that doesn't exist fails.
+TEST_F(WireSharedMemoryTransportTests, OpenUnknownRing) {
+    std::string unknownName = mName + "-unknown";
+    EXPECT_EQ(SharedMemoryCommandReceiver::Open(unknownName.c_str()), nullptr);
+    EXPECT_EQ(SharedMemoryCommandSerializer::Open(unknownName.c_str()), nullptr);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -37,6 +37,14 @@ dawn::wire::server::MemoryTransferService* WireTest::GetServerMemoryTransferServ
     return nullptr;
 }
 
+bool WireTest::UseClientCompactEncoding() {
+    return false;
+}
+
+bool WireTest::AcceptServerCompactEncoding() {
+    return false;
+}
+
 void WireTest::SetUp() {
     DawnProcTable mockProcs;
     api.GetProcTable(&mockProcs);
@@ -55,6 +63,7 @@ void WireTest::SetUp() {
     serverDesc.procs = &mockProcs;
     serverDesc.serializer = mS2cBuf.get();
     serverDesc.memoryTransferService = GetServerMemoryTransferService();
+    serverDesc.acceptCompactEncoding = AcceptServerCompactEncoding();
 
     mWireServer.reset(new dawn::wire::WireServer(serverDesc));
     mC2sBuf->SetHandler(mWireServer.get());
@@ -62,6 +71,7 @@ void WireTest::SetUp() {
     dawn::wire::WireClientDescriptor clientDesc = {};
     clientDesc.serializer = mC2sBuf.get();
     clientDesc.memoryTransferService = GetClientMemoryTransferService();
+    clientDesc.useCompactEncoding = UseClientCompactEncoding();
 
     mWireClient.reset(new dawn::wire::WireClient(clientDesc));
     mS2cBuf->SetHandler(mWireClient.get());
@@ -137,6 +137,8 @@ class WireTest : public testing::Test {
 
     virtual dawn::wire::client::MemoryTransferService* GetClientMemoryTransferService();
     virtual dawn::wire::server::MemoryTransferService* GetServerMemoryTransferService();
+    virtual bool UseClientCompactEncoding();
+    virtual bool AcceptServerCompactEncoding();
 
     std::unique_ptr<dawn::wire::WireServer> mWireServer;
     std::unique_ptr<dawn::wire::WireClient> mWireClient;
@@ -94,13 +94,14 @@ class WireHelperDirect : public WireHelper {
 
 class WireHelperProxy : public WireHelper {
   public:
-    explicit WireHelperProxy(const char* wireTraceDir, const DawnProcTable& procs) {
+    WireHelperProxy(const char* wireTraceDir, const DawnProcTable& procs, bool useCompactEncoding) {
         mC2sBuf = std::make_unique<utils::TerribleCommandBuffer>();
         mS2cBuf = std::make_unique<utils::TerribleCommandBuffer>();
 
         dawn::wire::WireServerDescriptor serverDesc = {};
         serverDesc.procs = &procs;
         serverDesc.serializer = mS2cBuf.get();
+        serverDesc.acceptCompactEncoding = useCompactEncoding;
 
         mWireServer.reset(new dawn::wire::WireServer(serverDesc));
         mC2sBuf->SetHandler(mWireServer.get());
@@ -112,6 +113,7 @@ class WireHelperProxy : public WireHelper {
 
         dawn::wire::WireClientDescriptor clientDesc = {};
         clientDesc.serializer = mC2sBuf.get();
+        clientDesc.useCompactEncoding = useCompactEncoding;
 
         mWireClient.reset(new dawn::wire::WireClient(clientDesc));
         mS2cBuf->SetHandler(mWireClient.get());
@@ -149,9 +151,11 @@ class WireHelperProxy : public WireHelper {
 
 std::unique_ptr<WireHelper> CreateWireHelper(const DawnProcTable& procs,
                                              bool useWire,
-                                             const char* wireTraceDir) {
+                                             const char* wireTraceDir,
+                                             bool useCompactEncoding) {
     if (useWire) {
-        return std::unique_ptr<WireHelper>(new WireHelperProxy(wireTraceDir, procs));
+        return std::unique_ptr<WireHelper>(
+            new WireHelperProxy(wireTraceDir, procs, useCompactEncoding));
     } else {
         return std::unique_ptr<WireHelper>(new WireHelperDirect(procs));
     }
@@ -0,0 +1,311 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/PackedCommands.h"
+
+#include <limits>
+
+namespace dawn::wire {
+
+namespace {
+
+uint64_t ZigZagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t ZigZagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+}  // anonymous namespace
+
+// PackedCommandEncoder
+
+PackedCommandEncoder::PackedCommandEncoder() = default;
+
+PackedCommandEncoder::~PackedCommandEncoder() = default;
+
+void PackedCommandEncoder::SetPipeline(ObjectId pipeline) {
+    WriteOpcode(PackedCommand::SetPipeline);
+    WriteObjectId(&mPreviousPipeline, pipeline);
+}
+
+void PackedCommandEncoder::SetBindGroup(uint32_t groupIndex,
+                                        ObjectId group,
+                                        uint32_t dynamicOffsetCount,
+                                        const uint32_t* dynamicOffsets) {
+    WriteOpcode(PackedCommand::SetBindGroup);
+    WriteVarint(groupIndex);
+    WriteObjectId(&mPreviousBindGroup, group);
+    WriteVarint(dynamicOffsetCount);
+    for (uint32_t i = 0; i < dynamicOffsetCount; ++i) {
+        WriteVarint(dynamicOffsets[i]);
+    }
+}
+
+void PackedCommandEncoder::SetVertexBuffer(uint32_t slot,
+                                           ObjectId buffer,
+                                           uint64_t offset,
+                                           uint64_t size) {
+    WriteOpcode(PackedCommand::SetVertexBuffer);
+    WriteVarint(slot);
+    WriteObjectId(&mPreviousBuffer, buffer);
+    WriteVarint(offset);
+    // WGPU_WHOLE_SIZE wraps around to 0.
+    WriteVarint(size + 1);
+}
+
+void PackedCommandEncoder::SetIndexBuffer(ObjectId buffer,
+                                          WGPUIndexFormat format,
+                                          uint64_t offset,
+                                          uint64_t size) {
+    WriteOpcode(PackedCommand::SetIndexBuffer);
+    WriteObjectId(&mPreviousBuffer, buffer);
+    WriteVarint(static_cast<uint32_t>(format));
+    WriteVarint(offset);
+    WriteVarint(size + 1);
+}
+
+void PackedCommandEncoder::Draw(uint32_t vertexCount,
+                                uint32_t instanceCount,
+                                uint32_t firstVertex,
+                                uint32_t firstInstance) {
+    AppendDraw(PackedCommand::Draw, {vertexCount, instanceCount, firstVertex, firstInstance, 0});
+}
+
+void PackedCommandEncoder::DrawIndexed(uint32_t indexCount,
+                                       uint32_t instanceCount,
+                                       uint32_t firstIndex,
+                                       int32_t baseVertex,
+                                       uint32_t firstInstance) {
+    AppendDraw(PackedCommand::DrawIndexed, {indexCount, instanceCount, firstIndex,
+                                            static_cast<uint32_t>(baseVertex), firstInstance});
+}
+
+void PackedCommandEncoder::AppendDraw(PackedCommand command, const DrawArgs& args) {
+    if (mHasLastDraw && mLastDrawCommand == command && mLastDrawArgs == args) {
+        if (mPendingRepeatCount == kMaxPackedDrawRepeatCount) {
+            EndRepeatedDraws();
+        }
+        mPendingRepeatCount++;
+        return;
+    }
+
+    WriteOpcode(command);
+    WriteVarint(args[0]);
+    WriteVarint(args[1]);
+    WriteVarint(args[2]);
+    if (command == PackedCommand::Draw) {
+        WriteVarint(args[3]);
+    } else {
+        WriteVarint(ZigZagEncode(static_cast<int32_t>(args[3])));
+        WriteVarint(args[4]);
+    }
+
+    mHasLastDraw = true;
+    mLastDrawCommand = command;
+    mLastDrawArgs = args;
+}
+
+void PackedCommandEncoder::EndRepeatedDraws() {
+    if (mPendingRepeatCount == 0) {
+        return;
+    }
+    // Append the opcode directly since WriteOpcode ends the run.
+    mData.push_back(static_cast<uint8_t>(PackedCommand::RepeatDraw));
+    WriteVarint(mPendingRepeatCount);
+    mPendingRepeatCount = 0;
+}
+
+bool PackedCommandEncoder::IsEmpty() const {
+    return mData.empty() && mPendingRepeatCount == 0;
+}
+
+size_t PackedCommandEncoder::GetSize() const {
+    return mData.size();
+}
+
+const std::vector<uint8_t>& PackedCommandEncoder::Finish() {
+    EndRepeatedDraws();
+    return mData;
+}
+
+void PackedCommandEncoder::Reset() {
+    mData.clear();
+    mPreviousPipeline = 0;
+    mPreviousBindGroup = 0;
+    mPreviousBuffer = 0;
+    mHasLastDraw = false;
+    mPendingRepeatCount = 0;
+}
+
+void PackedCommandEncoder::WriteOpcode(PackedCommand command) {
+    EndRepeatedDraws();
+    mData.push_back(static_cast<uint8_t>(command));
+}
+
+void PackedCommandEncoder::WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+        mData.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    mData.push_back(static_cast<uint8_t>(value));
+}
+
+void PackedCommandEncoder::WriteObjectId(ObjectId* previous, ObjectId id) {
+    WriteVarint(ZigZagEncode(int64_t(id) - int64_t(*previous)));
+    *previous = id;
+}
+
+// PackedCommandDecoder
+
+PackedCommandDecoder::PackedCommandDecoder(const uint8_t* data, size_t size)
+    : mData(data), mEnd(data + size) {}
+
+PackedCommandDecoder::~PackedCommandDecoder() = default;
+
+bool PackedCommandDecoder::IsEmpty() const {
+    return mData == mEnd;
+}
+
+WireResult PackedCommandDecoder::ReadCommand(PackedCommandRecord* record) {
+    if (mData == mEnd) {
+        return WireResult::FatalError;
+    }
+    PackedCommand command = static_cast<PackedCommand>(*mData++);
+
+    record->command = command;
+    switch (command) {
+        case PackedCommand::SetPipeline:
+            WIRE_TRY(ReadObjectId(&mPreviousPipeline, &record->objectId));
+            return WireResult::Success;
+
+        case PackedCommand::SetBindGroup: {
+            WIRE_TRY(ReadUint32(&record->index));
+            WIRE_TRY(ReadObjectId(&mPreviousBindGroup, &record->objectId));
+            WIRE_TRY(ReadUint32(&record->dynamicOffsetCount));
+            // Each offset takes at least one byte, which bounds the size of the allocation.
+            if (record->dynamicOffsetCount > size_t(mEnd - mData)) {
+                return WireResult::FatalError;
+            }
+            mDynamicOffsets.resize(record->dynamicOffsetCount);
+            for (uint32_t& offset : mDynamicOffsets) {
+                WIRE_TRY(ReadUint32(&offset));
+            }
+            record->dynamicOffsets = mDynamicOffsets.data();
+            return WireResult::Success;
+        }
+
+        case PackedCommand::SetVertexBuffer:
+            WIRE_TRY(ReadUint32(&record->index));
+            WIRE_TRY(ReadObjectId(&mPreviousBuffer, &record->objectId));
+            WIRE_TRY(ReadVarint(&record->offset));
+            WIRE_TRY(ReadVarint(&record->size));
+            record->size--;
+            return WireResult::Success;
+
+        case PackedCommand::SetIndexBuffer: {
+            uint32_t format;
+            WIRE_TRY(ReadObjectId(&mPreviousBuffer, &record->objectId));
+            WIRE_TRY(ReadUint32(&format));
+            WIRE_TRY(ReadVarint(&record->offset));
+            WIRE_TRY(ReadVarint(&record->size));
+            record->format = static_cast<WGPUIndexFormat>(format);
+            record->size--;
+            return WireResult::Success;
+        }
+
+        case PackedCommand::Draw:
+        case PackedCommand::DrawIndexed:
+            WIRE_TRY(ReadUint32(&record->count));
+            WIRE_TRY(ReadUint32(&record->instanceCount));
+            WIRE_TRY(ReadUint32(&record->first));
+            record->baseVertex = 0;
+            if (command == PackedCommand::DrawIndexed) {
+                uint64_t baseVertex;
+                WIRE_TRY(ReadVarint(&baseVertex));
+                int64_t decoded = ZigZagDecode(baseVertex);
+                if (decoded < std::numeric_limits<int32_t>::min() ||
+                    decoded > std::numeric_limits<int32_t>::max()) {
+                    return WireResult::FatalError;
+                }
+                record->baseVertex = static_cast<int32_t>(decoded);
+            }
+            WIRE_TRY(ReadUint32(&record->firstInstance));
+            record->drawCount = 1;
+
+            mHasLastDraw = true;
+            mLastDraw = *record;
+            return WireResult::Success;
+
+        case PackedCommand::RepeatDraw: {
+            uint32_t repeatCount;
+            WIRE_TRY(ReadUint32(&repeatCount));
+            if (!mHasLastDraw || repeatCount == 0 || repeatCount > kMaxPackedDrawRepeatCount) {
+                return WireResult::FatalError;
+            }
+            *record = mLastDraw;
+            record->drawCount = repeatCount;
+            return WireResult::Success;
+        }
+
+        default:
+            return WireResult::FatalError;
+    }
+}
+
+WireResult PackedCommandDecoder::ReadVarint(uint64_t* value) {
+    uint64_t result = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7) {
+        if (mData == mEnd) {
+            return WireResult::FatalError;
+        }
+        uint8_t byte = *mData++;
+        result |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return WireResult::Success;
+        }
+    }
+    // The varint is longer than 10 bytes.
+    return WireResult::FatalError;
+}
+
+WireResult PackedCommandDecoder::ReadUint32(uint32_t* value) {
+    uint64_t value64;
+    WIRE_TRY(ReadVarint(&value64));
+    if (value64 > std::numeric_limits<uint32_t>::max()) {
+        return WireResult::FatalError;
+    }
+    *value = static_cast<uint32_t>(value64);
+    return WireResult::Success;
+}
+
+WireResult PackedCommandDecoder::ReadObjectId(ObjectId* previous, ObjectId* id) {
+    uint64_t delta;
+    WIRE_TRY(ReadVarint(&delta));
+    // Deltas between two valid IDs are encoded in at most 33 bits.
+    if (delta >> 33 != 0) {
+        return WireResult::FatalError;
+    }
+    int64_t decoded = int64_t(*previous) + ZigZagDecode(delta);
+    if (decoded < 0 || decoded > std::numeric_limits<ObjectId>::max()) {
+        return WireResult::FatalError;
+    }
+    *id = static_cast<ObjectId>(decoded);
+    *previous = *id;
+    return WireResult::Success;
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,158 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_PACKEDCOMMANDS_H_
+#define SRC_DAWN_WIRE_PACKEDCOMMANDS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dawn/webgpu.h"
+#include "dawn/wire/ObjectHandle.h"
+#include "dawn/wire/WireResult.h"
+
+namespace dawn::wire {
+
+// The compact encoding of the hot render pass commands, sent in a single
+// RenderPassEncoderPackedCommands command instead of one wire command per call when both the
+// client and the server opt into it:
+//  - Each command is an opcode byte followed by its arguments as LEB128 varints, so that the
+//    small values of most arguments take a single byte.
+//  - Object IDs are zigzag-encoded as the difference with the previous ID of the same type in the
+//    packed command, since applications tend to use objects that were created together.
+//  - Sizes are encoded plus one so that WGPU_WHOLE_SIZE takes a single byte.
+//  - A draw identical to the previous draw of the packed command is encoded as a RepeatDraw,
+//    and a run of them as a single RepeatDraw with the number of repetitions.
+// Each packed command is decoded independently of the others.
+enum class PackedCommand : uint8_t {
+    SetPipeline,
+    SetBindGroup,
+    SetVertexBuffer,
+    SetIndexBuffer,
+    Draw,
+    DrawIndexed,
+    RepeatDraw,
+};
+
+// Bounds the amount of work a single RepeatDraw can cause on the server.
+static constexpr uint32_t kMaxPackedDrawRepeatCount = 1 << 16;
+
+class PackedCommandEncoder {
+  public:
+    PackedCommandEncoder();
+    ~PackedCommandEncoder();
+
+    void SetPipeline(ObjectId pipeline);
+    void SetBindGroup(uint32_t groupIndex,
+                      ObjectId group,
+                      uint32_t dynamicOffsetCount,
+                      const uint32_t* dynamicOffsets);
+    void SetVertexBuffer(uint32_t slot, ObjectId buffer, uint64_t offset, uint64_t size);
+    void SetIndexBuffer(ObjectId buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+    void Draw(uint32_t vertexCount,
+              uint32_t instanceCount,
+              uint32_t firstVertex,
+              uint32_t firstInstance);
+    void DrawIndexed(uint32_t indexCount,
+                     uint32_t instanceCount,
+                     uint32_t firstIndex,
+                     int32_t baseVertex,
+                     uint32_t firstInstance);
+
+    bool IsEmpty() const;
+    // The size of the encoded commands, not counting a pending run of repeated draws.
+    size_t GetSize() const;
+
+    // Ends the pending run of repeated draws and returns the encoded commands.
+    const std::vector<uint8_t>& Finish();
+    // Starts a new packed command.
+    void Reset();
+
+  private:
+    using DrawArgs = std::array<uint32_t, 5>;
+
+    void AppendDraw(PackedCommand command, const DrawArgs& args);
+    void EndRepeatedDraws();
+
+    void WriteOpcode(PackedCommand command);
+    void WriteVarint(uint64_t value);
+    void WriteObjectId(ObjectId* previous, ObjectId id);
+
+    std::vector<uint8_t> mData;
+    ObjectId mPreviousPipeline = 0;
+    ObjectId mPreviousBindGroup = 0;
+    ObjectId mPreviousBuffer = 0;
+
+    // The last draw, that following identical draws repeat.
+    bool mHasLastDraw = false;
+    PackedCommand mLastDrawCommand = PackedCommand::Draw;
+    DrawArgs mLastDrawArgs = {};
+    uint32_t mPendingRepeatCount = 0;
+};
+
+// A decoded packed command. Only the members of the |command| are set.
+struct PackedCommandRecord {
+    PackedCommand command;
+
+    // SetPipeline, SetBindGroup, SetVertexBuffer and SetIndexBuffer.
+    ObjectId objectId;
+    // The group index of SetBindGroup or the slot of SetVertexBuffer.
+    uint32_t index;
+    uint32_t dynamicOffsetCount;
+    const uint32_t* dynamicOffsets;
+    WGPUIndexFormat format;
+    uint64_t offset;
+    uint64_t size;
+
+    // Draw and DrawIndexed, in the order of the arguments of the API. RepeatDraw is decoded as
+    // the repeated draw with a |drawCount| larger than 1.
+    uint32_t count;
+    uint32_t instanceCount;
+    uint32_t first;
+    int32_t baseVertex;
+    uint32_t firstInstance;
+    uint32_t drawCount;
+};
+
+class PackedCommandDecoder {
+  public:
+    PackedCommandDecoder(const uint8_t* data, size_t size);
+    ~PackedCommandDecoder();
+
+    bool IsEmpty() const;
+
+    // Decodes the next command. The dynamic offsets of the record are valid until the next call.
+    WireResult ReadCommand(PackedCommandRecord* record);
+
+  private:
+    WireResult ReadVarint(uint64_t* value);
+    WireResult ReadUint32(uint32_t* value);
+    WireResult ReadObjectId(ObjectId* previous, ObjectId* id);
+
+    const uint8_t* mData;
+    const uint8_t* mEnd;
+    ObjectId mPreviousPipeline = 0;
+    ObjectId mPreviousBindGroup = 0;
+    ObjectId mPreviousBuffer = 0;
+
+    bool mHasLastDraw = false;
+    PackedCommandRecord mLastDraw = {};
+    std::vector<uint32_t> mDynamicOffsets;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_PACKEDCOMMANDS_H_
@@ -0,0 +1,290 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/SharedMemory.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(WIN32)
+#include "dawn/common/windows_with_undefs.h"
+#elif DAWN_PLATFORM_IS(LINUX_DESKTOP) || DAWN_PLATFORM_IS(CHROMEOS) || DAWN_PLATFORM_IS(APPLE)
+#define DAWN_SHARED_MEMORY_USE_SHM_OPEN 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::wire {
+
+#if DAWN_PLATFORM_IS(WIN32)
+
+struct SharedMemory::PlatformHandle {
+    ~PlatformHandle() {
+        if (mirroredData != nullptr) {
+            UnmapViewOfFile(mirroredData);
+            UnmapViewOfFile(mirroredData + mirroredSize);
+        }
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+    }
+
+    // The views must be adjacent, so another thread may steal the address range in between the
+    // reservation and the mapping. Retry a few times in that case.
+    bool MapMirrored(uint64_t offset, uint64_t size) {
+        DWORD offsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD offsetLow = static_cast<DWORD>(offset & 0xFFFF'FFFF);
+        for (uint32_t attempt = 0; attempt < 8; ++attempt) {
+            char* base =
+                static_cast<char*>(VirtualAlloc(nullptr, 2 * size, MEM_RESERVE, PAGE_NOACCESS));
+            if (base == nullptr) {
+                return false;
+            }
+            VirtualFree(base, 0, MEM_RELEASE);
+
+            // Mapping views past the end of the file mapping fails, which validates its size.
+            void* first =
+                MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, offsetHigh, offsetLow, size, base);
+            void* second = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, offsetHigh, offsetLow,
+                                           size, base + size);
+            if (first == base && second == base + size) {
+                mirroredData = base;
+                mirroredSize = size;
+                return true;
+            }
+            if (first != nullptr) {
+                UnmapViewOfFile(first);
+            }
+            if (second != nullptr) {
+                UnmapViewOfFile(second);
+            }
+        }
+        return false;
+    }
+
+    HANDLE mapping = nullptr;
+    void* data = nullptr;
+    char* mirroredData = nullptr;
+    uint64_t mirroredSize = 0;
+};
+
+#elif defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+
+struct SharedMemory::PlatformHandle {
+    ~PlatformHandle() {
+        if (mirroredData != nullptr) {
+            munmap(mirroredData, 2 * mirroredSize);
+        }
+        if (data != nullptr) {
+            munmap(data, mappedSize);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        if (isOwner) {
+            shm_unlink(name.c_str());
+        }
+    }
+
+    // The address range of both views is reserved first and then replaced with MAP_FIXED, so no
+    // other mapping can be placed in between.
+    bool MapMirrored(uint64_t offset, uint64_t size) {
+        // Accessing the pages past the end of the object would raise SIGBUS.
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0 ||
+            static_cast<uint64_t>(fileStat.st_size) < offset + size) {
+            return false;
+        }
+
+        void* base = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            return false;
+        }
+        mirroredData = static_cast<char*>(base);
+        mirroredSize = size;
+
+        for (uint64_t viewOffset : {uint64_t(0), size}) {
+            void* view = mmap(mirroredData + viewOffset, size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(offset));
+            if (view == MAP_FAILED) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string name;
+    bool isOwner = false;
+    int fd = -1;
+    void* data = nullptr;
+    size_t mappedSize = 0;
+    char* mirroredData = nullptr;
+    uint64_t mirroredSize = 0;
+};
+
+#else
+
+struct SharedMemory::PlatformHandle {};
+
+#endif
+
+// static
+uint64_t SharedMemory::GetAllocationGranularity() {
+#if DAWN_PLATFORM_IS(WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+#elif defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+    return static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 1;
+#endif
+}
+
+// static
+bool SharedMemory::IsSupported() {
+#if DAWN_PLATFORM_IS(WIN32) || defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// static
+std::unique_ptr<SharedMemory> SharedMemory::Create(const std::string& name, size_t size) {
+#if DAWN_PLATFORM_IS(WIN32) || defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+    // Empty mappings aren't allowed, map at least one byte.
+    const size_t mappedSize = std::max(size, size_t(1));
+
+    auto handle = std::make_unique<PlatformHandle>();
+#if DAWN_PLATFORM_IS(WIN32)
+    const uint64_t mappedSize64 = mappedSize;
+    handle->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                         static_cast<DWORD>(mappedSize64 >> 32),
+                                         static_cast<DWORD>(mappedSize64 & 0xFFFF'FFFF),
+                                         name.c_str());
+    if (handle->mapping == nullptr || GetLastError() == ERROR_ALREADY_EXISTS) {
+        return nullptr;
+    }
+    handle->data = MapViewOfFile(handle->mapping, FILE_MAP_ALL_ACCESS, 0, 0, mappedSize);
+    if (handle->data == nullptr) {
+        return nullptr;
+    }
+#else
+    handle->fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (handle->fd < 0) {
+        return nullptr;
+    }
+    handle->name = name;
+    handle->isOwner = true;
+    // The new pages of the object are zero-filled.
+    if (ftruncate(handle->fd, static_cast<off_t>(mappedSize)) != 0) {
+        return nullptr;
+    }
+    void* data = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, handle->fd, 0);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    handle->data = data;
+    handle->mappedSize = mappedSize;
+#endif
+
+    uint8_t* mappedData = static_cast<uint8_t*>(handle->data);
+    return std::unique_ptr<SharedMemory>(new SharedMemory(std::move(handle), mappedData, size));
+#else
+    // Shared memory isn't supported on this platform.
+    return nullptr;
+#endif
+}
+
+// static
+std::unique_ptr<SharedMemory> SharedMemory::Open(const std::string& name, size_t size) {
+#if DAWN_PLATFORM_IS(WIN32) || defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+    const size_t mappedSize = std::max(size, size_t(1));
+
+    auto handle = std::make_unique<PlatformHandle>();
+#if DAWN_PLATFORM_IS(WIN32)
+    handle->mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+    if (handle->mapping == nullptr) {
+        return nullptr;
+    }
+    // Mapping a view past the end of the file mapping fails, which validates its size.
+    handle->data = MapViewOfFile(handle->mapping, FILE_MAP_ALL_ACCESS, 0, 0, mappedSize);
+    if (handle->data == nullptr) {
+        return nullptr;
+    }
+#else
+    handle->fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (handle->fd < 0) {
+        return nullptr;
+    }
+    // Accessing the pages past the end of the object would raise SIGBUS.
+    struct stat fileStat;
+    if (fstat(handle->fd, &fileStat) != 0 || fileStat.st_size < 0 ||
+        static_cast<uint64_t>(fileStat.st_size) < mappedSize) {
+        return nullptr;
+    }
+    void* data = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, handle->fd, 0);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    handle->data = data;
+    handle->mappedSize = mappedSize;
+#endif
+
+    uint8_t* mappedData = static_cast<uint8_t*>(handle->data);
+    return std::unique_ptr<SharedMemory>(new SharedMemory(std::move(handle), mappedData, size));
+#else
+    // Shared memory isn't supported on this platform.
+    return nullptr;
+#endif
+}
+
+SharedMemory::SharedMemory(std::unique_ptr<PlatformHandle> handle, uint8_t* data, size_t size)
+    : mHandle(std::move(handle)), mData(data), mSize(size) {}
+
+SharedMemory::~SharedMemory() = default;
+
+uint8_t* SharedMemory::GetData() const {
+    return mData;
+}
+
+size_t SharedMemory::GetSize() const {
+    return mSize;
+}
+
+uint8_t* SharedMemory::MapMirrored(uint64_t offset, uint64_t size) {
+#if DAWN_PLATFORM_IS(WIN32) || defined(DAWN_SHARED_MEMORY_USE_SHM_OPEN)
+    ASSERT(mHandle->mirroredData == nullptr);
+    ASSERT(size > 0);
+    ASSERT(offset % GetAllocationGranularity() == 0 && size % GetAllocationGranularity() == 0);
+    if (!mHandle->MapMirrored(offset, size)) {
+        return nullptr;
+    }
+    return reinterpret_cast<uint8_t*>(mHandle->mirroredData);
+#else
+    UNREACHABLE();
+    return nullptr;
+#endif
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,84 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_SHAREDMEMORY_H_
+#define SRC_DAWN_WIRE_SHAREDMEMORY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace dawn::wire {
+
+// The create info of the Read/WriteHandles of the shared memory MemoryTransferServices. It is
+// followed by the |nameLength| characters of the name of the shared memory object, without a null
+// terminator.
+struct SharedMemoryHandleCreateInfo {
+    uint64_t size;
+    uint32_t nameLength;
+    uint32_t padding;
+};
+
+constexpr uint32_t kMaxSharedMemoryNameLength = 255;
+
+// The header at the start of the shared memory objects of the Read/WriteHandles, followed by the
+// data of the handle.
+struct SharedMemoryHandleHeader {
+    // Set by the server once it opened the object. The object cannot be opened anymore once the
+    // client closed it, so the client keeps it until then even if its handle is destroyed.
+    std::atomic<uint32_t> openedByServer;
+    uint32_t padding[3];
+};
+static_assert(sizeof(SharedMemoryHandleHeader) == 16);
+
+// A named shared memory object mapped in the address space of the process.
+class SharedMemory {
+  public:
+    // Returns whether named shared memory objects are supported on this platform.
+    static bool IsSupported();
+    // Returns the alignment of the offsets that can be passed to MapMirrored.
+    static uint64_t GetAllocationGranularity();
+
+    // Creates the shared memory object |name| of |size| bytes. Its content is zero-initialized.
+    // Returns nullptr on failure, including when the object already exists.
+    static std::unique_ptr<SharedMemory> Create(const std::string& name, size_t size);
+    // Opens the shared memory object |name| created by another SharedMemory and maps its first
+    // |size| bytes. Returns nullptr on failure, including when the object is smaller than |size|.
+    static std::unique_ptr<SharedMemory> Open(const std::string& name, size_t size);
+    ~SharedMemory();
+
+    uint8_t* GetData() const;
+    size_t GetSize() const;
+
+    // Maps the |size| bytes of the object starting at |offset| twice in a row in the address
+    // space, so that any range of at most |size| bytes starting in the first view is contiguous
+    // in memory. |offset| and |size| must be multiples of GetAllocationGranularity() and this can
+    // only be called once. Returns nullptr on failure, including when the object is smaller than
+    // |offset| + |size|.
+    uint8_t* MapMirrored(uint64_t offset, uint64_t size);
+
+  private:
+    struct PlatformHandle;
+
+    SharedMemory(std::unique_ptr<PlatformHandle> handle, uint8_t* data, size_t size);
+
+    std::unique_ptr<PlatformHandle> mHandle;
+    uint8_t* mData;
+    size_t mSize;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_SHAREDMEMORY_H_
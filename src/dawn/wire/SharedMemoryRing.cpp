@@ -0,0 +1,137 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/SharedMemoryRing.h"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/wire/SharedMemory.h"
+
+namespace dawn::wire {
+
+namespace {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "The ring offsets are shared between processes and must be lock free");
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "The ring flags are shared between processes and must be lock free");
+
+constexpr uint32_t kRingMagic = 0x474E5257;  // "WRNG"
+
+// Limits the address space used by the double mapping of the ring.
+constexpr uint64_t kMaxCapacity = 1ull << 30;
+
+uint64_t GetHeaderSize() {
+    return Align(uint64_t(sizeof(SharedMemoryRingHeader)),
+                 SharedMemory::GetAllocationGranularity());
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Create(const std::string& name,
+                                                           size_t minCapacity) {
+    if (!SharedMemory::IsSupported() || minCapacity > kMaxCapacity) {
+        return nullptr;
+    }
+    const uint64_t granularity = SharedMemory::GetAllocationGranularity();
+    ASSERT(IsPowerOfTwo(granularity));
+    const uint64_t headerSize = GetHeaderSize();
+    const uint64_t capacity = NextPowerOfTwo(std::max(uint64_t(minCapacity), granularity));
+
+    // Only the header is accessed through the regular mapping of the object, the data goes
+    // through the mirrored views.
+    std::unique_ptr<SharedMemory> memory = SharedMemory::Create(name, headerSize + capacity);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    char* data = reinterpret_cast<char*>(memory->MapMirrored(headerSize, capacity));
+    if (data == nullptr) {
+        return nullptr;
+    }
+
+    SharedMemoryRingHeader* header = new (memory->GetData()) SharedMemoryRingHeader();
+    header->capacity = capacity;
+    header->writeOffset.store(0, std::memory_order_relaxed);
+    header->readOffset.store(0, std::memory_order_relaxed);
+    header->producerClosed.store(0, std::memory_order_relaxed);
+    header->consumerClosed.store(0, std::memory_order_relaxed);
+    // Publish the initialized header to the process that opens the ring.
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = kRingMagic;
+
+    return std::unique_ptr<SharedMemoryRing>(
+        new SharedMemoryRing(std::move(memory), header, data, capacity));
+}
+
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Open(const std::string& name) {
+    if (!SharedMemory::IsSupported()) {
+        return nullptr;
+    }
+    const uint64_t granularity = SharedMemory::GetAllocationGranularity();
+    const uint64_t headerSize = GetHeaderSize();
+
+    std::unique_ptr<SharedMemory> memory = SharedMemory::Open(name, headerSize);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    // The other process may be malicious: only read the capacity once and validate it.
+    SharedMemoryRingHeader* header = reinterpret_cast<SharedMemoryRingHeader*>(memory->GetData());
+    const volatile uint32_t* magic = &header->magic;
+    if (*magic != kRingMagic) {
+        return nullptr;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t capacity = *static_cast<const volatile uint64_t*>(&header->capacity);
+    if (capacity < granularity || capacity > kMaxCapacity || !IsPowerOfTwo(capacity)) {
+        return nullptr;
+    }
+
+    // MapMirrored fails if the object is too small for the capacity.
+    char* data = reinterpret_cast<char*>(memory->MapMirrored(headerSize, capacity));
+    if (data == nullptr) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemoryRing>(
+        new SharedMemoryRing(std::move(memory), header, data, capacity));
+}
+
+SharedMemoryRing::SharedMemoryRing(std::unique_ptr<SharedMemory> memory,
+                                   SharedMemoryRingHeader* header,
+                                   char* data,
+                                   uint64_t capacity)
+    : mMemory(std::move(memory)), mHeader(header), mData(data), mCapacity(capacity) {}
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+SharedMemoryRingHeader* SharedMemoryRing::GetHeader() const {
+    return mHeader;
+}
+
+uint64_t SharedMemoryRing::GetCapacity() const {
+    return mCapacity;
+}
+
+char* SharedMemoryRing::GetData(uint64_t offset) const {
+    return mData + (offset & (mCapacity - 1));
+}
+
+}  // namespace dawn::wire
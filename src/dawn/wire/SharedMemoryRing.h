@@ -0,0 +1,79 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
+#define SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace dawn::wire {
+
+class SharedMemory;
+
+// The control block at the start of the shared memory of a SharedMemoryRing. The offsets are
+// monotonically increasing byte counts, the position in the ring is the offset modulo the
+// capacity.
+struct SharedMemoryRingHeader {
+    uint32_t magic;
+    uint32_t padding;
+    uint64_t capacity;
+
+    // Written by the producer only: the end of the commands that were flushed.
+    alignas(64) std::atomic<uint64_t> writeOffset;
+    // Written by the consumer only: the end of the commands that were handled.
+    alignas(64) std::atomic<uint64_t> readOffset;
+
+    alignas(64) std::atomic<uint32_t> producerClosed;
+    std::atomic<uint32_t> consumerClosed;
+};
+
+// A named shared memory object that contains a SharedMemoryRingHeader and the data of the ring.
+// The data is mapped twice in a row in the address space so that any range of at most |capacity|
+// bytes starting in the ring is contiguous in memory, even when it wraps around the end of the
+// ring.
+class SharedMemoryRing {
+  public:
+    // Creates the shared memory object |name| with a capacity of at least |minCapacity| bytes.
+    // Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryRing> Create(const std::string& name, size_t minCapacity);
+    // Opens the shared memory object |name| created by another SharedMemoryRing. Returns nullptr
+    // on failure, including when the header of the ring is invalid.
+    static std::unique_ptr<SharedMemoryRing> Open(const std::string& name);
+    ~SharedMemoryRing();
+
+    SharedMemoryRingHeader* GetHeader() const;
+    uint64_t GetCapacity() const;
+
+    // Returns the position of |offset| in the ring. At least |capacity| bytes are addressable
+    // from the returned pointer.
+    char* GetData(uint64_t offset) const;
+
+  private:
+    SharedMemoryRing(std::unique_ptr<SharedMemory> memory,
+                     SharedMemoryRingHeader* header,
+                     char* data,
+                     uint64_t capacity);
+
+    std::unique_ptr<SharedMemory> mMemory;
+    SharedMemoryRingHeader* mHeader;
+    char* mData;
+    uint64_t mCapacity;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_SHAREDMEMORYRING_H_
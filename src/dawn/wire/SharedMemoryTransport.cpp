@@ -0,0 +1,224 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/SharedMemoryTransport.h"
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/SharedMemoryRing.h"
+
+namespace dawn::wire {
+
+namespace {
+
+// Waits for the other side of the ring to make progress. Yields at first to keep the latency
+// low when both sides are busy, then sleeps to avoid burning a core when the other side is idle.
+void WaitForOtherSide(uint32_t* spinCount) {
+    constexpr uint32_t kYieldCount = 64;
+    if (*spinCount < kYieldCount) {
+        (*spinCount)++;
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+}  // anonymous namespace
+
+// SharedMemoryCommandSerializer
+
+// static
+std::unique_ptr<SharedMemoryCommandSerializer> SharedMemoryCommandSerializer::Create(
+    const char* name,
+    size_t minCapacity) {
+    std::unique_ptr<SharedMemoryRing> ring = SharedMemoryRing::Create(name, minCapacity);
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryCommandSerializer>(
+        new SharedMemoryCommandSerializer(std::move(ring)));
+}
+
+// static
+std::unique_ptr<SharedMemoryCommandSerializer> SharedMemoryCommandSerializer::Open(
+    const char* name) {
+    std::unique_ptr<SharedMemoryRing> ring = SharedMemoryRing::Open(name);
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryCommandSerializer>(
+        new SharedMemoryCommandSerializer(std::move(ring)));
+}
+
+SharedMemoryCommandSerializer::SharedMemoryCommandSerializer(std::unique_ptr<SharedMemoryRing> ring)
+    : mRing(std::move(ring)) {
+    // The ring may have been used by a previous serializer.
+    mReservedOffset = mRing->GetHeader()->writeOffset.load(std::memory_order_relaxed);
+    mCachedReadOffset = mRing->GetHeader()->readOffset.load(std::memory_order_acquire);
+}
+
+SharedMemoryCommandSerializer::~SharedMemoryCommandSerializer() {
+    Close();
+}
+
+size_t SharedMemoryCommandSerializer::GetMaximumAllocationSize() const {
+    return static_cast<size_t>(mRing->GetCapacity());
+}
+
+void* SharedMemoryCommandSerializer::GetCmdSpace(size_t size) {
+    const uint64_t capacity = mRing->GetCapacity();
+    if (mClosed) {
+        return nullptr;
+    }
+    if (size > capacity) {
+        // The command would never fit in the ring, so waiting for space would never end.
+        Close();
+        return nullptr;
+    }
+
+    if (mReservedOffset + size - mCachedReadOffset > capacity) {
+        // The ring looks full. Make the pending commands visible so that the receiver frees up
+        // space, and wait for it.
+        Flush();
+
+        SharedMemoryRingHeader* header = mRing->GetHeader();
+        uint32_t spinCount = 0;
+        while (true) {
+            mCachedReadOffset = header->readOffset.load(std::memory_order_acquire);
+            if (mCachedReadOffset > mReservedOffset) {
+                // The receiver corrupted the ring.
+                return nullptr;
+            }
+            if (mReservedOffset + size - mCachedReadOffset <= capacity) {
+                break;
+            }
+            if (header->consumerClosed.load(std::memory_order_acquire) != 0) {
+                return nullptr;
+            }
+            WaitForOtherSide(&spinCount);
+        }
+    }
+
+    char* result = mRing->GetData(mReservedOffset);
+    mReservedOffset += size;
+    return result;
+}
+
+bool SharedMemoryCommandSerializer::Flush() {
+    SharedMemoryRingHeader* header = mRing->GetHeader();
+    header->writeOffset.store(mReservedOffset, std::memory_order_release);
+    return header->consumerClosed.load(std::memory_order_acquire) == 0;
+}
+
+void SharedMemoryCommandSerializer::Close() {
+    if (mClosed) {
+        return;
+    }
+    Flush();
+    mRing->GetHeader()->producerClosed.store(1, std::memory_order_release);
+    mClosed = true;
+}
+
+// SharedMemoryCommandReceiver
+
+// static
+std::unique_ptr<SharedMemoryCommandReceiver> SharedMemoryCommandReceiver::Create(
+    const char* name,
+    size_t minCapacity) {
+    std::unique_ptr<SharedMemoryRing> ring = SharedMemoryRing::Create(name, minCapacity);
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryCommandReceiver>(
+        new SharedMemoryCommandReceiver(std::move(ring)));
+}
+
+// static
+std::unique_ptr<SharedMemoryCommandReceiver> SharedMemoryCommandReceiver::Open(const char* name) {
+    std::unique_ptr<SharedMemoryRing> ring = SharedMemoryRing::Open(name);
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryCommandReceiver>(
+        new SharedMemoryCommandReceiver(std::move(ring)));
+}
+
+SharedMemoryCommandReceiver::SharedMemoryCommandReceiver(std::unique_ptr<SharedMemoryRing> ring)
+    : mRing(std::move(ring)) {
+    mReadOffset = mRing->GetHeader()->readOffset.load(std::memory_order_relaxed);
+}
+
+SharedMemoryCommandReceiver::~SharedMemoryCommandReceiver() {
+    Close();
+}
+
+bool SharedMemoryCommandReceiver::HandleCommands(CommandHandler* handler) {
+    if (mClosed) {
+        return false;
+    }
+
+    SharedMemoryRingHeader* header = mRing->GetHeader();
+    uint64_t writeOffset = header->writeOffset.load(std::memory_order_acquire);
+    if (writeOffset < mReadOffset || writeOffset - mReadOffset > mRing->GetCapacity()) {
+        // The serializer corrupted the ring.
+        return false;
+    }
+    if (writeOffset == mReadOffset) {
+        return true;
+    }
+
+    // The double mapping of the ring makes the commands contiguous even if they wrap around.
+    const volatile char* commands = mRing->GetData(mReadOffset);
+    if (handler->HandleCommands(commands, static_cast<size_t>(writeOffset - mReadOffset)) ==
+        nullptr) {
+        return false;
+    }
+
+    mReadOffset = writeOffset;
+    header->readOffset.store(mReadOffset, std::memory_order_release);
+    return true;
+}
+
+bool SharedMemoryCommandReceiver::WaitForCommands() {
+    SharedMemoryRingHeader* header = mRing->GetHeader();
+    uint32_t spinCount = 0;
+    while (!mClosed) {
+        bool producerClosed = header->producerClosed.load(std::memory_order_acquire) != 0;
+        if (header->writeOffset.load(std::memory_order_acquire) != mReadOffset) {
+            return true;
+        }
+        if (producerClosed) {
+            return false;
+        }
+        WaitForOtherSide(&spinCount);
+    }
+    return false;
+}
+
+uint64_t SharedMemoryCommandReceiver::GetHandledSize() const {
+    return mReadOffset;
+}
+
+void SharedMemoryCommandReceiver::Close() {
+    if (mClosed) {
+        return;
+    }
+    mRing->GetHeader()->consumerClosed.store(1, std::memory_order_release);
+    mClosed = true;
+}
+
+}  // namespace dawn::wire
@@ -18,7 +18,9 @@
 namespace dawn::wire {
 
 WireClient::WireClient(const WireClientDescriptor& descriptor)
-    : mImpl(new client::Client(descriptor.serializer, descriptor.memoryTransferService)) {}
+    : mImpl(new client::Client(descriptor.serializer,
+                               descriptor.memoryTransferService,
+                               descriptor.useCompactEncoding)) {}
 
 WireClient::~WireClient() {
     mImpl.reset();
@@ -45,6 +47,14 @@ ReservedInstance WireClient::ReserveInstance() {
     return mImpl->ReserveInstance();
 }
 
+bool WireClient::EnableBufferReadAhead(WGPUBuffer buffer, size_t offset, size_t size) {
+    return mImpl->EnableBufferReadAhead(buffer, offset, size);
+}
+
+std::vector<LiveObjectCount> WireClient::GetLiveObjectCounts() const {
+    return mImpl->GetLiveObjectCounts();
+}
+
 void WireClient::ReclaimTextureReservation(const ReservedTexture& reservation) {
     mImpl->ReclaimTextureReservation(reservation);
 }
@@ -20,7 +20,8 @@ namespace dawn::wire {
 WireServer::WireServer(const WireServerDescriptor& descriptor)
     : mImpl(new server::Server(*descriptor.procs,
                                descriptor.serializer,
-                               descriptor.memoryTransferService)) {}
+                               descriptor.memoryTransferService,
+                               descriptor.acceptCompactEncoding)) {}
 
 WireServer::~WireServer() {
     mImpl.reset();
@@ -199,6 +199,29 @@ void Buffer::MapAsync(WGPUMapModeFlags mode,
         size = mSize - offset;
     }
 
+    if (mReadAhead.hasData && mReadAhead.submitSerial == client->GetQueueSubmitSerial() &&
+        mode == WGPUMapMode_Read && mMapState == MapState::Unmapped && offset % 8 == 0 &&
+        size % 4 == 0 && offset >= mReadAhead.offset && size <= mReadAhead.size &&
+        offset - mReadAhead.offset <= mReadAhead.size - size) {
+        // The server pushed the content of the range after the last QueueSubmit and kept the
+        // buffer mapped for us, so the mapping completes right away.
+        mReadAhead.hasData = false;
+
+        BufferMapReadAheadCmd cmd;
+        cmd.bufferId = GetWireId();
+        cmd.submitSerial = mReadAhead.submitSerial;
+        client->SerializeCommand(cmd);
+
+        mMapState = MapState::MappedForRead;
+        mMappedData = const_cast<void*>(mReadHandle->GetData());
+        mMapOffset = offset;
+        mMapSize = size;
+        return callback(WGPUBufferMapAsyncStatus_Success, userdata);
+    }
+
+    // The server stops using the read-ahead mapping when it gets a map request.
+    DiscardReadAhead();
+
     // Set up the request structure that will hold information while this mapping is
     // in flight.
     mRequest.callback = callback;
@@ -290,6 +313,70 @@ bool Buffer::OnMapAsyncCallback(uint64_t requestSerial,
     return true;
 }
 
+bool Buffer::OnReadAheadUpdate(uint64_t submitSerial,
+                               uint64_t readDataUpdateInfoLength,
+                               const uint8_t* readDataUpdateInfo) {
+    // Ignore the content if it is out of date, or if the buffer is in use. The server unmaps it
+    // before the next QueueSubmit.
+    if (!mReadAhead.enabled || mReadHandle == nullptr || mPendingMap ||
+        mMapState != MapState::Unmapped || submitSerial != GetClient()->GetQueueSubmitSerial() ||
+        submitSerial == mReadAhead.discardSubmitSerial) {
+        return true;
+    }
+
+    if (readDataUpdateInfoLength > std::numeric_limits<size_t>::max()) {
+        // This is the size of data deserialized from the command stream, which must be
+        // CPU-addressable.
+        return false;
+    }
+    if (!mReadHandle->DeserializeDataUpdate(readDataUpdateInfo,
+                                            static_cast<size_t>(readDataUpdateInfoLength),
+                                            mReadAhead.offset, mReadAhead.size)) {
+        return false;
+    }
+
+    mReadAhead.hasData = true;
+    mReadAhead.submitSerial = submitSerial;
+    return true;
+}
+
+bool Buffer::EnableReadAhead(size_t offset, size_t size) {
+    Client* client = GetClient();
+    if (client->IsDisconnected()) {
+        return false;
+    }
+
+    // Only buffers with the MapRead usage have a ReadHandle. It is also freed on Destroy.
+    if (mReadHandle == nullptr || mPendingMap || mMapState != MapState::Unmapped) {
+        return false;
+    }
+
+    if ((size == WGPU_WHOLE_MAP_SIZE) && (offset <= mSize)) {
+        size = mSize - offset;
+    }
+    // The server maps the range after each QueueSubmit so it must be valid for MapAsync.
+    if (offset % 8 != 0 || size % 4 != 0 || offset > mSize || size > mSize - offset) {
+        return false;
+    }
+
+    DiscardReadAhead();
+    mReadAhead.enabled = true;
+    mReadAhead.offset = offset;
+    mReadAhead.size = size;
+
+    BufferEnableReadAheadCmd cmd;
+    cmd.bufferId = GetWireId();
+    cmd.offset = offset;
+    cmd.size = size;
+    client->SerializeCommand(cmd);
+    return true;
+}
+
+void Buffer::DiscardReadAhead() {
+    mReadAhead.hasData = false;
+    mReadAhead.discardSubmitSerial = GetClient()->GetQueueSubmitSerial();
+}
+
 void* Buffer::GetMappedRange(size_t offset, size_t size) {
     if (!IsMappedForWriting() || !CheckGetMappedRangeOffsetSize(offset, size)) {
         return nullptr;
@@ -342,8 +429,9 @@ void Buffer::Unmap() {
                                   }});
 
         // If mDestructWriteHandleOnUnmap is true, that means the write handle is merely
-        // for mappedAtCreation usage. It is destroyed on unmap after flush to server
-        // instead of at buffer destruction.
+        // for mappedAtCreation usage. It is destroyed on unmap after the data update is
+        // serialized instead of at buffer destruction. The commands may not have reached the
+        // server yet, so the MemoryTransferService must keep what the server still needs.
         if (mMapState == MapState::MappedAtCreation && mDestructWriteHandleOnUnmap) {
             mWriteHandle = nullptr;
             if (mReadHandle) {
@@ -360,6 +448,9 @@ void Buffer::Unmap() {
     mMapOffset = 0;
     mMapSize = 0;
 
+    // Unmap also unmaps the read-ahead mapping on the server.
+    DiscardReadAhead();
+
     BufferUnmapCmd cmd;
     cmd.self = ToAPI(this);
     client->SerializeCommand(cmd);
@@ -373,6 +464,7 @@ void Buffer::Destroy() {
     // Remove the current mapping and destroy Read/WriteHandles.
     FreeMappedData();
     mMapState = MapState::Unmapped;
+    mReadAhead = {};
 
     BufferDestroyCmd cmd;
     cmd.self = ToAPI(this);
@@ -42,6 +42,14 @@ class Buffer final : public ObjectBase {
                   size_t size,
                   WGPUBufferMapCallback callback,
                   void* userdata);
+    bool OnReadAheadUpdate(uint64_t submitSerial,
+                           uint64_t readDataUpdateInfoLength,
+                           const uint8_t* readDataUpdateInfo);
+    // See WireClient::EnableBufferReadAhead.
+    bool EnableReadAhead(size_t offset, size_t size);
+    // Discards the content pushed for the last QueueSubmit because it is out of date, or because
+    // the server doesn't keep it mapped anymore.
+    void DiscardReadAhead();
     void* GetMappedRange(size_t offset, size_t size);
     const void* GetConstMappedRange(size_t offset, size_t size);
     void Unmap();
@@ -99,6 +107,22 @@ class Buffer final : public ObjectBase {
     size_t mMapOffset = 0;
     size_t mMapSize = 0;
 
+    // The content of the read-ahead range is pushed by the server after each QueueSubmit so that
+    // a MapAsync for reading of that range completes without waiting on the server.
+    struct ReadAheadData {
+        bool enabled = false;
+        size_t offset = 0;
+        size_t size = 0;
+        // Whether the ReadHandle contains the content of the range after the QueueSubmit
+        // |submitSerial|.
+        bool hasData = false;
+        uint64_t submitSerial = 0;
+        // Content pushed for this QueueSubmit is discarded. It is out of date, or the server
+        // unmapped it.
+        uint64_t discardSubmitSerial = 0;
+    };
+    ReadAheadData mReadAhead;
+
     std::weak_ptr<bool> mDeviceIsAlive;
 };
 
@@ -14,13 +14,19 @@
 
 #include "dawn/wire/client/Client.h"
 
+#include <vector>
+
 #include "dawn/common/Compiler.h"
 #include "dawn/wire/client/Device.h"
+#include "dawn/wire/client/RenderPassEncoder.h"
 
 namespace dawn::wire::client {
 
 namespace {
 
+// The size after which packed commands are sent, to bound the memory they use.
+constexpr size_t kMaxPackedCommandsSize = 16 * 1024;
+
 class NoopCommandSerializer final : public CommandSerializer {
   public:
     static NoopCommandSerializer* GetInstance() {
@@ -37,8 +43,13 @@ class NoopCommandSerializer final : public CommandSerializer {
 
 }  // anonymous namespace
 
-Client::Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService)
-    : ClientBase(), mSerializer(serializer), mMemoryTransferService(memoryTransferService) {
+Client::Client(CommandSerializer* serializer,
+               MemoryTransferService* memoryTransferService,
+               bool useCompactEncoding)
+    : ClientBase(),
+      mSerializer(serializer),
+      mMemoryTransferService(memoryTransferService),
+      mUseCompactEncoding(useCompactEncoding) {
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fall back to inline memory.
         mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
@@ -125,6 +136,19 @@ ReservedInstance Client::ReserveInstance() {
     return result;
 }
 
+bool Client::EnableBufferReadAhead(WGPUBuffer buffer, size_t offset, size_t size) {
+    return FromAPI(buffer)->EnableReadAhead(offset, size);
+}
+
+std::vector<LiveObjectCount> Client::GetLiveObjectCounts() const {
+    std::vector<LiveObjectCount> counts;
+    for (const ObjectStore& store : mObjectStores) {
+        ObjectType objectType = static_cast<ObjectType>(&store - mObjectStores.data());
+        counts.push_back({ObjectTypeAsString(objectType), store.GetLiveObjectCount()});
+    }
+    return counts;
+}
+
 void Client::ReclaimTextureReservation(const ReservedTexture& reservation) {
     Free(FromAPI(reservation.texture));
 }
@@ -141,9 +165,40 @@ void Client::ReclaimInstanceReservation(const ReservedInstance& reservation) {
     Free(FromAPI(reservation.instance));
 }
 
+PackedCommandEncoder* Client::GetPackedCommandEncoder(const RenderPassEncoder* renderPassEncoder) {
+    if (!mUseCompactEncoding) {
+        return nullptr;
+    }
+
+    // A packed command only contains the commands of a single render pass encoder.
+    if (renderPassEncoder->GetWireId() != mPackedCommandsTarget ||
+        mPackedCommands.GetSize() >= kMaxPackedCommandsSize) {
+        SerializePackedCommands();
+        mPackedCommandsTarget = renderPassEncoder->GetWireId();
+    }
+    return &mPackedCommands;
+}
+
+void Client::SerializePackedCommands() {
+    if (mPackedCommands.IsEmpty()) {
+        return;
+    }
+
+    const std::vector<uint8_t>& data = mPackedCommands.Finish();
+
+    RenderPassEncoderPackedCommandsCmd cmd;
+    cmd.renderPassEncoderId = mPackedCommandsTarget;
+    cmd.data = data.data();
+    cmd.dataSize = data.size();
+    mSerializer.SerializeCommand(cmd, *this);
+
+    mPackedCommands.Reset();
+}
+
 void Client::Disconnect() {
     mDisconnected = true;
     mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
+    mPackedCommands.Reset();
 
     auto& deviceList = mObjects[ObjectType::Device];
     {
@@ -17,11 +17,14 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/common/LinkedList.h"
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Numeric.h"
 #include "dawn/webgpu.h"
 #include "dawn/wire/ChunkedCommandSerializer.h"
+#include "dawn/wire/PackedCommands.h"
 #include "dawn/wire/Wire.h"
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/WireCmd_autogen.h"
@@ -33,10 +36,13 @@ namespace dawn::wire::client {
 
 class Device;
 class MemoryTransferService;
+class RenderPassEncoder;
 
 class Client : public ClientBase {
   public:
-    Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService);
+    Client(CommandSerializer* serializer,
+           MemoryTransferService* memoryTransferService,
+           bool useCompactEncoding);
     ~Client() override;
 
     // Make<T>(arg1, arg2, arg3) creates a new T, calling a constructor of the form:
@@ -47,10 +53,11 @@ class Client : public ClientBase {
         constexpr ObjectType type = ObjectTypeToTypeEnum<T>;
 
         ObjectBaseParams params = {this, mObjectStores[type].ReserveHandle()};
-        T* object = new T(params, std::forward<Args>(args)...);
+        void* memory = mObjectStores[type].AllocateObjectMemory(u32_sizeof<T>, u32_alignof<T>);
+        T* object = new (memory) T(params, std::forward<Args>(args)...);
 
         mObjects[type].Append(object);
-        mObjectStores[type].Insert(std::unique_ptr<T>(object));
+        mObjectStores[type].Insert(object);
         return object;
     }
 
@@ -75,6 +82,10 @@ class Client : public ClientBase {
     ReservedDevice ReserveDevice();
     ReservedInstance ReserveInstance();
 
+    bool EnableBufferReadAhead(WGPUBuffer buffer, size_t offset, size_t size);
+
+    std::vector<LiveObjectCount> GetLiveObjectCounts() const;
+
     void ReclaimTextureReservation(const ReservedTexture& reservation);
     void ReclaimSwapChainReservation(const ReservedSwapChain& reservation);
     void ReclaimDeviceReservation(const ReservedDevice& reservation);
@@ -82,19 +93,35 @@ class Client : public ClientBase {
 
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
+        SerializePackedCommands();
         mSerializer.SerializeCommand(cmd, *this);
     }
 
     template <typename Cmd, typename... Extensions>
     void SerializeCommand(const Cmd& cmd, Extensions&&... es) {
+        SerializePackedCommands();
         mSerializer.SerializeCommand(cmd, *this, std::forward<Extensions>(es)...);
     }
 
+    // Returns the packed commands that the commands of |renderPassEncoder| are appended to, or
+    // nullptr if the compact encoding isn't used. The packed commands are only sent with the next
+    // command that isn't packed, like RenderPassEncoderEnd, which is fine since the commands of a
+    // render pass don't have any effect until then.
+    PackedCommandEncoder* GetPackedCommandEncoder(const RenderPassEncoder* renderPassEncoder);
+
+    // The number of QueueSubmit commands sent. The server counts the ones it handles the same way
+    // so that both sides agree on which buffer read-ahead content is up to date.
+    uint64_t GetQueueSubmitSerial() const { return mQueueSubmitSerial; }
+    void IncrementQueueSubmitSerial() { mQueueSubmitSerial++; }
+
     void Disconnect();
     bool IsDisconnected() const;
 
   private:
     void DestroyAllObjects();
+    // Sends the pending packed commands, if any. This is done before serializing any other command
+    // so that the order of the commands is preserved.
+    void SerializePackedCommands();
 
 #include "dawn/wire/client/ClientPrototypes_autogen.inc"
 
@@ -105,6 +132,12 @@ class Client : public ClientBase {
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     PerObjectType<LinkedList<ObjectBase>> mObjects;
     bool mDisconnected = false;
+
+    const bool mUseCompactEncoding;
+    PackedCommandEncoder mPackedCommands;
+    ObjectId mPackedCommandsTarget = 0;
+
+    uint64_t mQueueSubmitSerial = 0;
 };
 
 std::unique_ptr<MemoryTransferService> CreateInlineMemoryTransferService();
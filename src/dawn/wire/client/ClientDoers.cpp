@@ -87,6 +87,17 @@ bool Client::DoBufferMapAsyncCallback(Buffer* buffer,
                                       readDataUpdateInfo);
 }
 
+bool Client::DoBufferReadAheadUpdate(Buffer* buffer,
+                                     uint64_t submitSerial,
+                                     uint64_t readDataUpdateInfoLength,
+                                     const uint8_t* readDataUpdateInfo) {
+    // The buffer might have been deleted or recreated so this isn't an error.
+    if (buffer == nullptr) {
+        return true;
+    }
+    return buffer->OnReadAheadUpdate(submitSerial, readDataUpdateInfoLength, readDataUpdateInfo);
+}
+
 bool Client::DoQueueWorkDoneCallback(Queue* queue,
                                      uint64_t requestSerial,
                                      WGPUQueueWorkDoneStatus status) {
@@ -0,0 +1,210 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
+
+namespace dawn::wire::client {
+
+namespace {
+
+size_t SerializeCreateInfoSize(const std::string& name) {
+    return sizeof(SharedMemoryHandleCreateInfo) + name.size();
+}
+
+void SerializeCreateInfo(const std::string& name, size_t size, void* serializePointer) {
+    SharedMemoryHandleCreateInfo info = {};
+    info.size = size;
+    info.nameLength = static_cast<uint32_t>(name.size());
+    char* pointer = static_cast<char*>(serializePointer);
+    memcpy(pointer, &info, sizeof(info));
+    memcpy(pointer + sizeof(info), name.data(), name.size());
+}
+
+// The data of the handles follows a SharedMemoryHandleHeader.
+uint8_t* GetHandleData(const SharedMemory& memory) {
+    return memory.GetData() + sizeof(SharedMemoryHandleHeader);
+}
+
+size_t GetHandleDataSize(const SharedMemory& memory) {
+    return memory.GetSize() - sizeof(SharedMemoryHandleHeader);
+}
+
+bool IsOpenedByServer(const SharedMemory& memory) {
+    const auto* header = reinterpret_cast<const SharedMemoryHandleHeader*>(memory.GetData());
+    return header->openedByServer.load(std::memory_order_acquire) != 0;
+}
+
+// The shared memory objects of the destroyed handles that the server hasn't opened yet. A handle
+// can be destroyed right after the command that creates it on the server is serialized, for
+// example when a buffer mapped at creation is unmapped, and before the server processed that
+// command.
+class PendingMemoryReleases {
+  public:
+    void Release(std::unique_ptr<SharedMemory> memory) {
+        ReleaseOpenedMemory();
+        if (!IsOpenedByServer(*memory)) {
+            mMemories.push_back(std::move(memory));
+        }
+    }
+
+    void ReleaseOpenedMemory() {
+        mMemories.erase(std::remove_if(mMemories.begin(), mMemories.end(),
+                                       [](const std::unique_ptr<SharedMemory>& memory) {
+                                           return IsOpenedByServer(*memory);
+                                       }),
+                        mMemories.end());
+    }
+
+  private:
+    std::vector<std::unique_ptr<SharedMemory>> mMemories;
+};
+
+}  // anonymous namespace
+
+class SharedMemoryTransferService : public MemoryTransferService {
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        ReadHandleImpl(std::string name,
+                       std::unique_ptr<SharedMemory> memory,
+                       std::shared_ptr<PendingMemoryReleases> pendingReleases)
+            : mName(std::move(name)),
+              mMemory(std::move(memory)),
+              mPendingReleases(std::move(pendingReleases)) {}
+
+        ~ReadHandleImpl() override { mPendingReleases->Release(std::move(mMemory)); }
+
+        size_t SerializeCreateSize() override { return SerializeCreateInfoSize(mName); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SerializeCreateInfo(mName, GetHandleDataSize(*mMemory), serializePointer);
+        }
+
+        const void* GetData() override { return GetHandleData(*mMemory); }
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The server already copied the data in the shared memory.
+            if (deserializeSize != 0) {
+                return false;
+            }
+            size_t dataSize = GetHandleDataSize(*mMemory);
+            return offset <= dataSize && size <= dataSize - offset;
+        }
+
+      private:
+        std::string mName;
+        std::unique_ptr<SharedMemory> mMemory;
+        std::shared_ptr<PendingMemoryReleases> mPendingReleases;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        WriteHandleImpl(std::string name,
+                        std::unique_ptr<SharedMemory> memory,
+                        std::shared_ptr<PendingMemoryReleases> pendingReleases)
+            : mName(std::move(name)),
+              mMemory(std::move(memory)),
+              mPendingReleases(std::move(pendingReleases)) {}
+
+        ~WriteHandleImpl() override { mPendingReleases->Release(std::move(mMemory)); }
+
+        size_t SerializeCreateSize() override { return SerializeCreateInfoSize(mName); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SerializeCreateInfo(mName, GetHandleDataSize(*mMemory), serializePointer);
+        }
+
+        void* GetData() override { return GetHandleData(*mMemory); }
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+            ASSERT(offset <= GetHandleDataSize(*mMemory));
+            ASSERT(size <= GetHandleDataSize(*mMemory) - offset);
+            // The server reads the data from the shared memory.
+            return 0;
+        }
+
+        void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {
+            ASSERT(offset <= GetHandleDataSize(*mMemory));
+            ASSERT(size <= GetHandleDataSize(*mMemory) - offset);
+        }
+
+      private:
+        std::string mName;
+        std::unique_ptr<SharedMemory> mMemory;
+        std::shared_ptr<PendingMemoryReleases> mPendingReleases;
+    };
+
+  public:
+    explicit SharedMemoryTransferService(std::string namePrefix)
+        : mNamePrefix(std::move(namePrefix)),
+          mPendingReleases(std::make_shared<PendingMemoryReleases>()) {}
+    ~SharedMemoryTransferService() override = default;
+
+    ReadHandle* CreateReadHandle(size_t size) override {
+        std::string name;
+        std::unique_ptr<SharedMemory> memory = CreateSharedMemory(size, &name);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        return new ReadHandleImpl(std::move(name), std::move(memory), mPendingReleases);
+    }
+
+    WriteHandle* CreateWriteHandle(size_t size) override {
+        std::string name;
+        // Shared memory objects are zero-initialized, as required for the data of WriteHandles.
+        std::unique_ptr<SharedMemory> memory = CreateSharedMemory(size, &name);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        return new WriteHandleImpl(std::move(name), std::move(memory), mPendingReleases);
+    }
+
+  private:
+    std::unique_ptr<SharedMemory> CreateSharedMemory(size_t size, std::string* name) {
+        mPendingReleases->ReleaseOpenedMemory();
+        if (size > std::numeric_limits<size_t>::max() - sizeof(SharedMemoryHandleHeader)) {
+            return nullptr;
+        }
+        *name = mNamePrefix + "-" + std::to_string(mNextNameIndex++);
+        return SharedMemory::Create(*name, sizeof(SharedMemoryHandleHeader) + size);
+    }
+
+    std::string mNamePrefix;
+    uint64_t mNextNameIndex = 0;
+    // Shared with the handles, which may outlive the service.
+    std::shared_ptr<PendingMemoryReleases> mPendingReleases;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(const char* namePrefix) {
+    std::string prefix = namePrefix;
+    // Leave room for the index in the names.
+    if (!SharedMemory::IsSupported() || prefix.size() > kMaxSharedMemoryNameLength - 21) {
+        return nullptr;
+    }
+    return std::make_unique<SharedMemoryTransferService>(std::move(prefix));
+}
+
+}  // namespace dawn::wire::client
@@ -18,6 +18,7 @@
 #include "dawn/webgpu.h"
 
 #include "dawn/common/LinkedList.h"
+#include "dawn/common/PlacementAllocated.h"
 #include "dawn/wire/ObjectHandle.h"
 
 namespace dawn::wire::client {
@@ -34,7 +35,8 @@ struct ObjectBaseParams {
 //  - The external reference count, starting at 1.
 //  - An ID that is used to refer to this object when talking with the server side
 //  - A next/prev pointer. They are part of a linked list of objects of the same type.
-class ObjectBase : public LinkNode<ObjectBase> {
+// They are placement-allocated by Client::Make in the ObjectStore of their type.
+class ObjectBase : public LinkNode<ObjectBase>, public PlacementAllocated {
   public:
     explicit ObjectBase(const ObjectBaseParams& params);
     virtual ~ObjectBase();
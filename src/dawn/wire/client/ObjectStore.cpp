@@ -14,17 +14,36 @@
 
 #include "dawn/wire/client/ObjectStore.h"
 
+#include <algorithm>
 #include <limits>
-#include <utility>
+#include <memory>
 
 namespace dawn::wire::client {
 
+namespace {
+
+// The size of the memory allocated for the objects of each slab, like for the bind groups of
+// dawn::native.
+constexpr uint32_t kSlabObjectBytes = 4096;
+
+}  // anonymous namespace
+
+ObjectStore::ObjectAllocator::ObjectAllocator(Index blocksPerSlab,
+                                              uint32_t objectSize,
+                                              uint32_t objectAlignment)
+    : SlabAllocatorImpl(blocksPerSlab, objectSize, objectAlignment) {}
+
 ObjectStore::ObjectStore() {
     // ID 0 is nullptr
     mObjects.emplace_back(nullptr);
     mCurrentId = 1;
 }
 
+ObjectStore::~ObjectStore() {
+    // The objects must be freed before their slabs are.
+    ASSERT(mLiveObjectCount == 0);
+}
+
 ObjectHandle ObjectStore::ReserveHandle() {
     if (mFreeHandles.empty()) {
         return {mCurrentId++, 0};
@@ -34,19 +53,32 @@ ObjectHandle ObjectStore::ReserveHandle() {
     return handle;
 }
 
-void ObjectStore::Insert(std::unique_ptr<ObjectBase> obj) {
+void* ObjectStore::AllocateObjectMemory(uint32_t objectSize, uint32_t objectAlignment) {
+    if (DAWN_UNLIKELY(mAllocator == nullptr)) {
+        mObjectSize = objectSize;
+        mObjectAlignment = objectAlignment;
+        mAllocator = std::make_unique<ObjectAllocator>(
+            static_cast<SlabAllocatorImpl::Index>(std::max(kSlabObjectBytes / objectSize, 1u)),
+            objectSize, objectAlignment);
+    }
+    ASSERT(objectSize == mObjectSize && objectAlignment == mObjectAlignment);
+    return mAllocator->Allocate();
+}
+
+void ObjectStore::Insert(ObjectBase* obj) {
     ObjectId id = obj->GetWireId();
 
     if (id >= mObjects.size()) {
         ASSERT(id == mObjects.size());
-        mObjects.emplace_back(std::move(obj));
+        mObjects.push_back(obj);
     } else {
         // The generation should never overflow. We don't recycle ObjectIds that would
         // overflow their next generation.
         ASSERT(obj->GetWireGeneration() != 0);
         ASSERT(mObjects[id] == nullptr);
-        mObjects[id] = std::move(obj);
+        mObjects[id] = obj;
     }
+    mLiveObjectCount++;
 }
 
 void ObjectStore::Free(ObjectBase* obj) {
@@ -60,13 +92,22 @@ void ObjectStore::Free(ObjectBase* obj) {
         mFreeHandles.push_back({currentHandle.id, currentHandle.generation + 1});
     }
     mObjects[currentHandle.id] = nullptr;
+
+    ASSERT(mLiveObjectCount > 0);
+    mLiveObjectCount--;
+    obj->~ObjectBase();
+    mAllocator->Deallocate(obj);
 }
 
 ObjectBase* ObjectStore::Get(ObjectId id) const {
     if (id >= mObjects.size()) {
         return nullptr;
     }
-    return mObjects[id].get();
+    return mObjects[id];
+}
+
+size_t ObjectStore::GetLiveObjectCount() const {
+    return mLiveObjectCount;
 }
 
 }  // namespace dawn::wire::client
@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 
+#include "dawn/common/SlabAllocator.h"
 #include "dawn/wire/client/ObjectBase.h"
 
 namespace dawn::wire::client {
@@ -26,7 +27,9 @@ class Client;
 
 // A helper class used in Client, ObjectStore owns the association of some ObjectBase and
 // ObjectHandles. The lifetime of the ObjectBase is then owned by the ObjectStore, destruction
-// happening when Free is called.
+// happening when Free is called. The objects are placement-allocated in the slabs of the
+// ObjectStore, so that creating and freeing short-lived objects like bind groups and command
+// encoders every frame doesn't go through the heap.
 //
 // Since the wire has one "ID" namespace per type of object, each ObjectStore should contain a
 // single type of objects. However no templates are used because Client wraps ObjectStore and is
@@ -34,16 +37,38 @@ class Client;
 class ObjectStore {
   public:
     ObjectStore();
+    ~ObjectStore();
 
     ObjectHandle ReserveHandle();
-    void Insert(std::unique_ptr<ObjectBase> obj);
+    // Returns memory for an object of |objectSize| bytes. All the objects of the store must have
+    // the same size and alignment since they are of the same type. The object constructed in the
+    // memory must then be inserted.
+    void* AllocateObjectMemory(uint32_t objectSize, uint32_t objectAlignment);
+    void Insert(ObjectBase* obj);
     void Free(ObjectBase* obj);
     ObjectBase* Get(ObjectId id) const;
 
+    // The number of objects inserted and not freed yet.
+    size_t GetLiveObjectCount() const;
+
   private:
+    class ObjectAllocator : public SlabAllocatorImpl {
+      public:
+        ObjectAllocator(Index blocksPerSlab, uint32_t objectSize, uint32_t objectAlignment);
+
+        using SlabAllocatorImpl::Allocate;
+        using SlabAllocatorImpl::Deallocate;
+    };
+
     uint32_t mCurrentId;
     std::vector<ObjectHandle> mFreeHandles;
-    std::vector<std::unique_ptr<ObjectBase>> mObjects;
+    std::vector<ObjectBase*> mObjects;
+    size_t mLiveObjectCount = 0;
+
+    // Created on the first allocation since the size of the objects isn't known before.
+    std::unique_ptr<ObjectAllocator> mAllocator;
+    uint32_t mObjectSize = 0;
+    uint32_t mObjectAlignment = 0;
 };
 
 }  // namespace dawn::wire::client
@@ -52,8 +52,23 @@ void Queue::OnSubmittedWorkDone(uint64_t signalValue,
     client->SerializeCommand(cmd);
 }
 
+void Queue::Submit(uint32_t commandCount, const WGPUCommandBuffer* commands) {
+    QueueSubmitCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.commandCount = commandCount;
+    cmd.commands = commands;
+
+    Client* client = GetClient();
+    client->SerializeCommand(cmd);
+
+    // The content of the read-ahead buffers is pushed again after the submit.
+    client->IncrementQueueSubmitSerial();
+}
+
 void Queue::WriteBuffer(WGPUBuffer cBuffer, uint64_t bufferOffset, const void* data, size_t size) {
     Buffer* buffer = FromAPI(cBuffer);
+    // The write makes the content pushed by the read-ahead out of date.
+    buffer->DiscardReadAhead();
 
     QueueWriteBufferCmd cmd;
     cmd.queueId = GetWireId();
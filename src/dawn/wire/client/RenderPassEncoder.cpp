@@ -0,0 +1,144 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/client/RenderPassEncoder.h"
+
+#include "dawn/wire/client/ApiObjects.h"
+#include "dawn/wire/client/Client.h"
+
+namespace dawn::wire::client {
+
+// Objects that are required by the API but null are sent with the regular commands, which
+// handle the error.
+
+void RenderPassEncoder::SetPipeline(WGPURenderPipeline pipeline) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr && pipeline != nullptr) {
+        packedCommands->SetPipeline(FromAPI(pipeline)->GetWireId());
+        return;
+    }
+
+    RenderPassEncoderSetPipelineCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.pipeline = pipeline;
+    client->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetBindGroup(uint32_t groupIndex,
+                                     WGPUBindGroup group,
+                                     uint32_t dynamicOffsetCount,
+                                     const uint32_t* dynamicOffsets) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr && group != nullptr &&
+        (dynamicOffsetCount == 0 || dynamicOffsets != nullptr)) {
+        packedCommands->SetBindGroup(groupIndex, FromAPI(group)->GetWireId(), dynamicOffsetCount,
+                                     dynamicOffsets);
+        return;
+    }
+
+    RenderPassEncoderSetBindGroupCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.groupIndex = groupIndex;
+    cmd.group = group;
+    cmd.dynamicOffsetCount = dynamicOffsetCount;
+    cmd.dynamicOffsets = dynamicOffsets;
+    client->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetVertexBuffer(uint32_t slot,
+                                        WGPUBuffer buffer,
+                                        uint64_t offset,
+                                        uint64_t size) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr && buffer != nullptr) {
+        packedCommands->SetVertexBuffer(slot, FromAPI(buffer)->GetWireId(), offset, size);
+        return;
+    }
+
+    RenderPassEncoderSetVertexBufferCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.slot = slot;
+    cmd.buffer = buffer;
+    cmd.offset = offset;
+    cmd.size = size;
+    client->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::SetIndexBuffer(WGPUBuffer buffer,
+                                       WGPUIndexFormat format,
+                                       uint64_t offset,
+                                       uint64_t size) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr && buffer != nullptr) {
+        packedCommands->SetIndexBuffer(FromAPI(buffer)->GetWireId(), format, offset, size);
+        return;
+    }
+
+    RenderPassEncoderSetIndexBufferCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.buffer = buffer;
+    cmd.format = format;
+    cmd.offset = offset;
+    cmd.size = size;
+    client->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::Draw(uint32_t vertexCount,
+                             uint32_t instanceCount,
+                             uint32_t firstVertex,
+                             uint32_t firstInstance) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr) {
+        packedCommands->Draw(vertexCount, instanceCount, firstVertex, firstInstance);
+        return;
+    }
+
+    RenderPassEncoderDrawCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.vertexCount = vertexCount;
+    cmd.instanceCount = instanceCount;
+    cmd.firstVertex = firstVertex;
+    cmd.firstInstance = firstInstance;
+    client->SerializeCommand(cmd);
+}
+
+void RenderPassEncoder::DrawIndexed(uint32_t indexCount,
+                                    uint32_t instanceCount,
+                                    uint32_t firstIndex,
+                                    int32_t baseVertex,
+                                    uint32_t firstInstance) {
+    Client* client = GetClient();
+    PackedCommandEncoder* packedCommands = client->GetPackedCommandEncoder(this);
+    if (packedCommands != nullptr) {
+        packedCommands->DrawIndexed(indexCount, instanceCount, firstIndex, baseVertex,
+                                    firstInstance);
+        return;
+    }
+
+    RenderPassEncoderDrawIndexedCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.indexCount = indexCount;
+    cmd.instanceCount = instanceCount;
+    cmd.firstIndex = firstIndex;
+    cmd.baseVertex = baseVertex;
+    cmd.firstInstance = firstInstance;
+    client->SerializeCommand(cmd);
+}
+
+}  // namespace dawn::wire::client
@@ -0,0 +1,51 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+#define SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+
+#include "dawn/webgpu.h"
+
+#include "dawn/wire/client/ObjectBase.h"
+
+namespace dawn::wire::client {
+
+// The hot commands of render passes are appended to the packed commands of the client when the
+// compact encoding of the wire is used, and sent as regular commands otherwise.
+class RenderPassEncoder final : public ObjectBase {
+  public:
+    using ObjectBase::ObjectBase;
+
+    // Dawn API
+    void SetPipeline(WGPURenderPipeline pipeline);
+    void SetBindGroup(uint32_t groupIndex,
+                      WGPUBindGroup group,
+                      uint32_t dynamicOffsetCount,
+                      const uint32_t* dynamicOffsets);
+    void SetVertexBuffer(uint32_t slot, WGPUBuffer buffer, uint64_t offset, uint64_t size);
+    void SetIndexBuffer(WGPUBuffer buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+    void Draw(uint32_t vertexCount,
+              uint32_t instanceCount,
+              uint32_t firstVertex,
+              uint32_t firstInstance);
+    void DrawIndexed(uint32_t indexCount,
+                     uint32_t instanceCount,
+                     uint32_t firstIndex,
+                     int32_t baseVertex,
+                     uint32_t firstInstance);
+};
+
+}  // namespace dawn::wire::client
+
+#endif  // SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
@@ -0,0 +1,46 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/replay/TimedProcs.h"
+
+#include <cstdint>
+
+namespace dawn::wire::replay {
+
+namespace {
+
+thread_local uint32_t sProcDepth = 0;
+thread_local std::chrono::steady_clock::duration sProcTime{0};
+
+}  // anonymous namespace
+
+ScopedProcTimer::ScopedProcTimer() {
+    if (sProcDepth++ == 0) {
+        mStart = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedProcTimer::~ScopedProcTimer() {
+    if (--sProcDepth == 0) {
+        sProcTime += std::chrono::steady_clock::now() - mStart;
+    }
+}
+
+std::chrono::steady_clock::duration ConsumeProcTime() {
+    std::chrono::steady_clock::duration procTime = sProcTime;
+    sProcTime = std::chrono::steady_clock::duration{0};
+    return procTime;
+}
+
+}  // namespace dawn::wire::replay
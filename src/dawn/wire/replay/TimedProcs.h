@@ -0,0 +1,44 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_REPLAY_TIMEDPROCS_H_
+#define SRC_DAWN_WIRE_REPLAY_TIMEDPROCS_H_
+
+#include <chrono>
+
+#include "dawn/dawn_proc_table.h"
+
+namespace dawn::wire::replay {
+
+// Adds the time until its destruction to the time spent in the procs. Procs called while another
+// one is running, for example from its callbacks, are part of the time of the outermost proc.
+class ScopedProcTimer {
+  public:
+    ScopedProcTimer();
+    ~ScopedProcTimer();
+
+  private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// Returns the time spent in the timed procs since the last call.
+std::chrono::steady_clock::duration ConsumeProcTime();
+
+// Returns a proc table calling |procs| and timing each call with a ScopedProcTimer. Only one
+// table of timed procs can be used at a time.
+DawnProcTable MakeTimedProcs(const DawnProcTable& procs);
+
+}  // namespace dawn::wire::replay
+
+#endif  // SRC_DAWN_WIRE_REPLAY_TIMEDPROCS_H_
@@ -0,0 +1,300 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// dawn_wire_replay replays a wire trace captured with WireHelper::BeginWireTrace (for example with
+// `dawn_end2end_tests --use-wire --wire-trace-dir=...`) on a wire server backed by dawn::native,
+// and reports how much time the server spends decoding and executing each type of command.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/webgpu_cpp.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireServer.h"
+#include "dawn/wire/replay/TimedProcs.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The replies of the server aren't used since the client side of the trace is already recorded.
+class DevNull : public dawn::wire::CommandSerializer {
+  public:
+    size_t GetMaximumAllocationSize() const override { return 1024 * 1024 * 1024; }
+    void* GetCmdSpace(size_t size) override {
+        if (size > mBuffer.size()) {
+            mBuffer.resize(size);
+        }
+        return mBuffer.data();
+    }
+    bool Flush() override { return true; }
+
+  private:
+    std::vector<char> mBuffer;
+};
+
+struct CommandStats {
+    uint64_t count = 0;
+    Clock::duration decodeTime{0};
+    Clock::duration executionTime{0};
+};
+
+dawn::native::Adapter sAdapter;
+WGPUProcDeviceCreateSwapChain sOriginalDeviceCreateSwapChain = nullptr;
+
+// Swapchains created by the client of the trace point to an implementation that doesn't exist in
+// this process, so they are always replaced with error swapchains. This also means nothing is ever
+// presented and the replay isn't paced by the display.
+WGPUSwapChain ErrorDeviceCreateSwapChain(WGPUDevice device,
+                                         WGPUSurface surface,
+                                         const WGPUSwapChainDescriptor*) {
+    WGPUSwapChainDescriptor desc = {};
+    desc.implementation = 0;
+    return sOriginalDeviceCreateSwapChain(device, surface, &desc);
+}
+
+// All the adapter requests of the trace get the adapter of the backend selected on the command
+// line, regardless of the options they were made with.
+void RequestSelectedAdapter(WGPUInstance, const WGPURequestAdapterOptions*,
+                            WGPURequestAdapterCallback callback,
+                            void* userdata) {
+    WGPUAdapter cAdapter = sAdapter.Get();
+    dawn::native::GetProcs().adapterReference(cAdapter);
+    callback(WGPURequestAdapterStatus_Success, cAdapter, nullptr, userdata);
+}
+
+double ToMicroseconds(Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void PrintUsage(const char* program) {
+    printf("Usage: %s [-b BACKEND] [-i ITERATIONS] TRACE_FILE\n", program);
+    printf("  BACKEND is one of: d3d11, d3d12, metal, null, opengl, opengles, vulkan\n");
+    printf("  ITERATIONS is the number of times the trace is replayed, each on a new server\n");
+}
+
+}  // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+    wgpu::BackendType backendType = wgpu::BackendType::Null;
+    uint32_t iterations = 1;
+    const char* tracePath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg(argv[i]);
+        std::string_view value;
+
+        auto MatchOption = [&](const char* shortOpt, const char* longOpt) -> bool {
+            if (arg == shortOpt) {
+                value = ++i < argc ? argv[i] : "";
+                return true;
+            }
+            if (arg.rfind(longOpt, 0) == 0) {
+                value = arg.substr(strlen(longOpt));
+                return true;
+            }
+            return false;
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+
+        if (MatchOption("-b", "--backend=")) {
+            static constexpr std::pair<std::string_view, wgpu::BackendType> kBackends[] = {
+                {"d3d11", wgpu::BackendType::D3D11},   {"d3d12", wgpu::BackendType::D3D12},
+                {"metal", wgpu::BackendType::Metal},   {"null", wgpu::BackendType::Null},
+                {"opengl", wgpu::BackendType::OpenGL}, {"opengles", wgpu::BackendType::OpenGLES},
+                {"vulkan", wgpu::BackendType::Vulkan},
+            };
+            auto backendIt =
+                std::find_if(std::begin(kBackends), std::end(kBackends),
+                             [&](const auto& backend) { return backend.first == value; });
+            if (backendIt == std::end(kBackends)) {
+                fprintf(stderr,
+                        "--backend expects a backend name (d3d11, d3d12, metal, null, opengl, "
+                        "opengles, vulkan)\n");
+                return 1;
+            }
+            backendType = backendIt->second;
+            continue;
+        }
+
+        if (MatchOption("-i", "--iterations=")) {
+            iterations = static_cast<uint32_t>(strtoul(std::string(value).c_str(), nullptr, 10));
+            if (iterations == 0) {
+                fprintf(stderr, "--iterations expects a positive number\n");
+                return 1;
+            }
+            continue;
+        }
+
+        if (tracePath != nullptr || arg.rfind("-", 0) == 0) {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        tracePath = argv[i];
+    }
+
+    if (tracePath == nullptr) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::ifstream traceFile(tracePath, std::ios::binary);
+    if (!traceFile) {
+        fprintf(stderr, "Couldn't open %s\n", tracePath);
+        return 1;
+    }
+    std::vector<char> trace((std::istreambuf_iterator<char>(traceFile)),
+                            std::istreambuf_iterator<char>());
+
+    // The trace starts with the index of the error to inject, which is only used by the fuzzers.
+    if (trace.size() < sizeof(uint64_t)) {
+        fprintf(stderr, "%s isn't a wire trace\n", tracePath);
+        return 1;
+    }
+
+    auto instance = std::make_unique<dawn::native::Instance>();
+    instance->DiscoverDefaultAdapters();
+    std::string adapterName;
+    for (const dawn::native::Adapter& adapter : instance->GetAdapters()) {
+        wgpu::AdapterProperties properties;
+        adapter.GetProperties(&properties);
+        if (properties.backendType == backendType) {
+            sAdapter = adapter;
+            adapterName = properties.name;
+            break;
+        }
+    }
+    if (!sAdapter) {
+        fprintf(stderr, "No adapter found for the requested backend\n");
+        return 1;
+    }
+
+    DawnProcTable nativeProcs = dawn::native::GetProcs();
+    sOriginalDeviceCreateSwapChain = nativeProcs.deviceCreateSwapChain;
+    nativeProcs.deviceCreateSwapChain = ErrorDeviceCreateSwapChain;
+    nativeProcs.instanceRequestAdapter = RequestSelectedAdapter;
+    DawnProcTable procs = dawn::wire::replay::MakeTimedProcs(nativeProcs);
+
+    std::map<dawn::wire::WireCmd, CommandStats> stats;
+    Clock::duration replayTime{0};
+
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        DevNull devNull;
+        dawn::wire::WireServerDescriptor serverDesc = {};
+        serverDesc.procs = &procs;
+        serverDesc.serializer = &devNull;
+        serverDesc.acceptCompactEncoding = true;
+
+        auto wireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+        // The client of the trace reserved its instance first, like in the fuzzers.
+        wireServer->InjectInstance(instance->Get(), 1, 0);
+
+        const char* commands = trace.data() + sizeof(uint64_t);
+        size_t size = trace.size() - sizeof(uint64_t);
+        Clock::time_point replayStart = Clock::now();
+
+        // Handle the commands one at a time to attribute the time of each of them to its type.
+        while (size > 0) {
+            dawn::wire::CmdHeader header;
+            dawn::wire::WireCmd commandId;
+            if (size < sizeof(header) + sizeof(commandId)) {
+                fprintf(stderr, "The trace ends with a truncated command\n");
+                return 1;
+            }
+            memcpy(&header, commands, sizeof(header));
+            memcpy(&commandId, commands + sizeof(header), sizeof(commandId));
+
+            const char* commandName = dawn::wire::GetWireCmdName(commandId);
+            if (commandName == nullptr || header.commandSize < sizeof(header) + sizeof(commandId) ||
+                header.commandSize > size) {
+                fprintf(stderr, "Invalid command at offset %zu of the trace\n",
+                        static_cast<size_t>(commands - trace.data()));
+                return 1;
+            }
+            size_t commandSize = static_cast<size_t>(header.commandSize);
+
+            dawn::wire::replay::ConsumeProcTime();
+            Clock::time_point start = Clock::now();
+            bool success = wireServer->HandleCommands(commands, commandSize) != nullptr;
+            Clock::duration handleTime = Clock::now() - start;
+            Clock::duration executionTime = dawn::wire::replay::ConsumeProcTime();
+
+            if (!success) {
+                fprintf(stderr, "The server failed to handle the %s command at offset %zu\n",
+                        commandName, static_cast<size_t>(commands - trace.data()));
+                return 1;
+            }
+
+            CommandStats& commandStats = stats[commandId];
+            commandStats.count++;
+            commandStats.decodeTime += handleTime - executionTime;
+            commandStats.executionTime += executionTime;
+
+            commands += commandSize;
+            size -= commandSize;
+
+            // Submits are where the client usually waits on the GPU, so process the events there
+            // to bound the amount of work in flight. This isn't part of the cost of the commands.
+            if (commandId == dawn::wire::WireCmd::QueueSubmit) {
+                Clock::time_point eventsStart = Clock::now();
+                dawn::native::InstanceProcessEvents(instance->Get());
+                replayStart += Clock::now() - eventsStart;
+            }
+        }
+        replayTime += Clock::now() - replayStart;
+
+        dawn::native::InstanceProcessEvents(instance->Get());
+        // Deleting the server releases all the objects of the trace.
+        wireServer = nullptr;
+    }
+
+    std::vector<std::pair<dawn::wire::WireCmd, CommandStats>> sortedStats(stats.begin(),
+                                                                          stats.end());
+    std::sort(sortedStats.begin(), sortedStats.end(), [](const auto& a, const auto& b) {
+        return a.second.decodeTime + a.second.executionTime >
+               b.second.decodeTime + b.second.executionTime;
+    });
+
+    printf("Replayed %s %u time(s) on the %s adapter in %.3f ms per iteration\n", tracePath,
+           iterations, adapterName.c_str(), ToMicroseconds(replayTime) / 1000 / iterations);
+    printf("%-48s %12s %14s %14s %14s\n", "command", "count", "total (us)", "decode (ns)",
+           "execute (ns)");
+    for (const auto& [commandId, commandStats] : sortedStats) {
+        double count = static_cast<double>(commandStats.count);
+        printf("%-48s %12.0f %14.1f %14.1f %14.1f\n", dawn::wire::GetWireCmdName(commandId),
+               count / iterations,
+               ToMicroseconds(commandStats.decodeTime + commandStats.executionTime) / iterations,
+               ToMicroseconds(commandStats.decodeTime) * 1000 / count,
+               ToMicroseconds(commandStats.executionTime) * 1000 / count);
+    }
+
+    sAdapter = dawn::native::Adapter();
+    return 0;
+}
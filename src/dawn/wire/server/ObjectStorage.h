@@ -50,6 +50,22 @@ struct ObjectData : public ObjectDataBase<T> {};
 
 enum class BufferMapWriteState { Unmapped, Mapped, MapError };
 
+// The state of the read-ahead of buffers that the client enabled it for. The server maps these
+// buffers for reading after each QueueSubmit and pushes their content to the client so that the
+// next MapAsync of the client doesn't have to wait on the server.
+enum class BufferReadAheadState {
+    // The read-ahead isn't enabled for the buffer.
+    Disabled,
+    // The buffer isn't mapped by the read-ahead.
+    Idle,
+    // The read-ahead mapping of the buffer is in flight.
+    Pending,
+    // The buffer is mapped by the read-ahead and its content was pushed to the client.
+    Mapped,
+    // The client mapped the buffer, or is mapping it, so the read-ahead must not touch it.
+    ClientMapped,
+};
+
 template <>
 struct ObjectData<WGPUBuffer> : public ObjectDataBase<WGPUBuffer> {
     // TODO(enga): Use a tagged pointer to save space.
@@ -59,6 +75,22 @@ struct ObjectData<WGPUBuffer> : public ObjectDataBase<WGPUBuffer> {
     WGPUBufferUsageFlags usage = WGPUBufferUsage_None;
     // Indicate if writeHandle needs to be destroyed on unmap
     bool mappedAtCreation = false;
+
+    // Incremented each time the server calls MapAsync on the buffer so that the callbacks of
+    // cancelled map requests can be recognized.
+    uint64_t mapSerial = 0;
+
+    BufferReadAheadState readAheadState = BufferReadAheadState::Disabled;
+    uint64_t readAheadOffset = 0;
+    uint64_t readAheadSize = 0;
+    // The number of QueueSubmit handled when the pending or mapped read-ahead started.
+    uint64_t readAheadSubmitSerial = 0;
+    // Set when a MapAsync of the client took over the pending read-ahead mapping. The result of
+    // the mapping is then returned as the result of that request.
+    bool readAheadAdopted = false;
+    uint64_t readAheadRequestSerial = 0;
+    uint64_t readAheadRequestOffset = 0;
+    uint64_t readAheadRequestSize = 0;
 };
 
 struct DeviceInfo {
@@ -22,10 +22,12 @@ CallbackUserdata::CallbackUserdata(Server* server, const std::shared_ptr<bool>&
 
 Server::Server(const DawnProcTable& procs,
                CommandSerializer* serializer,
-               MemoryTransferService* memoryTransferService)
+               MemoryTransferService* memoryTransferService,
+               bool acceptCompactEncoding)
     : mSerializer(serializer),
       mProcs(procs),
       mMemoryTransferService(memoryTransferService),
+      mAcceptCompactEncoding(acceptCompactEncoding),
       mIsAlive(std::make_shared<bool>(true)) {
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fallback to inline memory.
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/wire/ChunkedCommandSerializer.h"
 #include "dawn/wire/server/ServerBase_autogen.h"
@@ -96,6 +97,14 @@ struct MapUserdata : CallbackUserdata {
     uint64_t offset;
     uint64_t size;
     WGPUMapModeFlags mode;
+    uint64_t mapSerial;
+};
+
+struct ReadAheadUserdata : CallbackUserdata {
+    using CallbackUserdata::CallbackUserdata;
+
+    ObjectHandle buffer;
+    uint64_t mapSerial;
 };
 
 struct ErrorScopeUserdata : CallbackUserdata {
@@ -147,7 +156,8 @@ class Server : public ServerBase {
   public:
     Server(const DawnProcTable& procs,
            CommandSerializer* serializer,
-           MemoryTransferService* memoryTransferService);
+           MemoryTransferService* memoryTransferService,
+           bool acceptCompactEncoding);
     ~Server() override;
 
     // ChunkedCommandHandler implementation
@@ -200,6 +210,7 @@ class Server : public ServerBase {
                                WGPUErrorType type,
                                const char* message);
     void OnBufferMapAsyncCallback(MapUserdata* userdata, WGPUBufferMapAsyncStatus status);
+    void OnBufferReadAheadCallback(ReadAheadUserdata* userdata, WGPUBufferMapAsyncStatus status);
     void OnQueueWorkDone(QueueWorkDoneUserdata* userdata, WGPUQueueWorkDoneStatus status);
     void OnCreateComputePipelineAsyncCallback(CreatePipelineAsyncUserData* userdata,
                                               WGPUCreatePipelineAsyncStatus status,
@@ -223,11 +234,33 @@ class Server : public ServerBase {
 
 #include "dawn/wire/server/ServerPrototypes_autogen.inc"
 
+    // Read-ahead of the buffers the client enabled it for.
+    // Unmaps the buffers that are mapped, or being mapped, by the read-ahead. This must be done
+    // before submitting work that could use them.
+    void CancelBufferReadAheads();
+    // Maps the buffers that aren't mapped by the client after new work was submitted.
+    void StartBufferReadAheads();
+    // Sends the content of the range [offset, offset + size) of a buffer mapped for reading as
+    // the successful result of the client's map request |requestSerial|.
+    void SerializeBufferMapReadResult(ObjectHandle buffer,
+                                      ObjectData<WGPUBuffer>* bufferData,
+                                      uint64_t requestSerial,
+                                      size_t offset,
+                                      size_t size);
+
     WireDeserializeAllocator mAllocator;
     ChunkedCommandSerializer mSerializer;
     DawnProcTable mProcs;
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     MemoryTransferService* mMemoryTransferService = nullptr;
+    const bool mAcceptCompactEncoding;
+
+    // The number of QueueSubmit commands handled. The client counts the QueueSubmit commands it
+    // sends the same way so that both sides agree on which read-ahead content is up to date.
+    uint64_t mQueueSubmitSerial = 0;
+    // The buffers the client enabled the read-ahead for. Entries for buffers that were freed are
+    // removed lazily.
+    std::vector<ObjectHandle> mReadAheadBuffers;
 
     std::shared_ptr<bool> mIsAlive;
 };
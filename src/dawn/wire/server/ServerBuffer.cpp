@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 
@@ -35,6 +36,12 @@ bool Server::PreHandleBufferUnmap(const BufferUnmapCmd& cmd) {
 
     buffer->mapWriteState = BufferMapWriteState::Unmapped;
 
+    if (buffer->readAheadState != BufferReadAheadState::Disabled) {
+        // Unmapping also unmaps the read-ahead mapping, or cancels it if it is pending.
+        buffer->readAheadState = BufferReadAheadState::Idle;
+        buffer->readAheadAdopted = false;
+    }
+
     return true;
 }
 
@@ -47,10 +54,80 @@ bool Server::PreHandleBufferDestroy(const BufferDestroyCmd& cmd) {
     buffer->readHandle = nullptr;
     buffer->writeHandle = nullptr;
     buffer->mapWriteState = BufferMapWriteState::Unmapped;
+    buffer->readAheadState = BufferReadAheadState::Disabled;
+    buffer->readAheadAdopted = false;
 
     return true;
 }
 
+bool Server::DoBufferEnableReadAhead(ObjectId bufferId, uint64_t offset, uint64_t size) {
+    // The null object isn't valid as `self`
+    if (bufferId == 0) {
+        return false;
+    }
+
+    auto* buffer = BufferObjects().Get(bufferId);
+    if (buffer == nullptr) {
+        return false;
+    }
+
+    // Only buffers that can be mapped for reading have a ReadHandle. It is also cleared when the
+    // buffer is destroyed.
+    if (buffer->readHandle == nullptr) {
+        return false;
+    }
+
+    // The range is mapped on the server, so it must be CPU-addressable.
+    if (offset > std::numeric_limits<size_t>::max() || size >= WGPU_WHOLE_MAP_SIZE ||
+        offset > std::numeric_limits<size_t>::max() - size) {
+        return false;
+    }
+
+    switch (buffer->readAheadState) {
+        case BufferReadAheadState::Disabled:
+            mReadAheadBuffers.push_back(ObjectHandle{bufferId, buffer->generation});
+            buffer->readAheadState = BufferReadAheadState::Idle;
+            break;
+        case BufferReadAheadState::Pending:
+        case BufferReadAheadState::Mapped:
+            // The previous range is mapped, or being mapped.
+            mProcs.bufferUnmap(buffer->handle);
+            buffer->readAheadState = BufferReadAheadState::Idle;
+            break;
+        case BufferReadAheadState::Idle:
+        case BufferReadAheadState::ClientMapped:
+            break;
+    }
+
+    buffer->readAheadOffset = offset;
+    buffer->readAheadSize = size;
+    return true;
+}
+
+bool Server::DoBufferMapReadAhead(ObjectId bufferId, uint64_t submitSerial) {
+    // The null object isn't valid as `self`
+    if (bufferId == 0) {
+        return false;
+    }
+
+    auto* buffer = BufferObjects().Get(bufferId);
+    if (buffer == nullptr) {
+        return false;
+    }
+
+    // The client only uses content that was pushed after the last QueueSubmit it sent and that
+    // wasn't overwritten since, which is exactly when the read-ahead mapping is kept.
+    if (buffer->readAheadState != BufferReadAheadState::Mapped ||
+        buffer->readAheadSubmitSerial != submitSerial) {
+        return false;
+    }
+
+    // The client mapped the buffer without a round trip. It now owns the read-ahead mapping and
+    // will unmap it with BufferUnmap.
+    buffer->readAheadState = BufferReadAheadState::ClientMapped;
+    return true;
+}
+
 bool Server::DoBufferMapAsync(ObjectId bufferId,
                               uint64_t requestSerial,
                               WGPUMapModeFlags mode,
@@ -74,6 +151,7 @@ bool Server::DoBufferMapAsync(ObjectId bufferId,
     userdata->bufferObj = buffer->handle;
     userdata->requestSerial = requestSerial;
     userdata->mode = mode;
+    userdata->mapSerial = buffer->mapSerial;
 
     // Make sure that the deserialized offset and size are no larger than
     // std::numeric_limits<size_t>::max() so that they are CPU-addressable, and size is not
@@ -91,6 +169,48 @@ bool Server::DoBufferMapAsync(ObjectId bufferId,
     userdata->offset = offset;
     userdata->size = size;
 
+    if (buffer->readAheadState != BufferReadAheadState::Disabled) {
+        // A read of the read-ahead range can use the read-ahead mapping since it is only kept
+        // while it is up to date. The alignment is checked here since no MapAsync validates it.
+        bool canUseReadAhead = mode == WGPUMapMode_Read && offset % 8 == 0 && size % 4 == 0 &&
+                               offset >= buffer->readAheadOffset &&
+                               size <= buffer->readAheadSize &&
+                               offset - buffer->readAheadOffset <= buffer->readAheadSize - size;
+
+        switch (buffer->readAheadState) {
+            case BufferReadAheadState::Mapped:
+                if (canUseReadAhead) {
+                    // The client sent this request before it received the pushed content.
+                    buffer->readAheadState = BufferReadAheadState::ClientMapped;
+                    SerializeBufferMapReadResult(userdata->buffer, buffer, requestSerial, offset,
+                                                 size);
+                    return true;
+                }
+                mProcs.bufferUnmap(buffer->handle);
+                break;
+            case BufferReadAheadState::Pending:
+                if (canUseReadAhead) {
+                    // Take over the pending mapping instead of starting another one. Its result
+                    // is returned for this request in OnBufferReadAheadCallback.
+                    buffer->readAheadState = BufferReadAheadState::ClientMapped;
+                    buffer->readAheadAdopted = true;
+                    buffer->readAheadRequestSerial = requestSerial;
+                    buffer->readAheadRequestOffset = offset;
+                    buffer->readAheadRequestSize = size;
+                    return true;
+                }
+                mProcs.bufferUnmap(buffer->handle);
+                break;
+            case BufferReadAheadState::Idle:
+            case BufferReadAheadState::ClientMapped:
+                break;
+            case BufferReadAheadState::Disabled:
+                UNREACHABLE();
+        }
+        buffer->readAheadState = BufferReadAheadState::ClientMapped;
+    }
+
+    userdata->mapSerial = ++buffer->mapSerial;
     mProcs.bufferMapAsync(buffer->handle, mode, offset, size,
                           ForwardToServer<&Server::OnBufferMapAsyncCallback>, userdata.release());
 
@@ -229,6 +349,12 @@ void Server::OnBufferMapAsyncCallback(MapUserdata* data, WGPUBufferMapAsyncStatu
     bool isRead = data->mode & WGPUMapMode_Read;
     bool isSuccess = status == WGPUBufferMapAsyncStatus_Success;
 
+    if (!isSuccess && bufferData->readAheadState == BufferReadAheadState::ClientMapped &&
+        bufferData->mapSerial == data->mapSerial) {
+        // The client's mapping failed so the read-ahead can map the buffer again.
+        bufferData->readAheadState = BufferReadAheadState::Idle;
+    }
+
     ReturnBufferMapAsyncCallbackCmd cmd;
     cmd.buffer = data->buffer;
     cmd.requestSerial = data->requestSerial;
@@ -272,4 +398,134 @@ void Server::OnBufferMapAsyncCallback(MapUserdata* data, WGPUBufferMapAsyncStatu
                                            }});
 }
 
+void Server::SerializeBufferMapReadResult(ObjectHandle buffer,
+                                          ObjectData<WGPUBuffer>* bufferData,
+                                          uint64_t requestSerial,
+                                          size_t offset,
+                                          size_t size) {
+    const void* readData = mProcs.bufferGetConstMappedRange(bufferData->handle, offset, size);
+    size_t readDataUpdateInfoLength =
+        bufferData->readHandle->SizeOfSerializeDataUpdate(offset, size);
+
+    ReturnBufferMapAsyncCallbackCmd cmd;
+    cmd.buffer = buffer;
+    cmd.requestSerial = requestSerial;
+    cmd.status = WGPUBufferMapAsyncStatus_Success;
+    cmd.readDataUpdateInfoLength = readDataUpdateInfoLength;
+    cmd.readDataUpdateInfo = nullptr;
+
+    SerializeCommand(cmd, CommandExtension{readDataUpdateInfoLength, [&](char* readHandleBuffer) {
+                                               bufferData->readHandle->SerializeDataUpdate(
+                                                   readData, offset, size, readHandleBuffer);
+                                           }});
+}
+
+void Server::CancelBufferReadAheads() {
+    // Forget the buffers that were freed or destroyed since the read-ahead was enabled.
+    auto isGone = [this](const ObjectHandle& handle) {
+        auto* buffer = BufferObjects().Get(handle.id);
+        return buffer == nullptr || buffer->generation != handle.generation ||
+               buffer->readAheadState == BufferReadAheadState::Disabled;
+    };
+    mReadAheadBuffers.erase(
+        std::remove_if(mReadAheadBuffers.begin(), mReadAheadBuffers.end(), isGone),
+        mReadAheadBuffers.end());
+
+    for (const ObjectHandle& handle : mReadAheadBuffers) {
+        auto* buffer = BufferObjects().Get(handle.id);
+        if (buffer->readAheadState == BufferReadAheadState::Pending ||
+            buffer->readAheadState == BufferReadAheadState::Mapped) {
+            buffer->readAheadState = BufferReadAheadState::Idle;
+            mProcs.bufferUnmap(buffer->handle);
+        }
+    }
+}
+
+void Server::StartBufferReadAheads() {
+    for (const ObjectHandle& handle : mReadAheadBuffers) {
+        auto* buffer = BufferObjects().Get(handle.id);
+        if (buffer == nullptr || buffer->generation != handle.generation ||
+            buffer->readAheadState != BufferReadAheadState::Idle) {
+            continue;
+        }
+
+        auto userdata = MakeUserdata<ReadAheadUserdata>();
+        userdata->buffer = handle;
+        userdata->mapSerial = ++buffer->mapSerial;
+
+        // Update the state before calling MapAsync since the callback may be called right away.
+        buffer->readAheadState = BufferReadAheadState::Pending;
+        buffer->readAheadSubmitSerial = mQueueSubmitSerial;
+        mProcs.bufferMapAsync(buffer->handle, WGPUMapMode_Read,
+                              static_cast<size_t>(buffer->readAheadOffset),
+                              static_cast<size_t>(buffer->readAheadSize),
+                              ForwardToServer<&Server::OnBufferReadAheadCallback>,
+                              userdata.release());
+    }
+}
+
+void Server::OnBufferReadAheadCallback(ReadAheadUserdata* data, WGPUBufferMapAsyncStatus status) {
+    // Skip the callbacks of buffers that were destroyed and of mappings that were cancelled.
+    auto* bufferData = BufferObjects().Get(data->buffer.id);
+    if (bufferData == nullptr || bufferData->generation != data->buffer.generation ||
+        bufferData->mapSerial != data->mapSerial) {
+        return;
+    }
+
+    bool isSuccess = status == WGPUBufferMapAsyncStatus_Success;
+
+    if (bufferData->readAheadAdopted) {
+        // A MapAsync of the client took over this mapping, return the result for it.
+        ASSERT(bufferData->readAheadState == BufferReadAheadState::ClientMapped);
+        bufferData->readAheadAdopted = false;
+        if (isSuccess) {
+            SerializeBufferMapReadResult(data->buffer, bufferData,
+                                         bufferData->readAheadRequestSerial,
+                                         static_cast<size_t>(bufferData->readAheadRequestOffset),
+                                         static_cast<size_t>(bufferData->readAheadRequestSize));
+            return;
+        }
+
+        bufferData->readAheadState = BufferReadAheadState::Idle;
+
+        ReturnBufferMapAsyncCallbackCmd cmd;
+        cmd.buffer = data->buffer;
+        cmd.requestSerial = bufferData->readAheadRequestSerial;
+        cmd.status = status;
+        cmd.readDataUpdateInfoLength = 0;
+        cmd.readDataUpdateInfo = nullptr;
+        SerializeCommand(cmd);
+        return;
+    }
+
+    if (bufferData->readAheadState != BufferReadAheadState::Pending) {
+        return;
+    }
+    if (!isSuccess) {
+        bufferData->readAheadState = BufferReadAheadState::Idle;
+        return;
+    }
+
+    // Keep the buffer mapped and push its content to the client. The mapping is used by the next
+    // MapAsync of the client, or unmapped before the next QueueSubmit.
+    bufferData->readAheadState = BufferReadAheadState::Mapped;
+
+    size_t offset = static_cast<size_t>(bufferData->readAheadOffset);
+    size_t size = static_cast<size_t>(bufferData->readAheadSize);
+    const void* readData = mProcs.bufferGetConstMappedRange(bufferData->handle, offset, size);
+    size_t readDataUpdateInfoLength =
+        bufferData->readHandle->SizeOfSerializeDataUpdate(offset, size);
+
+    ReturnBufferReadAheadUpdateCmd cmd;
+    cmd.buffer = data->buffer;
+    cmd.submitSerial = bufferData->readAheadSubmitSerial;
+    cmd.readDataUpdateInfoLength = readDataUpdateInfoLength;
+    cmd.readDataUpdateInfo = nullptr;
+
+    SerializeCommand(cmd, CommandExtension{readDataUpdateInfoLength, [&](char* readHandleBuffer) {
+                                               bufferData->readHandle->SerializeDataUpdate(
+                                                   readData, offset, size, readHandleBuffer);
+                                           }});
+}
+
 }  // namespace dawn::wire::server
@@ -45,6 +45,18 @@ bool Server::DoQueueOnSubmittedWorkDone(ObjectId queueId,
     return true;
 }
 
+bool Server::DoQueueSubmit(WGPUQueue cSelf,
+                           uint32_t commandCount,
+                           WGPUCommandBuffer const* commands) {
+    // Buffers that are mapped can't be used in a submit, unmap the ones mapped by the read-ahead
+    // and map them again after the submit so that the client can read what it wrote.
+    CancelBufferReadAheads();
+    mProcs.queueSubmit(cSelf, commandCount, commands);
+    mQueueSubmitSerial++;
+    StartBufferReadAheads();
+    return true;
+}
+
 bool Server::DoQueueWriteBuffer(ObjectId queueId,
                                 ObjectId bufferId,
                                 uint64_t bufferOffset,
@@ -62,6 +74,14 @@ bool Server::DoQueueWriteBuffer(ObjectId queueId,
         return false;
     }
 
+    // The content mapped by the read-ahead is out of date after the write. The client discards
+    // the content it received for the buffer when it sends the write.
+    if (buffer->readAheadState == BufferReadAheadState::Pending ||
+        buffer->readAheadState == BufferReadAheadState::Mapped) {
+        buffer->readAheadState = BufferReadAheadState::Idle;
+        mProcs.bufferUnmap(buffer->handle);
+    }
+
     mProcs.queueWriteBuffer(queue->handle, buffer->handle, bufferOffset, data,
                             static_cast<size_t>(size));
     return true;
@@ -0,0 +1,112 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+
+#include "dawn/wire/PackedCommands.h"
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire::server {
+
+bool Server::DoRenderPassEncoderPackedCommands(ObjectId renderPassEncoderId,
+                                               const uint8_t* data,
+                                               uint64_t dataSize) {
+    if (!mAcceptCompactEncoding) {
+        return false;
+    }
+
+    auto* renderPassEncoder = RenderPassEncoderObjects().Get(renderPassEncoderId);
+    if (renderPassEncoder == nullptr) {
+        return false;
+    }
+    if (dataSize > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+
+    // Like for regular commands, the objects used by the commands must be valid. The commands
+    // that precede an error are still executed.
+    PackedCommandDecoder decoder(data, static_cast<size_t>(dataSize));
+    PackedCommandRecord record;
+    while (!decoder.IsEmpty()) {
+        if (decoder.ReadCommand(&record) != WireResult::Success) {
+            return false;
+        }
+
+        switch (record.command) {
+            case PackedCommand::SetPipeline: {
+                auto* pipeline = RenderPipelineObjects().Get(record.objectId);
+                if (pipeline == nullptr) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetPipeline(renderPassEncoder->handle, pipeline->handle);
+                break;
+            }
+
+            case PackedCommand::SetBindGroup: {
+                auto* group = BindGroupObjects().Get(record.objectId);
+                if (group == nullptr) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetBindGroup(renderPassEncoder->handle, record.index,
+                                                     group->handle, record.dynamicOffsetCount,
+                                                     record.dynamicOffsets);
+                break;
+            }
+
+            case PackedCommand::SetVertexBuffer: {
+                auto* buffer = BufferObjects().Get(record.objectId);
+                if (buffer == nullptr) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetVertexBuffer(renderPassEncoder->handle, record.index,
+                                                        buffer->handle, record.offset,
+                                                        record.size);
+                break;
+            }
+
+            case PackedCommand::SetIndexBuffer: {
+                auto* buffer = BufferObjects().Get(record.objectId);
+                if (buffer == nullptr) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetIndexBuffer(renderPassEncoder->handle, buffer->handle,
+                                                       record.format, record.offset, record.size);
+                break;
+            }
+
+            case PackedCommand::Draw:
+                for (uint32_t i = 0; i < record.drawCount; ++i) {
+                    mProcs.renderPassEncoderDraw(renderPassEncoder->handle, record.count,
+                                                 record.instanceCount, record.first,
+                                                 record.firstInstance);
+                }
+                break;
+
+            case PackedCommand::DrawIndexed:
+                for (uint32_t i = 0; i < record.drawCount; ++i) {
+                    mProcs.renderPassEncoderDrawIndexed(renderPassEncoder->handle, record.count,
+                                                        record.instanceCount, record.first,
+                                                        record.baseVertex, record.firstInstance);
+                }
+                break;
+
+            default:
+                // RepeatDraw is decoded as the draw it repeats.
+                return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace dawn::wire::server
@@ -0,0 +1,173 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
+
+namespace dawn::wire::server {
+
+namespace {
+
+// The data of the handles follows a SharedMemoryHandleHeader.
+uint8_t* GetHandleData(const SharedMemory& memory) {
+    return memory.GetData() + sizeof(SharedMemoryHandleHeader);
+}
+
+size_t GetHandleDataSize(const SharedMemory& memory) {
+    return memory.GetSize() - sizeof(SharedMemoryHandleHeader);
+}
+
+}  // anonymous namespace
+
+class SharedMemoryTransferService : public MemoryTransferService {
+  public:
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        explicit ReadHandleImpl(std::unique_ptr<SharedMemory> memory)
+            : mMemory(std::move(memory)) {}
+        ~ReadHandleImpl() override = default;
+
+        // The data is copied to the shared memory instead of being sent to the client.
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override { return 0; }
+
+        void SerializeDataUpdate(const void* data,
+                                 size_t offset,
+                                 size_t size,
+                                 void* serializePointer) override {
+            // The client validates the range again when receiving the update.
+            size_t dataSize = GetHandleDataSize(*mMemory);
+            if (offset > dataSize || size > dataSize - offset) {
+                return;
+            }
+            if (size > 0) {
+                ASSERT(data != nullptr);
+                memcpy(GetHandleData(*mMemory) + offset, data, size);
+            }
+        }
+
+      private:
+        std::unique_ptr<SharedMemory> mMemory;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        explicit WriteHandleImpl(std::unique_ptr<SharedMemory> memory)
+            : mMemory(std::move(memory)) {}
+        ~WriteHandleImpl() override = default;
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The data is read from the shared memory instead of the command.
+            if (deserializeSize != 0 || mTargetData == nullptr) {
+                return false;
+            }
+            if (offset > mDataLength || size > mDataLength - offset) {
+                return false;
+            }
+            size_t dataSize = GetHandleDataSize(*mMemory);
+            if (offset > dataSize || size > dataSize - offset) {
+                return false;
+            }
+            memcpy(static_cast<uint8_t*>(mTargetData) + offset, GetHandleData(*mMemory) + offset,
+                   size);
+            return true;
+        }
+
+      private:
+        std::unique_ptr<SharedMemory> mMemory;
+    };
+
+    explicit SharedMemoryTransferService(std::string namePrefix)
+        : mNamePrefix(std::move(namePrefix)) {}
+    ~SharedMemoryTransferService() override = default;
+
+    bool DeserializeReadHandle(const void* deserializePointer,
+                               size_t deserializeSize,
+                               ReadHandle** readHandle) override {
+        ASSERT(readHandle != nullptr);
+        std::unique_ptr<SharedMemory> memory = OpenSharedMemory(deserializePointer, deserializeSize);
+        if (memory == nullptr) {
+            return false;
+        }
+        *readHandle = new ReadHandleImpl(std::move(memory));
+        return true;
+    }
+
+    bool DeserializeWriteHandle(const void* deserializePointer,
+                                size_t deserializeSize,
+                                WriteHandle** writeHandle) override {
+        ASSERT(writeHandle != nullptr);
+        std::unique_ptr<SharedMemory> memory = OpenSharedMemory(deserializePointer, deserializeSize);
+        if (memory == nullptr) {
+            return false;
+        }
+        *writeHandle = new WriteHandleImpl(std::move(memory));
+        return true;
+    }
+
+  private:
+    std::unique_ptr<SharedMemory> OpenSharedMemory(const void* deserializePointer,
+                                                   size_t deserializeSize) {
+        SharedMemoryHandleCreateInfo info;
+        if (deserializePointer == nullptr || deserializeSize < sizeof(info)) {
+            return nullptr;
+        }
+        memcpy(&info, deserializePointer, sizeof(info));
+        if (info.nameLength > kMaxSharedMemoryNameLength ||
+            deserializeSize != sizeof(info) + info.nameLength ||
+            info.size > std::numeric_limits<size_t>::max() - sizeof(SharedMemoryHandleHeader)) {
+            return nullptr;
+        }
+
+        // Only open the shared memory objects created by the client, and not any object that the
+        // server process has access to.
+        std::string name(static_cast<const char*>(deserializePointer) + sizeof(info),
+                         info.nameLength);
+        if (name.compare(0, mNamePrefix.size(), mNamePrefix) != 0 ||
+            name.size() == mNamePrefix.size()) {
+            return nullptr;
+        }
+
+        std::unique_ptr<SharedMemory> memory = SharedMemory::Open(
+            name, sizeof(SharedMemoryHandleHeader) + static_cast<size_t>(info.size));
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        // The client can release the object from now on.
+        reinterpret_cast<SharedMemoryHandleHeader*>(memory->GetData())
+            ->openedByServer.store(1, std::memory_order_release);
+        return memory;
+    }
+
+    std::string mNamePrefix;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(const char* namePrefix) {
+    std::string prefix = namePrefix;
+    if (!SharedMemory::IsSupported() || prefix.size() > kMaxSharedMemoryNameLength) {
+        return nullptr;
+    }
+    return std::make_unique<SharedMemoryTransferService>(std::move(prefix));
+}
+
+}  // namespace dawn::wire::server
@@ -46,6 +46,7 @@
 #include "src/tint/utils/string_stream.h"
 #include "src/tint/utils/transform.h"
 #include "src/tint/val/val.h"
+#include "src/tint/writer/for_each_entry_point.h"
 #include "tint/tint.h"
 
 #if TINT_BUILD_IR
@@ -56,9 +57,25 @@
 
 namespace {
 
+/// When set, the output and hashes that would be written to standard output are appended to this
+/// buffer instead, so that the entry points generated in parallel with --jobs are printed in
+/// order.
+thread_local std::string* captured_stdout = nullptr;
+
+/// Prints `str` to standard output, or appends it to `captured_stdout` when it is set.
+void PrintStdout(const std::string& str) {
+    if (captured_stdout) {
+        *captured_stdout += str;
+        return;
+    }
+    std::cout << str;
+}
+
 /// Prints the given hash value in a format string that the end-to-end test runner can parse.
 void PrintHash(uint32_t hash) {
-    std::cout << "<<HASH: 0x" << std::hex << hash << ">>" << std::endl;
+    std::stringstream str;
+    str << "<<HASH: 0x" << std::hex << hash << ">>" << std::endl;
+    PrintStdout(str.str());
 }
 
 enum class Format {
@@ -94,6 +111,8 @@ struct Options {
     bool emit_single_entry_point = false;
     std::string ep_name;
 
+    std::optional<uint32_t> jobs;
+
     bool rename_all = false;
 
 #if TINT_BUILD_SPV_READER
@@ -131,6 +150,10 @@ const char kUsage[] = R"(Usage: tint [options] <input-file>
                                    .hlsl   -> hlsl
                                If none matches, then default to SPIR-V assembly.
   -ep <name>                -- Output single entry point
+  --jobs <count>            -- Output each entry point separately, as with -ep, generating them
+                               on up to <count> threads (0 for one per hardware thread).
+                               When writing to a file, the entry point name is inserted before
+                               the extension of the file name of each output.
   --output-file <name>      -- Output file name.  Use "-" for standard output
   -o <name>                 -- Output file name.  Use "-" for standard output
   --transform <name list>   -- Runs transforms, name list is comma separated
@@ -319,6 +342,18 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
             opts->ep_name = args[i];
             opts->emit_single_entry_point = true;
 
+        } else if (arg == "--jobs") {
+            ++i;
+            if (i >= args.size()) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            auto jobs = parse_unsigned_number(args[i]);
+            if (!jobs.has_value() || jobs.value() > std::numeric_limits<uint32_t>::max()) {
+                std::cerr << "Invalid value for " << arg << ": " << args[i] << std::endl;
+                return false;
+            }
+            opts->jobs = static_cast<uint32_t>(jobs.value());
         } else if (arg == "-o" || arg == "--output-name") {
             ++i;
             if (i >= args.size()) {
@@ -470,6 +505,12 @@ bool WriteFile(const std::string& output_file, const std::string mode, const Con
     const bool use_stdout = output_file.empty() || output_file == "-";
     FILE* file = stdout;
 
+    if (use_stdout && captured_stdout) {
+        captured_stdout->append(reinterpret_cast<const char*>(buffer.data()),
+                                buffer.size() * sizeof(typename ContainerT::value_type));
+        return true;
+    }
+
     if (!use_stdout) {
 #if defined(_MSC_VER)
         fopen_s(&file, output_file.c_str(), mode.c_str());
@@ -815,14 +856,10 @@ bool GenerateHlsl(const tint::Program* program, const Options& options) {
         }
         if (options.verbose) {
             if (fxc_found && !fxc_res.failed) {
-                std::cout << "Passed FXC validation" << std::endl;
-                std::cout << fxc_res.output;
-                std::cout << std::endl;
+                PrintStdout("Passed FXC validation\n" + fxc_res.output + "\n");
             }
             if (dxc_found && !dxc_res.failed) {
-                std::cout << "Passed DXC validation" << std::endl;
-                std::cout << dxc_res.output;
-                std::cout << std::endl;
+                PrintStdout("Passed DXC validation\n" + dxc_res.output + "\n");
             }
         }
     }
@@ -925,6 +962,88 @@ bool GenerateGlsl(const tint::Program* program, const Options& options) {
 #endif  // TINT_BUILD_GLSL_WRITER
 }
 
+/// Generate code for a program, in the format given by the options.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @returns true on success
+bool Generate(const tint::Program* program, const Options& options) {
+    switch (options.format) {
+        case Format::kSpirv:
+        case Format::kSpvAsm:
+            return GenerateSpirv(program, options);
+        case Format::kWgsl:
+            return GenerateWgsl(program, options);
+        case Format::kMsl:
+            return GenerateMsl(program, options);
+        case Format::kHlsl:
+            return GenerateHlsl(program, options);
+        case Format::kGlsl:
+            return GenerateGlsl(program, options);
+        case Format::kNone:
+            return false;
+        default:
+            std::cerr << "Unknown output format specified" << std::endl;
+            return false;
+    }
+}
+
+/// @param output_file the output file name given to Tint
+/// @param entry_point the name of an entry point
+/// @returns the name of the file the code of the entry point is written to with --jobs
+std::string EntryPointOutputFile(const std::string& output_file, const std::string& entry_point) {
+    if (output_file.empty() || output_file == "-") {
+        return output_file;
+    }
+    auto slash = output_file.find_last_of("/\\");
+    auto dot = output_file.rfind('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return output_file + "." + entry_point;
+    }
+    return output_file.substr(0, dot) + "." + entry_point + output_file.substr(dot);
+}
+
+/// Generate code for each entry point of a program separately, on the number of threads given by
+/// the options.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @returns true on success
+bool GenerateEntryPoints(const tint::Program* program, const Options& options) {
+    std::vector<std::string> entry_points;
+    tint::inspector::Inspector inspector(program);
+    for (auto& entry_point : inspector.GetEntryPoints()) {
+        entry_points.push_back(entry_point.name);
+    }
+    if (entry_points.empty()) {
+        return Generate(program, options);
+    }
+
+    struct EntryPointOutput {
+        std::string stdout_text;
+        bool success = false;
+    };
+    std::vector<EntryPointOutput> outputs(entry_points.size());
+    tint::writer::ForEachEntryPoint(
+        program, entry_points, options.jobs.value(),
+        [&](size_t index, const tint::Program* ep_program) {
+            if (!ep_program->IsValid()) {
+                std::cerr << ep_program->Diagnostics().str() << std::endl;
+                return;
+            }
+            auto ep_options = options;
+            ep_options.output_file = EntryPointOutputFile(options.output_file, entry_points[index]);
+            captured_stdout = &outputs[index].stdout_text;
+            outputs[index].success = Generate(ep_program, ep_options);
+            captured_stdout = nullptr;
+        });
+
+    bool success = true;
+    for (auto& output : outputs) {
+        std::cout << output.stdout_text;
+        success &= output.success;
+    }
+    return success;
+}
+
 }  // namespace
 
 int main(int argc, const char** argv) {
@@ -1191,28 +1310,10 @@ int main(int argc, const char** argv) {
     *program = std::move(out.program);
 
     bool success = false;
-    switch (options.format) {
-        case Format::kSpirv:
-        case Format::kSpvAsm:
-            success = GenerateSpirv(program.get(), options);
-            break;
-        case Format::kWgsl:
-            success = GenerateWgsl(program.get(), options);
-            break;
-        case Format::kMsl:
-            success = GenerateMsl(program.get(), options);
-            break;
-        case Format::kHlsl:
-            success = GenerateHlsl(program.get(), options);
-            break;
-        case Format::kGlsl:
-            success = GenerateGlsl(program.get(), options);
-            break;
-        case Format::kNone:
-            break;
-        default:
-            std::cerr << "Unknown output format specified" << std::endl;
-            return 1;
+    if (options.jobs.has_value() && !options.emit_single_entry_point) {
+        success = GenerateEntryPoints(program.get(), options);
+    } else {
+        success = Generate(program.get(), options);
     }
     if (!success) {
         return 1;
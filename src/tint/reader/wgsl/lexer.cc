@@ -14,6 +14,7 @@
 
 #include "src/tint/reader/wgsl/lexer.h"
 
+#include <algorithm>
 #include <cctype>
 #include <charconv>
 #include <cmath>
@@ -41,6 +42,25 @@ static_assert(sizeof(decltype(tint::Source::FileContent::data[0])) == sizeof(uin
 
 static constexpr size_t kDefaultListSize = 512;
 
+// The average number of bytes of source per token, used to estimate the number of tokens of a file.
+static constexpr size_t kBytesPerTokenEstimate = 8;
+
+// ASCII characters are single byte code points, so the lexer can classify them without decoding
+// the UTF-8 of the input.
+bool is_ascii(char ch) {
+    return (static_cast<uint8_t>(ch) & 0x80) == 0;
+}
+
+// The ASCII characters that are XID_Start, plus underscore.
+bool is_ascii_ident_start(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_';
+}
+
+// The ASCII characters that are XID_Continue.
+bool is_ascii_ident_continue(char ch) {
+    return is_ascii_ident_start(ch) || (ch >= '0' && ch <= '9');
+}
+
 bool read_blankspace(std::string_view str, size_t i, bool* is_blankspace, size_t* blankspace_size) {
     // See https://www.w3.org/TR/WGSL/#blankspace
 
@@ -94,7 +114,7 @@ Lexer::~Lexer() = default;
 
 std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
-    tokens.reserve(kDefaultListSize);
+    tokens.reserve(std::max(kDefaultListSize, file_->content.data.size() / kBytesPerTokenEstimate));
     while (true) {
         tokens.emplace_back(next());
 
@@ -171,24 +191,29 @@ Token Lexer::next() {
         return t;
     }
 
-    if (auto t = try_hex_float(); !t.IsUninitialized()) {
-        return t;
-    }
-
-    if (auto t = try_hex_integer(); !t.IsUninitialized()) {
-        return t;
-    }
+    // Numeric literals start with a digit or a '.', and identifiers never start with either, so
+    // only try the kinds of tokens that can start with the current character.
+    char ch = at(pos());
+    if (is_digit(ch) || ch == '.') {
+        if (auto t = try_hex_float(); !t.IsUninitialized()) {
+            return t;
+        }
 
-    if (auto t = try_float(); !t.IsUninitialized()) {
-        return t;
-    }
+        if (auto t = try_hex_integer(); !t.IsUninitialized()) {
+            return t;
+        }
 
-    if (auto t = try_integer(); !t.IsUninitialized()) {
-        return t;
-    }
+        if (auto t = try_float(); !t.IsUninitialized()) {
+            return t;
+        }
 
-    if (auto t = try_ident(); !t.IsUninitialized()) {
-        return t;
+        if (auto t = try_integer(); !t.IsUninitialized()) {
+            return t;
+        }
+    } else if (!is_ascii(ch) || is_ascii_ident_start(ch)) {
+        if (auto t = try_ident(); !t.IsUninitialized()) {
+            return t;
+        }
     }
 
     if (auto t = try_punctuation(); !t.IsUninitialized()) {
@@ -246,6 +271,15 @@ Token Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            char ch = at(pos());
+            if (ch == ' ' || ch == '\t') {
+                advance();
+                continue;
+            }
+            if (is_ascii(ch)) {
+                break;
+            }
+
             bool is_blankspace;
             size_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -277,14 +311,16 @@ Token Lexer::skip_blankspace_and_comments() {
 }
 
 Token Lexer::skip_comment() {
+    static constexpr std::string_view kBlockCommentChars{"/*\0", 3};
+
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return {Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        auto null = line().find('\0', pos());
+        if (null != std::string_view::npos) {
+            set_pos(null);
+            return {Token::Type::kError, begin_source(), "null character found"};
         }
+        set_pos(length());
         return {};
     }
 
@@ -313,8 +349,10 @@ Token Lexer::skip_comment() {
             } else if (is_null()) {
                 return {Token::Type::kError, begin_source(), "null character found"};
             } else {
-                // Anything else: skip and update source location.
-                advance();
+                // Anything else: skip to the next character that may start or end a comment, or
+                // that is null.
+                auto next = line().find_first_of(kBlockCommentChars, pos() + 1);
+                set_pos(next != std::string_view::npos ? next : length());
             }
         }
         if (depth > 0) {
@@ -957,7 +995,12 @@ Token Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (is_ascii(at(pos()))) {
+        if (!is_ascii_ident_start(at(pos()))) {
+            return {};
+        }
+        advance();
+    } else {
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = text::utf8::Decode(utf8, length() - pos());
         if (n == 0) {
@@ -973,6 +1016,14 @@ Token Lexer::try_ident() {
 
     while (!is_eol()) {
         // Must continue with an XID_Continue unicode character
+        if (is_ascii(at(pos()))) {
+            if (!is_ascii_ident_continue(at(pos()))) {
+                break;
+            }
+            advance();
+            continue;
+        }
+
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = text::utf8::Decode(utf8, line().size() - pos());
         if (n == 0) {
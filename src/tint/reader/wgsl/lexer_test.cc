@@ -286,6 +286,30 @@ text // nested line comments are ignored /* more text
     }
 }
 
+TEST_F(LexerTest, Skips_Comments_Block_Stars) {
+    Source::File file("", R"(/** comment * with / stars ***
+text **/ident)");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 2u);
+        EXPECT_EQ(t.source().range.begin.column, 9u);
+        EXPECT_EQ(t.source().range.end.line, 2u);
+        EXPECT_EQ(t.source().range.end.column, 14u);
+        EXPECT_EQ(t.to_str(), "ident");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
 TEST_F(LexerTest, Skips_Comments_Block_Unterminated) {
     // I had to break up the /* because otherwise the clang readability check
     // errored out saying it could not find the end of a multi-line comment.
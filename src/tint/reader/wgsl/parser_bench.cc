@@ -15,6 +15,8 @@
 #include <string>
 
 #include "src/tint/bench/benchmark.h"
+#include "src/tint/reader/wgsl/lexer.h"
+#include "src/tint/utils/string_stream.h"
 
 namespace tint::reader::wgsl {
 namespace {
@@ -36,5 +38,69 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_WGSL_PROGRAMS(ParseWGSL);
 
+// Generates a module with `num_functions` functions, each with comments, declarations, loops and
+// expressions, to measure the lexer and the parser on shaders much larger than the input files.
+std::string GenerateLargeWGSL(int64_t num_functions) {
+    utils::StringStream ss;
+    ss << "// A generated module\n"
+       << "struct Uniforms {\n"
+       << "  scale : vec4<f32>,\n"
+       << "  count : u32,\n"
+       << "}\n"
+       << "@group(0) @binding(0) var<uniform> uniforms : Uniforms;\n"
+       << "@group(0) @binding(1) var<storage, read_write> values : array<vec4<f32>>;\n";
+    for (int64_t i = 0; i < num_functions; i++) {
+        ss << "\n"
+           << "/* Computes the value " << i << ", and\n"
+           << "   accumulates it with the previous ones. */\n"
+           << "fn compute_value_" << i << "(index : u32, weight : f32) -> vec4<f32> {\n"
+           << "  var accumulated = vec4<f32>(0.0, 0.5, 1.0, " << i << ".0);\n"
+           << "  let offset : i32 = " << i << "i;  // The offset of the function\n"
+           << "  for (var j = 0u; j < uniforms.count; j++) {\n"
+           << "    let element = values[(index + j) % arrayLength(&values)];\n"
+           << "    accumulated += element * uniforms.scale * weight + vec4<f32>(f32(offset));\n"
+           << "    if (accumulated.x > 1e3f && j != 0x10u) {\n"
+           << "      break;\n"
+           << "    }\n"
+           << "  }\n"
+           << "  return accumulated;\n"
+           << "}\n";
+    }
+    ss << "\n@compute @workgroup_size(64)\n"
+       << "fn main(@builtin(global_invocation_id) id : vec3<u32>) {\n"
+       << "  values[id.x] = compute_value_0(id.x, 1.0);\n"
+       << "}\n";
+    return ss.str();
+}
+
+void LexLargeWGSL(benchmark::State& state) {
+    Source::File file("generated.wgsl", GenerateLargeWGSL(state.range(0)));
+    for (auto _ : state) {
+        Lexer lexer(&file);
+        auto tokens = lexer.Lex();
+        if (tokens.back().IsError()) {
+            state.SkipWithError(tokens.back().to_str().c_str());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(file.content.data.size()));
+}
+
+void ParseLargeWGSL(benchmark::State& state) {
+    auto source = GenerateLargeWGSL(state.range(0));
+    for (auto _ : state) {
+        Source::File file("generated.wgsl", source);
+        auto res = Parse(&file);
+        if (res.Diagnostics().contains_errors()) {
+            state.SkipWithError(res.Diagnostics().str().c_str());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(source.size()));
+}
+
+BENCHMARK(LexLargeWGSL)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(ParseLargeWGSL)->Arg(100)->Arg(1000)->Arg(10000);
+
 }  // namespace
 }  // namespace tint::reader::wgsl
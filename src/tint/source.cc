@@ -78,6 +78,14 @@ std::vector<std::string_view> SplitLines(std::string_view str) {
 
     size_t lineStart = 0;
     for (size_t i = 0; i < str.size();) {
+        // The only ASCII line breaks are LF, VT, FF and CR, so skip the other ASCII characters
+        // without decoding them.
+        auto c = static_cast<uint8_t>(str[i]);
+        if (c < 0x80 && (c < 0x0A || c > 0x0D)) {
+            ++i;
+            continue;
+        }
+
         bool is_line_break{};
         size_t line_break_size{};
         // We don't handle decode errors from ParseLineBreak. Instead, we rely on
@@ -114,6 +122,9 @@ std::vector<std::string_view> CopyRelativeStringViews(const std::vector<std::str
 
 Source::FileContent::FileContent(const std::string& body) : data(body), lines(SplitLines(data)) {}
 
+Source::FileContent::FileContent(std::string&& body)
+    : data(std::move(body)), lines(SplitLines(data)) {}
+
 Source::FileContent::FileContent(const FileContent& rhs)
     : data(rhs.data), lines(CopyRelativeStringViews(rhs.lines, rhs.data, data)) {}
 
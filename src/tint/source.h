@@ -19,6 +19,7 @@
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "src/tint/utils/string_stream.h"
@@ -35,6 +36,11 @@ class Source {
         /// @param data the file contents
         explicit FileContent(const std::string& data);
 
+        /// Constructs the FileContent with the given file content, taking ownership of it
+        /// without copying it.
+        /// @param data the file contents
+        explicit FileContent(std::string&& data);
+
         /// Copy constructor
         /// @param rhs the FileContent to copy
         FileContent(const FileContent& rhs);
@@ -56,6 +62,12 @@ class Source {
         /// @param c the file contents
         inline File(const std::string& p, const std::string& c) : path(p), content(c) {}
 
+        /// Constructs the File with the given file path and content, taking ownership of the
+        /// content without copying it.
+        /// @param p the path for this file
+        /// @param c the file contents
+        inline File(const std::string& p, std::string&& c) : path(p), content(std::move(c)) {}
+
         /// Copy constructor
         File(const File&) = default;
 
@@ -15,6 +15,7 @@
 #include "src/tint/source.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -59,6 +60,19 @@ TEST_F(SourceFileContentTest, MoveInit) {
     EXPECT_EQ(fc.lines[2], "line three");
 }
 
+TEST_F(SourceFileContentTest, InitFromMovedString) {
+    std::string str = kSource;
+    const char* buffer = str.data();
+    Source::FileContent fc(std::move(str));
+    // The content is not copied.
+    EXPECT_EQ(fc.data.data(), buffer);
+    EXPECT_EQ(fc.data, kSource);
+    ASSERT_EQ(fc.lines.size(), 3u);
+    EXPECT_EQ(fc.lines[0], "line one");
+    EXPECT_EQ(fc.lines[1], "line two");
+    EXPECT_EQ(fc.lines[2], "line three");
+}
+
 // Line break code points
 #define kCR "\r"
 #define kLF "\n"
@@ -26,6 +26,8 @@
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Config);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Timings);
 
 namespace tint::transform {
 
@@ -55,8 +57,25 @@ Transform::ApplyResult Manager::Apply(const Program* program,
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", this));
 
+    Timings* timings = nullptr;
+    if (auto* cfg = inputs.Get<Config>(); cfg && cfg->record_timings) {
+        timings = outputs.Get<Timings>();
+        if (!timings) {
+            outputs.Add<Timings>();
+            timings = outputs.Get<Timings>();
+        }
+    }
+
     for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(program, inputs, outputs)) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = transform->Apply(program, inputs, outputs);
+        if (timings && !transform->Is<Manager>()) {
+            timings->entries.push_back({transform->TypeInfo().name,
+                                        std::chrono::steady_clock::now() - start,
+                                        !result.has_value()});
+        }
+
+        if (result) {
             output.emplace(std::move(result.value()));
             program = &output.value();
 
@@ -77,4 +96,13 @@ Transform::ApplyResult Manager::Apply(const Program* program,
     return output;
 }
 
+Manager::Config::Config(bool record) : record_timings(record) {}
+Manager::Config::Config(const Config&) = default;
+Manager::Config::~Config() = default;
+Manager::Config& Manager::Config::operator=(const Config&) = default;
+
+Manager::Timings::Timings() = default;
+Manager::Timings::Timings(const Timings&) = default;
+Manager::Timings::~Timings() = default;
+
 }  // namespace tint::transform
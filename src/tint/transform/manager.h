@@ -15,7 +15,9 @@
 #ifndef SRC_TINT_TRANSFORM_MANAGER_H_
 #define SRC_TINT_TRANSFORM_MANAGER_H_
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -27,8 +29,56 @@ namespace tint::transform {
 /// The inner transforms will execute in the appended order.
 /// If any inner transform fails the manager will return immediately and
 /// the error can be retrieved with the Output's diagnostics.
+/// The manager can also record the time taken by each of the inner transforms, see Config and
+/// Timings.
 class Manager final : public Castable<Manager, Transform> {
   public:
+    /// Configuration options for the manager
+    struct Config final : public Castable<Config, Data> {
+        /// Constructor
+        /// @param record_timings whether to record the Timings of the transforms
+        explicit Config(bool record_timings = false);
+
+        /// Copy constructor
+        Config(const Config&);
+
+        /// Destructor
+        ~Config() override;
+
+        /// Assignment operator
+        /// @returns this Config
+        Config& operator=(const Config&);
+
+        /// If true, the manager adds the Timings of its transforms to the outputs.
+        bool record_timings = false;
+    };
+
+    /// The time taken by each transform applied by the manager, in the order they were applied.
+    /// Nested managers append the timings of their transforms to the ones of the outer manager.
+    struct Timings final : public Castable<Timings, Data> {
+        /// The timing of a single transform
+        struct Entry {
+            /// The name of the transform
+            std::string name;
+            /// The time taken by the transform, including resolving its output program
+            std::chrono::nanoseconds duration;
+            /// True if the transform returned SkipTransform
+            bool skipped = false;
+        };
+
+        /// Constructor
+        Timings();
+
+        /// Copy constructor
+        Timings(const Timings&);
+
+        /// Destructor
+        ~Timings() override;
+
+        /// The timings of the transforms
+        std::vector<Entry> entries;
+    };
+
     /// Constructor
     Manager();
     ~Manager() override;
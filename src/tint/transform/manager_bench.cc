@@ -0,0 +1,118 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#include "src/tint/ast/identifier.h"
+#include "src/tint/ast/module.h"
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/transform/add_block_attribute.h"
+#include "src/tint/transform/add_empty_entry_point.h"
+#include "src/tint/transform/canonicalize_entry_point_io.h"
+#include "src/tint/transform/demote_to_helper.h"
+#include "src/tint/transform/disable_uniformity_analysis.h"
+#include "src/tint/transform/expand_compound_assignment.h"
+#include "src/tint/transform/for_loop_to_loop.h"
+#include "src/tint/transform/manager.h"
+#include "src/tint/transform/merge_return.h"
+#include "src/tint/transform/preserve_padding.h"
+#include "src/tint/transform/promote_side_effects_to_decl.h"
+#include "src/tint/transform/remove_phonies.h"
+#include "src/tint/transform/remove_unreachable_statements.h"
+#include "src/tint/transform/renamer.h"
+#include "src/tint/transform/robustness.h"
+#include "src/tint/transform/simplify_pointers.h"
+#include "src/tint/transform/single_entry_point.h"
+#include "src/tint/transform/std140.h"
+#include "src/tint/transform/unshadow.h"
+#include "src/tint/transform/var_for_dynamic_index.h"
+#include "src/tint/transform/vectorize_matrix_conversions.h"
+#include "src/tint/transform/vectorize_scalar_matrix_initializers.h"
+#include "src/tint/transform/while_to_loop.h"
+#include "src/tint/transform/zero_init_workgroup_memory.h"
+
+namespace tint::transform {
+namespace {
+
+// Runs the transforms that Dawn and the SPIR-V backend apply to a shader module on its first entry
+// point, and reports the average time taken by each of them as a counter.
+void TransformPipeline(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+
+    Manager manager;
+    DataMap data;
+    for (auto* func : program.AST().Functions()) {
+        if (func->IsEntryPoint()) {
+            manager.Add<SingleEntryPoint>();
+            data.Add<SingleEntryPoint::Config>(program.Symbols().NameFor(func->name->symbol));
+            break;
+        }
+    }
+    manager.Add<Renamer>();
+    manager.Add<DisableUniformityAnalysis>();
+    manager.Add<ExpandCompoundAssignment>();
+    manager.Add<PreservePadding>();
+    manager.Add<Unshadow>();
+    manager.Add<RemoveUnreachableStatements>();
+    manager.Add<PromoteSideEffectsToDecl>();
+    manager.Add<SimplifyPointers>();
+    manager.Add<RemovePhonies>();
+    manager.Add<VectorizeScalarMatrixInitializers>();
+    manager.Add<VectorizeMatrixConversions>();
+    manager.Add<WhileToLoop>();
+    manager.Add<MergeReturn>();
+    manager.Add<Robustness>();
+    manager.Add<ZeroInitWorkgroupMemory>();
+    manager.Add<CanonicalizeEntryPointIO>();
+    manager.Add<AddEmptyEntryPoint>();
+    manager.Add<AddBlockAttribute>();
+    manager.Add<DemoteToHelper>();
+    manager.Add<Std140>();
+    manager.Add<VarForDynamicIndex>();
+    manager.Add<ForLoopToLoop>();
+    data.Add<CanonicalizeEntryPointIO::Config>(CanonicalizeEntryPointIO::ShaderStyle::kSpirv);
+    data.Add<Manager::Config>(/* record_timings */ true);
+
+    std::unordered_map<std::string, std::chrono::nanoseconds> durations;
+    for (auto _ : state) {
+        auto output = manager.Run(&program, data);
+        if (!output.program.IsValid()) {
+            state.SkipWithError(output.program.Diagnostics().str().c_str());
+            break;
+        }
+        for (auto& entry : output.data.Get<Manager::Timings>()->entries) {
+            durations[entry.name] += entry.duration;
+        }
+    }
+
+    // Report the time in microseconds per iteration, without the namespace of the transforms.
+    for (auto& [name, duration] : durations) {
+        auto short_name = name.substr(name.rfind("::") + 2);
+        state.counters[short_name + "_us"] =
+            benchmark::Counter(static_cast<double>(duration.count()) / 1000.0,
+                               benchmark::Counter::kAvgIterations);
+    }
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(TransformPipeline);
+
+}  // namespace
+}  // namespace tint::transform
@@ -0,0 +1,97 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/transform/manager.h"
+
+#include <memory>
+#include <utility>
+
+#include "src/tint/transform/disable_uniformity_analysis.h"
+#include "src/tint/transform/remove_phonies.h"
+#include "src/tint/transform/test_helper.h"
+
+namespace tint::transform {
+namespace {
+
+using ManagerTest = TransformTest;
+
+TEST_F(ManagerTest, NoTimingsByDefault) {
+    auto* src = R"(
+fn f() {
+  _ = 1;
+}
+)";
+
+    auto got = Run<RemovePhonies>(src);
+
+    EXPECT_TRUE(got.program.IsValid()) << got.program.Diagnostics().str();
+    EXPECT_EQ(got.data.Get<Manager::Timings>(), nullptr);
+}
+
+TEST_F(ManagerTest, RecordTimings) {
+    auto* src = R"(
+enable chromium_disable_uniformity_analysis;
+
+fn f() {
+  _ = 1;
+}
+)";
+
+    DataMap data;
+    data.Add<Manager::Config>(true);
+    auto got = Run<DisableUniformityAnalysis, RemovePhonies>(src, data);
+
+    EXPECT_TRUE(got.program.IsValid()) << got.program.Diagnostics().str();
+    auto* timings = got.data.Get<Manager::Timings>();
+    ASSERT_NE(timings, nullptr);
+    ASSERT_EQ(timings->entries.size(), 2u);
+    EXPECT_EQ(timings->entries[0].name, "tint::transform::DisableUniformityAnalysis");
+    EXPECT_TRUE(timings->entries[0].skipped);
+    EXPECT_EQ(timings->entries[1].name, "tint::transform::RemovePhonies");
+    EXPECT_FALSE(timings->entries[1].skipped);
+}
+
+TEST_F(ManagerTest, RecordTimingsOfNestedManagers) {
+    auto* src = R"(
+fn f() {
+  _ = 1;
+}
+)";
+
+    Source::File file("test", src);
+    auto program = reader::wgsl::Parse(&file);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    auto inner = std::make_unique<Manager>();
+    inner->Add<DisableUniformityAnalysis>();
+    Manager manager;
+    manager.append(std::move(inner));
+    manager.Add<RemovePhonies>();
+
+    DataMap data;
+    data.Add<Manager::Config>(true);
+    auto got = manager.Run(&program, data);
+
+    EXPECT_TRUE(got.program.IsValid()) << got.program.Diagnostics().str();
+    auto* timings = got.data.Get<Manager::Timings>();
+    ASSERT_NE(timings, nullptr);
+    ASSERT_EQ(timings->entries.size(), 2u);
+    EXPECT_EQ(timings->entries[0].name, "tint::transform::DisableUniformityAnalysis");
+    EXPECT_FALSE(timings->entries[0].skipped);
+    EXPECT_EQ(timings->entries[1].name, "tint::transform::RemovePhonies");
+    EXPECT_FALSE(timings->entries[1].skipped);
+}
+
+}  // namespace
+}  // namespace tint::transform
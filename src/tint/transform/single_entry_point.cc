@@ -64,10 +64,10 @@ Transform::ApplyResult SingleEntryPoint::Apply(const Program* src,
     auto& sem = src->Sem();
     auto& referenced_vars = sem.Get(entry_point)->TransitivelyReferencedGlobals();
 
-    // Clone any module-scope variables, types, and functions that are statically referenced by the
-    // target entry point.
-    for (auto* decl : src->AST().GlobalDeclarations()) {
-        Switch(
+    // Returns true if the module-scope declaration is statically referenced by the target entry
+    // point, and so needs to be kept.
+    auto is_used = [&](const ast::Node* decl) {
+        return Switch(
             decl,  //
             [&](const ast::TypeDecl* ty) {
                 // Strip aliases that reference unused override declarations.
@@ -76,44 +76,71 @@ Transform::ApplyResult SingleEntryPoint::Apply(const Program* src,
                     if (refs) {
                         for (auto* o : *refs) {
                             if (!referenced_vars.Contains(o)) {
-                                return;
+                                return false;
                             }
                         }
                     }
                 }
 
                 // TODO(jrprice): Strip other unused types.
-                b.AST().AddTypeDecl(ctx.Clone(ty));
+                return true;
             },
             [&](const ast::Override* override) {
-                if (referenced_vars.Contains(sem.Get(override))) {
-                    if (!ast::HasAttribute<ast::IdAttribute>(override->attributes)) {
-                        // If the override doesn't already have an @id() attribute, add one
-                        // so that its allocated ID so that it won't be affected by other
-                        // stripped away overrides
-                        auto* global = sem.Get(override);
-                        const auto* id = b.Id(global->OverrideId());
-                        ctx.InsertFront(override->attributes, id);
-                    }
-                    b.AST().AddGlobalVariable(ctx.Clone(override));
-                }
+                return referenced_vars.Contains(sem.Get(override));
             },
             [&](const ast::Var* var) {
-                if (referenced_vars.Contains(sem.Get<sem::GlobalVariable>(var))) {
-                    b.AST().AddGlobalVariable(ctx.Clone(var));
-                }
-            },
-            [&](const ast::Const* c) {
-                // Always keep 'const' declarations, as these can be used by attributes and array
-                // sizes, which are not tracked as transitively used by functions. They also don't
-                // typically get emitted by the backend unless they're actually used.
-                b.AST().AddGlobalVariable(ctx.Clone(c));
+                return referenced_vars.Contains(sem.Get<sem::GlobalVariable>(var));
             },
             [&](const ast::Function* func) {
-                if (sem.Get(func)->HasAncestorEntryPoint(entry_point->name->symbol)) {
-                    b.AST().AddFunction(ctx.Clone(func));
+                return func == entry_point ||
+                       sem.Get(func)->HasAncestorEntryPoint(entry_point->name->symbol);
+            },
+            // Always keep 'const' declarations, as these can be used by attributes and array
+            // sizes, which are not tracked as transitively used by functions. They also don't
+            // typically get emitted by the backend unless they're actually used.
+            [&](Default) { return true; });
+    };
+
+    // If the target entry point is already the only thing in the module, and all the
+    // declarations of the module are used by it, there is nothing to strip. This is the common
+    // case of shader modules with a single entry point, so avoid cloning and resolving them again.
+    auto needs_id = [&](const ast::Node* decl) {
+        auto* override = decl->As<ast::Override>();
+        return override && !ast::HasAttribute<ast::IdAttribute>(override->attributes);
+    };
+    bool strips_nothing = true;
+    for (auto* decl : src->AST().GlobalDeclarations()) {
+        if (!is_used(decl) || needs_id(decl)) {
+            strips_nothing = false;
+            break;
+        }
+    }
+    if (strips_nothing) {
+        return SkipTransform;
+    }
+
+    // Clone any module-scope variables, types, and functions that are statically referenced by the
+    // target entry point.
+    for (auto* decl : src->AST().GlobalDeclarations()) {
+        if (decl == entry_point || !is_used(decl)) {
+            continue;
+        }
+        Switch(
+            decl,  //
+            [&](const ast::TypeDecl* ty) { b.AST().AddTypeDecl(ctx.Clone(ty)); },
+            [&](const ast::Override* override) {
+                if (needs_id(override)) {
+                    // If the override doesn't already have an @id() attribute, add one
+                    // so that its allocated ID so that it won't be affected by other
+                    // stripped away overrides
+                    auto* global = sem.Get(override);
+                    const auto* id = b.Id(global->OverrideId());
+                    ctx.InsertFront(override->attributes, id);
                 }
+                b.AST().AddGlobalVariable(ctx.Clone(override));
             },
+            [&](const ast::Variable* var) { b.AST().AddGlobalVariable(ctx.Clone(var)); },
+            [&](const ast::Function* func) { b.AST().AddFunction(ctx.Clone(func)); },
             [&](const ast::Enable* ext) { b.AST().AddEnable(ctx.Clone(ext)); },
             [&](const ast::DiagnosticDirective* d) {
                 b.AST().AddDiagnosticDirective(ctx.Clone(d));
@@ -99,6 +99,83 @@ fn main() {
     EXPECT_EQ(src, str(got));
 }
 
+TEST_F(SingleEntryPointTest, ShouldRunSingleEntryPoint) {
+    auto* src = R"(
+enable f16;
+
+const c = 4;
+
+alias A = array<f32, c>;
+
+@id(1) override o : f32;
+
+var<private> v : A;
+
+fn helper() -> f32 {
+  return v[0] + o;
+}
+
+@compute @workgroup_size(1)
+fn main() {
+  _ = helper();
+}
+)";
+
+    DataMap data;
+    data.Add<SingleEntryPoint::Config>("main");
+
+    EXPECT_FALSE(ShouldRun<SingleEntryPoint>(src, data));
+}
+
+TEST_F(SingleEntryPointTest, ShouldRunUnusedDeclaration) {
+    auto* src = R"(
+var<private> v : f32;
+
+@compute @workgroup_size(1)
+fn main() {
+}
+)";
+
+    DataMap data;
+    data.Add<SingleEntryPoint::Config>("main");
+
+    EXPECT_TRUE(ShouldRun<SingleEntryPoint>(src, data));
+}
+
+TEST_F(SingleEntryPointTest, ShouldRunOverrideWithoutId) {
+    auto* src = R"(
+override o : f32;
+
+@compute @workgroup_size(1)
+fn main() {
+  _ = o;
+}
+)";
+
+    DataMap data;
+    data.Add<SingleEntryPoint::Config>("main");
+
+    EXPECT_TRUE(ShouldRun<SingleEntryPoint>(src, data));
+}
+
+TEST_F(SingleEntryPointTest, ShouldRunMultipleEntryPoints) {
+    auto* src = R"(
+@vertex
+fn vert_main() -> @builtin(position) vec4<f32> {
+  return vec4<f32>();
+}
+
+@compute @workgroup_size(1)
+fn main() {
+}
+)";
+
+    DataMap data;
+    data.Add<SingleEntryPoint::Config>("main");
+
+    EXPECT_TRUE(ShouldRun<SingleEntryPoint>(src, data));
+}
+
 TEST_F(SingleEntryPointTest, MultipleEntryPoints) {
     auto* src = R"(
 @vertex
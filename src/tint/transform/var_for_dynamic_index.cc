@@ -19,6 +19,8 @@
 #include "src/tint/program_builder.h"
 #include "src/tint/transform/utils/hoist_to_decl_before.h"
 
+TINT_INSTANTIATE_TYPEINFO(tint::transform::VarForDynamicIndex);
+
 namespace tint::transform {
 
 VarForDynamicIndex::VarForDynamicIndex() = default;
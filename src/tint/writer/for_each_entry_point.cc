@@ -0,0 +1,72 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/for_each_entry_point.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "src/tint/transform/manager.h"
+#include "src/tint/transform/single_entry_point.h"
+
+namespace tint::writer {
+
+void ForEachEntryPoint(const Program* program,
+                       const std::vector<std::string>& entry_points,
+                       uint32_t jobs,
+                       const std::function<void(size_t index, const Program* program)>& callback) {
+    auto process = [&](size_t index) {
+        transform::Manager manager;
+        transform::DataMap inputs;
+        manager.Add<transform::SingleEntryPoint>();
+        inputs.Add<transform::SingleEntryPoint::Config>(entry_points[index]);
+        auto output = manager.Run(program, std::move(inputs));
+        callback(index, &output.program);
+    };
+
+    size_t num_threads = jobs;
+    if (num_threads == 0) {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_threads = std::min(num_threads, entry_points.size());
+
+    if (num_threads <= 1) {
+        for (size_t i = 0; i < entry_points.size(); i++) {
+            process(i);
+        }
+        return;
+    }
+
+    // The threads take the next entry point to process until there are none left, so that the
+    // small entry points don't wait on the large ones.
+    std::atomic<size_t> next_index{0};
+    auto worker = [&] {
+        for (size_t i = next_index++; i < entry_points.size(); i = next_index++) {
+            process(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (size_t i = 0; i < num_threads - 1; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace tint::writer
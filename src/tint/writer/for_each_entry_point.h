@@ -0,0 +1,72 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_WRITER_FOR_EACH_ENTRY_POINT_H_
+#define SRC_TINT_WRITER_FOR_EACH_ENTRY_POINT_H_
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/tint/program.h"
+
+namespace tint::writer {
+
+/// Strips @p program down to each of the entry points of @p entry_points with the
+/// SingleEntryPoint transform, and calls @p callback with the index of the entry point and its
+/// program. The entry points are processed on up to @p jobs threads, including the calling thread,
+/// which all read @p program: it must not be modified until ForEachEntryPoint() returns.
+/// @param program the program to split. The entry points must not have been renamed since the
+/// names in @p entry_points were taken from it.
+/// @param entry_points the names of the entry points
+/// @param jobs the maximum number of threads to use, or 0 to use one per hardware thread
+/// @param callback the function called for each entry point. It is called concurrently from
+/// several threads, and the program passed to it is only valid for the duration of the call.
+void ForEachEntryPoint(const Program* program,
+                       const std::vector<std::string>& entry_points,
+                       uint32_t jobs,
+                       const std::function<void(size_t index, const Program* program)>& callback);
+
+/// Generates the code of each of the entry points of @p program separately, on up to @p jobs
+/// threads. See ForEachEntryPoint().
+/// Example:
+/// ```
+///   auto results = GenerateEntryPoints(&program, names, 8, [&](const Program* ep) {
+///       return writer::hlsl::Generate(ep, options);
+///   });
+/// ```
+/// @param program the program to generate
+/// @param entry_points the names of the entry points
+/// @param jobs the maximum number of threads to use, or 0 to use one per hardware thread
+/// @param generate the generator function, called with the program of each entry point. It is
+/// called concurrently from several threads.
+/// @returns the results of @p generate, in the order of @p entry_points
+template <typename GENERATE>
+auto GenerateEntryPoints(const Program* program,
+                         const std::vector<std::string>& entry_points,
+                         uint32_t jobs,
+                         GENERATE&& generate) {
+    using Result = std::invoke_result_t<GENERATE, const Program*>;
+    std::vector<Result> results(entry_points.size());
+    ForEachEntryPoint(program, entry_points, jobs, [&](size_t index, const Program* ep_program) {
+        results[index] = generate(ep_program);
+    });
+    return results;
+}
+
+}  // namespace tint::writer
+
+#endif  // SRC_TINT_WRITER_FOR_EACH_ENTRY_POINT_H_
@@ -0,0 +1,129 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/for_each_entry_point.h"
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/tint/program_builder.h"
+
+namespace tint::writer {
+namespace {
+
+using namespace tint::number_suffixes;  // NOLINT
+
+class ForEachEntryPointTest : public ::testing::TestWithParam<uint32_t> {
+  protected:
+    /// Builds a program with `count` compute entry points named "ep<i>", which all call a
+    /// common helper function.
+    Program Build(size_t count, std::vector<std::string>* names) {
+        ProgramBuilder b;
+        b.Func("helper", utils::Empty, b.ty.void_(), utils::Empty);
+        for (size_t i = 0; i < count; i++) {
+            names->push_back("ep" + std::to_string(i));
+            b.Func(names->back(), utils::Empty, b.ty.void_(),
+                   utils::Vector{b.CallStmt(b.Call("helper"))},
+                   utils::Vector{
+                       b.Stage(ast::PipelineStage::kCompute),
+                       b.WorkgroupSize(1_i),
+                   });
+        }
+        return Program(std::move(b));
+    }
+};
+
+/// @returns the names of the functions of `program`
+std::string FunctionNames(const Program* program) {
+    std::string names;
+    for (auto* func : program->AST().Functions()) {
+        names += (names.empty() ? "" : ",") + program->Symbols().NameFor(func->name->symbol);
+    }
+    return names;
+}
+
+TEST_P(ForEachEntryPointTest, EachEntryPointIsProcessedOnce) {
+    std::vector<std::string> names;
+    Program program = Build(20, &names);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    std::vector<std::atomic<int>> calls(names.size());
+    std::vector<std::string> functions(names.size());
+    ForEachEntryPoint(&program, names, GetParam(), [&](size_t index, const Program* ep_program) {
+        calls[index]++;
+        ASSERT_TRUE(ep_program->IsValid()) << ep_program->Diagnostics().str();
+        functions[index] = FunctionNames(ep_program);
+    });
+
+    for (size_t i = 0; i < names.size(); i++) {
+        EXPECT_EQ(calls[i], 1);
+        EXPECT_EQ(functions[i], "helper," + names[i]);
+    }
+    // The input program is left untouched.
+    EXPECT_EQ(program.AST().Functions().Length(), names.size() + 1);
+}
+
+TEST_P(ForEachEntryPointTest, GenerateEntryPointsKeepsOrder) {
+    std::vector<std::string> names;
+    Program program = Build(20, &names);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    auto results = GenerateEntryPoints(&program, names, GetParam(), [](const Program* ep_program) {
+        return FunctionNames(ep_program);
+    });
+
+    ASSERT_EQ(results.size(), names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        EXPECT_EQ(results[i], "helper," + names[i]);
+    }
+}
+
+TEST_P(ForEachEntryPointTest, UnknownEntryPoint) {
+    std::vector<std::string> names;
+    Program program = Build(2, &names);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+    names.push_back("missing");
+
+    auto results = GenerateEntryPoints(&program, names, GetParam(), [](const Program* ep_program) {
+        return ep_program->IsValid() ? std::string() : ep_program->Diagnostics().str();
+    });
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0], "");
+    EXPECT_EQ(results[1], "");
+    EXPECT_EQ(results[2], "error: entry point 'missing' not found");
+}
+
+TEST_P(ForEachEntryPointTest, NoEntryPoints) {
+    std::vector<std::string> names;
+    Program program = Build(0, &names);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    bool called = false;
+    ForEachEntryPoint(&program, names, GetParam(), [&](size_t, const Program*) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+INSTANTIATE_TEST_SUITE_P(WriterTest,
+                         ForEachEntryPointTest,
+                         testing::Values(0u, 1u, 2u, 8u, 64u),
+                         [](const testing::TestParamInfo<uint32_t>& info) {
+                             return "Jobs" + std::to_string(info.param);
+                         });
+
+}  // namespace
+}  // namespace tint::writer
@@ -49,8 +49,7 @@ class BinaryWriter {
     std::vector<uint32_t>& result() { return out_; }
 
   private:
-    void process_instruction(const Instruction& inst);
-    void process_op(const Operand& op);
+    void process_instructions(const InstructionList& insts);
 
     std::vector<uint32_t> out_;
 };
@@ -48,7 +48,6 @@
 #include "src/tint/type/vector.h"
 #include "src/tint/utils/compiler_macros.h"
 #include "src/tint/utils/defer.h"
-#include "src/tint/utils/map.h"
 #include "src/tint/utils/string_stream.h"
 #include "src/tint/writer/append_vector.h"
 #include "src/tint/writer/check_supported_extensions.h"
@@ -58,15 +57,6 @@ namespace {
 
 const char kGLSLstd450[] = "GLSL.std.450";
 
-uint32_t size_of(const InstructionList& instructions) {
-    uint32_t size = 0;
-    for (const auto& inst : instructions) {
-        size += inst.word_length();
-    }
-
-    return size;
-}
-
 uint32_t pipeline_stage_to_execution_model(ast::PipelineStage stage) {
     SpvExecutionModel model = SpvExecutionModelVertex;
 
@@ -302,18 +292,18 @@ bool Builder::Build() {
 }
 
 void Builder::RegisterVariable(const sem::Variable* var, uint32_t id) {
-    var_to_id_.emplace(var, id);
-    id_to_var_.emplace(id, var);
+    var_to_id_.Add(var, id);
+    id_to_var_.Add(id, var);
 }
 
 uint32_t Builder::LookupVariableID(const sem::Variable* var) {
-    auto it = var_to_id_.find(var);
-    if (it == var_to_id_.end()) {
+    auto id = var_to_id_.Get(var);
+    if (!id) {
         error_ = "unable to find ID for variable: " +
                  builder_.Symbols().NameFor(var->Declaration()->name->symbol);
         return 0;
     }
-    return it->second;
+    return *id;
 }
 
 void Builder::PushScope() {
@@ -333,15 +323,15 @@ uint32_t Builder::total_size() const {
     // The 5 covers the magic, version, generator, id bound and reserved.
     uint32_t size = 5;
 
-    size += size_of(capabilities_);
-    size += size_of(extensions_);
-    size += size_of(ext_imports_);
-    size += size_of(memory_model_);
-    size += size_of(entry_points_);
-    size += size_of(execution_modes_);
-    size += size_of(debug_);
-    size += size_of(annotations_);
-    size += size_of(types_);
+    size += capabilities_.word_length();
+    size += extensions_.word_length();
+    size += ext_imports_.word_length();
+    size += memory_model_.word_length();
+    size += entry_points_.word_length();
+    size += execution_modes_.word_length();
+    size += debug_.word_length();
+    size += annotations_.word_length();
+    size += types_.word_length();
     for (const auto& func : functions_) {
         size += func.word_length();
     }
@@ -349,48 +339,29 @@ uint32_t Builder::total_size() const {
     return size;
 }
 
-void Builder::iterate(std::function<void(const Instruction&)> cb) const {
-    for (const auto& inst : capabilities_) {
-        cb(inst);
-    }
-    for (const auto& inst : extensions_) {
-        cb(inst);
-    }
-    for (const auto& inst : ext_imports_) {
-        cb(inst);
-    }
-    for (const auto& inst : memory_model_) {
-        cb(inst);
-    }
-    for (const auto& inst : entry_points_) {
-        cb(inst);
-    }
-    for (const auto& inst : execution_modes_) {
-        cb(inst);
-    }
-    for (const auto& inst : debug_) {
-        cb(inst);
-    }
-    for (const auto& inst : annotations_) {
-        cb(inst);
-    }
-    for (const auto& inst : types_) {
-        cb(inst);
-    }
+void Builder::iterate(std::function<void(const InstructionList&)> cb) const {
+    cb(capabilities_);
+    cb(extensions_);
+    cb(ext_imports_);
+    cb(memory_model_);
+    cb(entry_points_);
+    cb(execution_modes_);
+    cb(debug_);
+    cb(annotations_);
+    cb(types_);
     for (const auto& func : functions_) {
         func.iterate(cb);
     }
 }
 
 void Builder::push_capability(uint32_t cap) {
-    if (capability_set_.count(cap) == 0) {
-        capability_set_.insert(cap);
-        capabilities_.push_back(Instruction{spv::Op::OpCapability, {Operand(cap)}});
+    if (capability_set_.Add(cap)) {
+        capabilities_.push_back(spv::Op::OpCapability, {Operand(cap)});
     }
 }
 
 void Builder::push_extension(const char* extension) {
-    extensions_.push_back(Instruction{spv::Op::OpExtension, {Operand(extension)}});
+    extensions_.push_back(spv::Op::OpExtension, {Operand(extension)});
 }
 
 bool Builder::GenerateExtension(builtin::Extension extension) {
@@ -629,8 +600,7 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
         push_debug(spv::Op::OpName,
                    {Operand(param_id),
                     Operand(builder_.Symbols().NameFor(param->Declaration()->name->symbol))});
-        params.push_back(
-            Instruction{spv::Op::OpFunctionParameter, {Operand(param_type_id), param_op}});
+        params.push_back(spv::Op::OpFunctionParameter, {Operand(param_type_id), param_op});
 
         RegisterVariable(param, param_id);
     }
@@ -661,13 +631,13 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
         }
     }
 
-    func_symbol_to_id_[func_ast->name->symbol] = func_id;
+    func_symbol_to_id_.Replace(func_ast->name->symbol, func_id);
 
     return true;
 }
 
 uint32_t Builder::GenerateFunctionTypeIfNeeded(const sem::Function* func) {
-    return utils::GetOrCreate(func_sig_to_id_, func->Signature(), [&]() -> uint32_t {
+    return func_sig_to_id_.GetOrCreate(func->Signature(), [&]() -> uint32_t {
         auto func_op = result_op();
         auto func_type_id = std::get<uint32_t>(func_op);
 
@@ -1230,9 +1200,8 @@ uint32_t Builder::GenerateUnaryOpExpression(const ast::UnaryOpExpression* expr)
 }
 
 uint32_t Builder::GetGLSLstd450Import() {
-    auto where = import_name_to_id_.find(kGLSLstd450);
-    if (where != import_name_to_id_.end()) {
-        return where->second;
+    if (auto id = import_name_to_id_.Get(kGLSLstd450)) {
+        return *id;
     }
 
     // It doesn't exist yet. Generate it.
@@ -1242,7 +1211,7 @@ uint32_t Builder::GetGLSLstd450Import() {
     push_ext_import(spv::Op::OpExtInstImport, {result, Operand(kGLSLstd450)});
 
     // Remember it for later.
-    import_name_to_id_[kGLSLstd450] = id;
+    import_name_to_id_.Add(kGLSLstd450, id);
     return id;
 }
 
@@ -1440,7 +1409,7 @@ uint32_t Builder::GenerateValueConstructorOrConversion(const sem::Call* call,
                       ? scope_stack_[0]       // Global scope
                       : scope_stack_.back();  // Lexical scope
 
-    return utils::GetOrCreate(stack.type_init_to_id_, OperandListKey{ops}, [&]() -> uint32_t {
+    return stack.type_init_to_id_.GetOrCreate(OperandListKey{ops}, [&]() -> uint32_t {
         auto result = result_op();
         ops[kOpsResultIdx] = result;
 
@@ -1681,13 +1650,12 @@ uint32_t Builder::GenerateConstantIfNeeded(const constant::Value* constant) {
         }
 
         auto& global_scope = scope_stack_[0];
-        return utils::GetOrCreate(global_scope.type_init_to_id_, OperandListKey{ops},
-                                  [&]() -> uint32_t {
-                                      auto result = result_op();
-                                      ops[kOpsResultIdx] = result;
-                                      push_type(spv::Op::OpConstantComposite, std::move(ops));
-                                      return std::get<uint32_t>(result);
-                                  });
+        return global_scope.type_init_to_id_.GetOrCreate(OperandListKey{ops}, [&]() -> uint32_t {
+            auto result = result_op();
+            ops[kOpsResultIdx] = result;
+            push_type(spv::Op::OpConstantComposite, std::move(ops));
+            return std::get<uint32_t>(result);
+        });
     };
 
     return Switch(
@@ -1730,9 +1698,8 @@ uint32_t Builder::GenerateConstantIfNeeded(const constant::Value* constant) {
 }
 
 uint32_t Builder::GenerateConstantIfNeeded(const ScalarConstant& constant) {
-    auto it = const_to_id_.find(constant);
-    if (it != const_to_id_.end()) {
-        return it->second;
+    if (auto id = const_to_id_.Get(constant)) {
+        return *id;
     }
 
     uint32_t type_id = 0;
@@ -1796,7 +1763,7 @@ uint32_t Builder::GenerateConstantIfNeeded(const ScalarConstant& constant) {
         }
     }
 
-    const_to_id_[constant] = result_id;
+    const_to_id_.Add(constant, result_id);
     return result_id;
 }
 
@@ -1806,7 +1773,7 @@ uint32_t Builder::GenerateConstantNullIfNeeded(const type::Type* type) {
         return 0;
     }
 
-    return utils::GetOrCreate(const_null_to_id_, type, [&] {
+    return const_null_to_id_.GetOrCreate(type, [&] {
         auto result = result_op();
 
         push_type(spv::Op::OpConstantNull, {Operand(type_id), result});
@@ -1822,7 +1789,7 @@ uint32_t Builder::GenerateConstantVectorSplatIfNeeded(const type::Vector* type,
     }
 
     uint64_t key = (static_cast<uint64_t>(type->Width()) << 32) + value_id;
-    return utils::GetOrCreate(const_splat_to_id_, key, [&] {
+    return const_splat_to_id_.GetOrCreate(key, [&] {
         auto result = result_op();
         auto result_id = std::get<uint32_t>(result);
 
@@ -1834,7 +1801,6 @@ uint32_t Builder::GenerateConstantVectorSplatIfNeeded(const type::Vector* type,
         }
         push_type(spv::Op::OpConstantComposite, ops);
 
-        const_splat_to_id_[key] = result_id;
         return result_id;
     });
 }
@@ -2272,12 +2238,12 @@ uint32_t Builder::GenerateFunctionCall(const sem::Call* call, const sem::Functio
 
     OperandList ops = {Operand(type_id), result};
 
-    auto func_id = func_symbol_to_id_[ident->symbol];
-    if (func_id == 0) {
+    auto func_id = func_symbol_to_id_.Get(ident->symbol);
+    if (!func_id) {
         error_ = "unable to find called function: " + builder_.Symbols().NameFor(ident->symbol);
         return 0;
     }
-    ops.push_back(Operand(func_id));
+    ops.push_back(Operand(*func_id));
 
     for (auto* arg : expr->args) {
         auto id = GenerateExpression(arg);
@@ -3295,7 +3261,7 @@ uint32_t Builder::GenerateSampledImage(const type::Type* texture_type,
     }
 
     uint32_t sampled_image_type_id =
-        utils::GetOrCreate(texture_type_to_sampled_image_type_id_, texture_type, [&] {
+        texture_type_to_sampled_image_type_id_.GetOrCreate(texture_type, [&] {
             // We need to create the sampled image type and cache the result.
             auto sampled_image_type = result_op();
             auto texture_type_id = GenerateTypeIfNeeded(texture_type);
@@ -3677,7 +3643,7 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                                               builtin::Access::kReadWrite);
     }
 
-    return utils::GetOrCreate(type_to_id_, type, [&]() -> uint32_t {
+    return type_to_id_.GetOrCreate(type, [&]() -> uint32_t {
         auto result = result_op();
         auto id = std::get<uint32_t>(result);
         bool ok = Switch(
@@ -3732,13 +3698,18 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                 // Register all three access types of StorageTexture names. In
                 // SPIR-V, we must output a single type, while the variable is
                 // annotated with the access type. Doing this ensures we de-dupe.
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kRead, tex->type())] = id;
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kWrite, tex->type())] = id;
-                type_to_id_[builder_.create<type::StorageTexture>(
-                    tex->dim(), tex->texel_format(), builtin::Access::kReadWrite, tex->type())] =
-                    id;
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(), builtin::Access::kRead,
+                                        tex->type()),
+                                    id);
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(), builtin::Access::kWrite,
+                                        tex->type()),
+                                    id);
+                type_to_id_.Replace(builder_.create<type::StorageTexture>(
+                                        tex->dim(), tex->texel_format(),
+                                        builtin::Access::kReadWrite, tex->type()),
+                                    id);
                 return true;
             },
             [&](const type::Texture* tex) { return GenerateTextureType(tex, result); },
@@ -3748,10 +3719,11 @@ uint32_t Builder::GenerateTypeIfNeeded(const type::Type* type) {
                 // Register both of the sampler type names. In SPIR-V they're the same
                 // sampler type, so we need to match that when we do the dedup check.
                 if (s->kind() == type::SamplerKind::kSampler) {
-                    type_to_id_[builder_.create<type::Sampler>(
-                        type::SamplerKind::kComparisonSampler)] = id;
+                    type_to_id_.Replace(
+                        builder_.create<type::Sampler>(type::SamplerKind::kComparisonSampler), id);
                 } else {
-                    type_to_id_[builder_.create<type::Sampler>(type::SamplerKind::kSampler)] = id;
+                    type_to_id_.Replace(builder_.create<type::Sampler>(type::SamplerKind::kSampler),
+                                        id);
                 }
                 return true;
             },
@@ -4158,8 +4130,7 @@ bool Builder::InsideBasicBlock() const {
         // thing in the function is that entry block label.
         return true;
     }
-    const auto& inst = instructions.back();
-    switch (inst.opcode()) {
+    switch (instructions.last_opcode()) {
         case spv::Op::OpBranch:
         case spv::Op::OpBranchConditional:
         case spv::Op::OpSwitch:
@@ -16,8 +16,7 @@
 #define SRC_TINT_WRITER_SPIRV_BUILDER_H_
 
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "spirv/unified1/spirv.h"
@@ -38,6 +37,8 @@
 #include "src/tint/scope_stack.h"
 #include "src/tint/sem/builtin.h"
 #include "src/tint/type/storage_texture.h"
+#include "src/tint/utils/hashmap.h"
+#include "src/tint/utils/hashset.h"
 #include "src/tint/writer/spirv/function.h"
 #include "src/tint/writer/spirv/scalar_constant.h"
 
@@ -105,10 +106,10 @@ class Builder {
         return id;
     }
 
-    /// Iterates over all the instructions in the correct order and calls the
-    /// given callback
+    /// Iterates over all the instruction lists in the correct order and calls
+    /// the given callback
     /// @param cb the callback to execute
-    void iterate(std::function<void(const Instruction&)> cb) const;
+    void iterate(std::function<void(const InstructionList&)> cb) const;
 
     /// Adds an instruction to the list of capabilities, if the capability
     /// hasn't already been added.
@@ -125,7 +126,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_ext_import(spv::Op op, const OperandList& operands) {
-        ext_imports_.push_back(Instruction{op, operands});
+        ext_imports_.push_back(op, operands);
     }
     /// @returns the ext imports
     const InstructionList& ext_imports() const { return ext_imports_; }
@@ -133,7 +134,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_memory_model(spv::Op op, const OperandList& operands) {
-        memory_model_.push_back(Instruction{op, operands});
+        memory_model_.push_back(op, operands);
     }
     /// @returns the memory model
     const InstructionList& memory_model() const { return memory_model_; }
@@ -141,7 +142,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_entry_point(spv::Op op, const OperandList& operands) {
-        entry_points_.push_back(Instruction{op, operands});
+        entry_points_.push_back(op, operands);
     }
     /// @returns the entry points
     const InstructionList& entry_points() const { return entry_points_; }
@@ -149,7 +150,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_execution_mode(spv::Op op, const OperandList& operands) {
-        execution_modes_.push_back(Instruction{op, operands});
+        execution_modes_.push_back(op, operands);
     }
     /// @returns the execution modes
     const InstructionList& execution_modes() const { return execution_modes_; }
@@ -157,7 +158,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_debug(spv::Op op, const OperandList& operands) {
-        debug_.push_back(Instruction{op, operands});
+        debug_.push_back(op, operands);
     }
     /// @returns the debug instructions
     const InstructionList& debug() const { return debug_; }
@@ -165,7 +166,7 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_type(spv::Op op, const OperandList& operands) {
-        types_.push_back(Instruction{op, operands});
+        types_.push_back(op, operands);
     }
     /// @returns the type instructions
     const InstructionList& types() const { return types_; }
@@ -173,16 +174,16 @@ class Builder {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_annot(spv::Op op, const OperandList& operands) {
-        annotations_.push_back(Instruction{op, operands});
+        annotations_.push_back(op, operands);
     }
     /// @returns the annotations
     const InstructionList& annots() const { return annotations_; }
 
     /// Adds a function to the builder
     /// @param func the function to add
-    void push_function(const Function& func) {
-        functions_.push_back(func);
+    void push_function(Function func) {
         current_label_id_ = func.label_id();
+        functions_.push_back(std::move(func));
     }
     /// @returns the functions
     const std::vector<Function>& functions() const { return functions_; }
@@ -609,23 +610,23 @@ class Builder {
         Scope();
         Scope(const Scope&);
         ~Scope();
-        std::unordered_map<OperandListKey, uint32_t> type_init_to_id_;
+        utils::Hashmap<OperandListKey, uint32_t, 8> type_init_to_id_;
     };
 
-    std::unordered_map<const sem::Variable*, uint32_t> var_to_id_;
-    std::unordered_map<uint32_t, const sem::Variable*> id_to_var_;
-    std::unordered_map<std::string, uint32_t> import_name_to_id_;
-    std::unordered_map<Symbol, uint32_t> func_symbol_to_id_;
-    std::unordered_map<sem::CallTargetSignature, uint32_t> func_sig_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> type_to_id_;
-    std::unordered_map<ScalarConstant, uint32_t> const_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> const_null_to_id_;
-    std::unordered_map<uint64_t, uint32_t> const_splat_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> texture_type_to_sampled_image_type_id_;
+    utils::Hashmap<const sem::Variable*, uint32_t, 16> var_to_id_;
+    utils::Hashmap<uint32_t, const sem::Variable*, 16> id_to_var_;
+    utils::Hashmap<std::string, uint32_t, 4> import_name_to_id_;
+    utils::Hashmap<Symbol, uint32_t, 8> func_symbol_to_id_;
+    utils::Hashmap<sem::CallTargetSignature, uint32_t, 8> func_sig_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 16> type_to_id_;
+    utils::Hashmap<ScalarConstant, uint32_t, 16> const_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 8> const_null_to_id_;
+    utils::Hashmap<uint64_t, uint32_t, 8> const_splat_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 8> texture_type_to_sampled_image_type_id_;
     std::vector<Scope> scope_stack_;
     std::vector<uint32_t> merge_stack_;
     std::vector<uint32_t> continue_stack_;
-    std::unordered_set<uint32_t> capability_set_;
+    utils::Hashset<uint32_t, 8> capability_set_;
     bool zero_initialize_workgroup_memory_ = false;
 
     struct ContinuingInfo {
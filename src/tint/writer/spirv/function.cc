@@ -16,34 +16,34 @@
 
 namespace tint::writer::spirv {
 
-Function::Function() : declaration_(Instruction{spv::Op::OpNop, {}}), label_op_(Operand(0u)) {}
+Function::Function() {
+    declaration_.push_back(spv::Op::OpNop, {});
+    declaration_.push_back(spv::Op::OpLabel, {Operand(0u)});
+}
 
 Function::Function(const Instruction& declaration,
                    const Operand& label_op,
                    const InstructionList& params)
-    : declaration_(declaration), label_op_(label_op), params_(params) {}
+    : label_id_(std::get<uint32_t>(label_op)) {
+    declaration_.push_back(declaration);
+    declaration_.append(params);
+    declaration_.push_back(spv::Op::OpLabel, {label_op});
+}
 
 Function::Function(const Function& other) = default;
 
+Function::Function(Function&& other) = default;
+
 Function::~Function() = default;
 
-void Function::iterate(std::function<void(const Instruction&)> cb) const {
+void Function::iterate(std::function<void(const InstructionList&)> cb) const {
     cb(declaration_);
+    cb(vars_);
+    cb(instructions_);
 
-    for (const auto& param : params_) {
-        cb(param);
-    }
-
-    cb(Instruction{spv::Op::OpLabel, {label_op_}});
-
-    for (const auto& var : vars_) {
-        cb(var);
-    }
-    for (const auto& inst : instructions_) {
-        cb(inst);
-    }
-
-    cb(Instruction{spv::Op::OpFunctionEnd, {}});
+    InstructionList end;
+    end.push_back(spv::Op::OpFunctionEnd, {});
+    cb(end);
 }
 
 }  // namespace tint::writer::spirv
@@ -38,56 +38,45 @@ class Function {
     /// Copy constructor
     /// @param other the function to copy
     Function(const Function& other);
+    /// Move constructor
+    /// @param other the function to move
+    Function(Function&& other);
     ~Function();
 
-    /// Iterates over the function call the cb on each instruction
+    /// Iterates over the instruction lists of the function, in order, and calls the cb on each
+    /// list
     /// @param cb the callback to call
-    void iterate(std::function<void(const Instruction&)> cb) const;
-
-    /// @returns the declaration
-    const Instruction& declaration() const { return declaration_; }
+    void iterate(std::function<void(const InstructionList&)> cb) const;
 
     /// @returns the label ID for the function entry block
-    uint32_t label_id() const { return std::get<uint32_t>(label_op_); }
+    uint32_t label_id() const { return label_id_; }
 
     /// Adds an instruction to the instruction list
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_inst(spv::Op op, const OperandList& operands) {
-        instructions_.push_back(Instruction{op, operands});
+        instructions_.push_back(op, operands);
     }
     /// @returns the instruction list
     const InstructionList& instructions() const { return instructions_; }
 
     /// Adds a variable to the variable list
     /// @param operands the operands for the variable
-    void push_var(const OperandList& operands) {
-        vars_.push_back(Instruction{spv::Op::OpVariable, operands});
-    }
+    void push_var(const OperandList& operands) { vars_.push_back(spv::Op::OpVariable, operands); }
     /// @returns the variable list
     const InstructionList& variables() const { return vars_; }
 
     /// @returns the word length of the function
     uint32_t word_length() const {
-        // 1 for the Label and 1 for the FunctionEnd
-        uint32_t size = 2 + declaration_.word_length();
-
-        for (const auto& param : params_) {
-            size += param.word_length();
-        }
-        for (const auto& var : vars_) {
-            size += var.word_length();
-        }
-        for (const auto& inst : instructions_) {
-            size += inst.word_length();
-        }
-        return size;
+        // 1 for the FunctionEnd
+        return 1 + declaration_.word_length() + vars_.word_length() +
+               instructions_.word_length();
     }
 
   private:
-    Instruction declaration_;
-    Operand label_op_;
-    InstructionList params_;
+    // The OpFunction, the OpFunctionParameters and the OpLabel of the entry block
+    InstructionList declaration_;
+    uint32_t label_id_ = 0;
     InstructionList vars_;
     InstructionList instructions_;
 };
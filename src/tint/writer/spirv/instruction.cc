@@ -14,8 +14,12 @@
 
 #include "src/tint/writer/spirv/instruction.h"
 
+#include <cstring>
+#include <string>
 #include <utility>
 
+#include "src/tint/utils/bitcast.h"
+
 namespace tint::writer::spirv {
 
 Instruction::Instruction(spv::Op op, OperandList operands)
@@ -33,4 +37,62 @@ uint32_t Instruction::word_length() const {
     return size;
 }
 
+InstructionList::InstructionList() = default;
+
+InstructionList::InstructionList(const InstructionList&) = default;
+
+InstructionList::InstructionList(InstructionList&&) = default;
+
+InstructionList::~InstructionList() = default;
+
+InstructionList& InstructionList::operator=(const InstructionList&) = default;
+
+InstructionList& InstructionList::operator=(InstructionList&&) = default;
+
+void InstructionList::push_back(spv::Op op, const OperandList& operands) {
+    auto start = words_.size();
+    words_.push_back(0);  // Placeholder for the word count and op
+    for (const auto& operand : operands) {
+        if (auto* i = std::get_if<uint32_t>(&operand)) {
+            words_.push_back(*i);
+        } else if (auto* f = std::get_if<float>(&operand)) {
+            words_.push_back(utils::Bitcast<uint32_t>(*f));
+        } else if (auto* str = std::get_if<std::string>(&operand)) {
+            auto idx = words_.size();
+            words_.resize(idx + OperandLength(operand), 0);
+            memcpy(words_.data() + idx, str->c_str(), str->size() + 1);
+        }
+    }
+    words_[start] = static_cast<uint32_t>(words_.size() - start) << 16 | static_cast<uint32_t>(op);
+    last_ = start;
+    count_++;
+}
+
+void InstructionList::append(const InstructionList& other) {
+    if (other.empty()) {
+        return;
+    }
+    last_ = words_.size() + other.last_;
+    count_ += other.count_;
+    words_.insert(words_.end(), other.words_.begin(), other.words_.end());
+}
+
+Instruction InstructionList::operator[](size_t index) const {
+    size_t offset = 0;
+    for (size_t i = 0; i < index; i++) {
+        offset += words_[offset] >> 16;
+    }
+    return Decode(offset);
+}
+
+Instruction InstructionList::Decode(size_t offset) const {
+    uint32_t word_count = words_[offset] >> 16;
+    OperandList operands;
+    operands.reserve(word_count - 1);
+    for (uint32_t i = 1; i < word_count; i++) {
+        operands.emplace_back(words_[offset + i]);
+    }
+    return Instruction{static_cast<spv::Op>(words_[offset] & 0xffff), std::move(operands)};
+}
+
 }  // namespace tint::writer::spirv
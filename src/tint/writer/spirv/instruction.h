@@ -15,6 +15,7 @@
 #ifndef SRC_TINT_WRITER_SPIRV_INSTRUCTION_H_
 #define SRC_TINT_WRITER_SPIRV_INSTRUCTION_H_
 
+#include <iterator>
 #include <vector>
 
 #include "spirv/unified1/spirv.hpp11"
@@ -47,8 +48,110 @@ class Instruction {
     OperandList operands_;
 };
 
-/// A list of instructions
-using InstructionList = std::vector<Instruction>;
+/// A list of instructions, stored in their SPIR-V binary encoding in a single buffer of words.
+/// Adding an instruction to the list encodes it in place, so that the builder does not allocate
+/// an Instruction for every instruction it emits, and the binary writer only has to copy the
+/// words of each list.
+/// Instructions read back from the list are decoded into Instructions whose operands are all
+/// uint32_t words, as float and string operands are indistinguishable from their encoding.
+class InstructionList {
+  public:
+    /// An iterator over the instructions of the list, which decodes each instruction
+    class Iterator {
+      public:
+        /// Iterator traits
+        using iterator_category = std::forward_iterator_tag;
+        /// Iterator traits
+        using value_type = Instruction;
+        /// Iterator traits
+        using difference_type = std::ptrdiff_t;
+        /// Iterator traits
+        using pointer = void;
+        /// Iterator traits
+        using reference = Instruction;
+
+        /// @returns the decoded instruction
+        Instruction operator*() const { return list_->Decode(offset_); }
+
+        /// Advances to the next instruction
+        /// @returns this iterator
+        Iterator& operator++() {
+            offset_ += list_->words_[offset_] >> 16;
+            return *this;
+        }
+
+        /// @param other the other iterator
+        /// @returns true if the two iterators point to the same instruction
+        bool operator==(const Iterator& other) const { return offset_ == other.offset_; }
+        /// @param other the other iterator
+        /// @returns true if the two iterators point to different instructions
+        bool operator!=(const Iterator& other) const { return offset_ != other.offset_; }
+
+      private:
+        friend class InstructionList;
+        Iterator(const InstructionList* list, size_t offset) : list_(list), offset_(offset) {}
+
+        const InstructionList* list_;
+        size_t offset_;
+    };
+
+    /// Constructor
+    InstructionList();
+    /// Copy constructor
+    InstructionList(const InstructionList&);
+    /// Move constructor
+    InstructionList(InstructionList&&);
+    ~InstructionList();
+
+    /// Copy assignment operator
+    /// @returns this list
+    InstructionList& operator=(const InstructionList&);
+    /// Move assignment operator
+    /// @returns this list
+    InstructionList& operator=(InstructionList&&);
+
+    /// Encodes an instruction at the end of the list
+    /// @param op the op of the instruction
+    /// @param operands the operand values for the instruction
+    void push_back(spv::Op op, const OperandList& operands);
+    /// Encodes an instruction at the end of the list
+    /// @param inst the instruction
+    void push_back(const Instruction& inst) { push_back(inst.opcode(), inst.operands()); }
+    /// Appends the instructions of another list to this list
+    /// @param other the list to append
+    void append(const InstructionList& other);
+
+    /// @returns the number of instructions in the list
+    size_t size() const { return count_; }
+    /// @returns true if the list has no instructions
+    bool empty() const { return count_ == 0; }
+
+    /// @returns the op of the last instruction of the list, which must not be empty
+    spv::Op last_opcode() const { return static_cast<spv::Op>(words_[last_] & 0xffff); }
+
+    /// Decodes an instruction of the list. This walks the list up to the instruction, so it is
+    /// intended for tests and debugging.
+    /// @param index the index of the instruction
+    /// @returns the decoded instruction
+    Instruction operator[](size_t index) const;
+
+    /// @returns an iterator to the first instruction
+    Iterator begin() const { return Iterator(this, 0); }
+    /// @returns an iterator past the last instruction
+    Iterator end() const { return Iterator(this, words_.size()); }
+
+    /// @returns the SPIR-V words of the instructions
+    const std::vector<uint32_t>& words() const { return words_; }
+    /// @returns the number of uint32_t's needed to hold the instructions
+    uint32_t word_length() const { return static_cast<uint32_t>(words_.size()); }
+
+  private:
+    Instruction Decode(size_t offset) const;
+
+    std::vector<uint32_t> words_;
+    size_t count_ = 0;
+    size_t last_ = 0;
+};
 
 }  // namespace tint::writer::spirv
 
@@ -14,6 +14,7 @@
 
 #include "src/tint/writer/spirv/instruction.h"
 
+#include <cstring>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -44,5 +45,75 @@ TEST_F(InstructionTest, Length) {
     EXPECT_EQ(i.word_length(), 5u);
 }
 
+using InstructionListTest = testing::Test;
+
+TEST_F(InstructionListTest, Empty) {
+    InstructionList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(list.word_length(), 0u);
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST_F(InstructionListTest, Encoding) {
+    InstructionList list;
+    list.push_back(spv::Op::OpEntryPoint, {Operand(1.2f), Operand(1u), Operand("my_str")});
+    list.push_back(spv::Op::OpKill, {});
+
+    EXPECT_FALSE(list.empty());
+    EXPECT_EQ(list.size(), 2u);
+    EXPECT_EQ(list.last_opcode(), spv::Op::OpKill);
+    ASSERT_EQ(list.word_length(), 6u);
+
+    const auto& words = list.words();
+    EXPECT_EQ(words[0], 5u << 16 | static_cast<uint32_t>(spv::Op::OpEntryPoint));
+    float f;
+    memcpy(&f, &words[1], 4);
+    EXPECT_EQ(f, 1.2f);
+    EXPECT_EQ(words[2], 1u);
+    EXPECT_EQ(memcmp(&words[3], "my_str\0\0", 8), 0);
+    EXPECT_EQ(words[5], 1u << 16 | static_cast<uint32_t>(spv::Op::OpKill));
+}
+
+TEST_F(InstructionListTest, Decode) {
+    InstructionList list;
+    list.push_back(spv::Op::OpEntryPoint, {Operand(1u), Operand(2u), Operand("main")});
+    list.push_back(Instruction{spv::Op::OpKill, {}});
+
+    auto first = list[0];
+    EXPECT_EQ(first.opcode(), spv::Op::OpEntryPoint);
+    EXPECT_EQ(first.word_length(), 5u);
+    ASSERT_EQ(first.operands().size(), 4u);
+    EXPECT_EQ(std::get<uint32_t>(first.operands()[0]), 1u);
+    EXPECT_EQ(std::get<uint32_t>(first.operands()[1]), 2u);
+
+    auto second = list[1];
+    EXPECT_EQ(second.opcode(), spv::Op::OpKill);
+    EXPECT_TRUE(second.operands().empty());
+
+    size_t count = 0;
+    for (const auto& inst : list) {
+        EXPECT_EQ(inst.opcode(), count == 0 ? spv::Op::OpEntryPoint : spv::Op::OpKill);
+        count++;
+    }
+    EXPECT_EQ(count, 2u);
+}
+
+TEST_F(InstructionListTest, Append) {
+    InstructionList a;
+    a.push_back(spv::Op::OpKill, {Operand(1u)});
+    InstructionList b;
+    b.push_back(spv::Op::OpCapability, {Operand(2u)});
+    b.push_back(spv::Op::OpReturn, {});
+
+    a.append(b);
+    a.append(InstructionList{});
+    EXPECT_EQ(a.size(), 3u);
+    EXPECT_EQ(a.word_length(), 5u);
+    EXPECT_EQ(a.last_opcode(), spv::Op::OpReturn);
+    EXPECT_EQ(a[1].opcode(), spv::Op::OpCapability);
+    EXPECT_EQ(std::get<uint32_t>(a[1].operands()[0]), 2u);
+}
+
 }  // namespace
 }  // namespace tint::writer::spirv